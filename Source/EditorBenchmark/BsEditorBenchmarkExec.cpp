@@ -0,0 +1,22 @@
+//********************************** Banshee Engine (www.banshee3d.com) **************************************************//
+//**************** Copyright (c) 2019 Marko Pintera (marko.pintera@gmail.com). All rights reserved. **********************//
+#include "BsEditorApplication.h"
+#include "Testing/BsEditorBenchmarkSuite.h"
+
+using namespace bs;
+
+/**
+ * Runs the editor benchmarks in a headless editor and writes the JSON report to the path provided as the first
+ * argument, or to EditorBenchmark.json in the working directory if no path is provided. Benchmarks generate their own
+ * temporary project and never touch the editor settings or any existing project.
+ */
+int main(int argc, char* argv[])
+{
+	const Path outputPath = argc > 1 ? Path(argv[1]) : Path("EditorBenchmark.json");
+
+	EditorApplication::startUpHeadless();
+	const bool success = EditorBenchmarkSuite::runAndReport(outputPath);
+	EditorApplication::shutDown();
+
+	return success ? 0 : 1;
+}
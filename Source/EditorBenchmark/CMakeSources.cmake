@@ -0,0 +1,9 @@
+set(BS_EDITORBENCHMARK_SRC_NOFILTER
+	"BsEditorBenchmarkExec.cpp"
+)
+
+source_group("Source Files" FILES ${BS_EDITORBENCHMARK_SRC_NOFILTER})
+
+set(BS_EDITORBENCHMARK_SRC
+	${BS_EDITORBENCHMARK_SRC_NOFILTER}
+)
@@ -9,9 +9,11 @@
 #include "UndoRedo/BsUndoRedo.h"
 #include "Serialization/BsFileSerializer.h"
 #include "FileSystem/BsFileSystem.h"
+#include "FileSystem/BsDataStream.h"
 #include "EditorWindow/BsEditorWidgetLayout.h"
 #include "Scene/BsScenePicking.h"
 #include "Scene/BsSelection.h"
+#include "Scene/BsEditorSceneSnapshot.h"
 #include "Scene/BsGizmoManager.h"
 #include "CodeEditor/BsCodeEditor.h"
 #include "Build/BsBuildManager.h"
@@ -19,6 +21,7 @@
 #include "Library/BsEditorShaderIncludeHandler.h"
 #include "EditorWindow/BsDropDownWindowManager.h"
 #include "Library/BsProjectLibrary.h"
+#include "GUI/BsGradientTextureCache.h"
 #include "Settings/BsProjectSettings.h"
 #include "Settings/BsEditorSettings.h"
 #include "Script/BsScriptManager.h"
@@ -27,6 +30,7 @@
 #include "Resources/BsResources.h"
 #include "Scene/BsSceneManager.h"
 #include "Utility/BsSplashScreen.h"
+#include "Utility/BsEditorProfiler.h"
 #include "Utility/BsDynLib.h"
 #include "Scene/BsSceneManager.h"
 #include "BsEngineConfig.h"
@@ -39,10 +43,13 @@ namespace bs
 	const Path EditorApplication::BUILD_DATA_PATH = PROJECT_INTERNAL_DIR + "BuildData.asset";
 	const Path EditorApplication::PROJECT_SETTINGS_PATH = PROJECT_INTERNAL_DIR + "Settings.asset";
 
-	START_UP_DESC createStartupDesc()
+	/** Name of the render API plugin used when running the editor without a render device. */
+	constexpr const char* HEADLESS_RENDER_API_MODULE = "bsfNullRenderAPI";
+
+	START_UP_DESC createStartupDesc(bool headless)
 	{
 		START_UP_DESC startUpDesc;
-		startUpDesc.renderAPI = BS_RENDER_API_MODULE;
+		startUpDesc.renderAPI = headless ? HEADLESS_RENDER_API_MODULE : BS_RENDER_API_MODULE;
 		startUpDesc.renderer = BS_RENDERER_MODULE;
 		startUpDesc.audio = BS_AUDIO_MODULE;
 		startUpDesc.physics = BS_PHYSICS_MODULE;
@@ -70,16 +77,18 @@ namespace bs
 		return Paths::getEditorDataPath() + "Settings.asset";
 	}
 
-	EditorApplication::EditorApplication()
-		:Application(createStartupDesc()), mIsProjectLoaded(false)
+	EditorApplication::EditorApplication(bool headless)
+		:Application(createStartupDesc(headless)), mIsHeadless(headless), mIsProjectLoaded(false)
 	{
 
 	}
 
 	EditorApplication::~EditorApplication()
 	{
+		GradientTextureCache::shutDown();
 		ProjectLibrary::shutDown();
 		BuiltinEditorResources::shutDown();
+		EditorProfiler::shutDown();
 	}
 
 	void EditorApplication::onStartUp()
@@ -95,10 +104,13 @@ namespace bs
 		ScriptCodeImporter* scriptCodeImporter = bs_new<ScriptCodeImporter>();
 		Importer::instance()._registerAssetImporter(scriptCodeImporter);
 
+		EditorProfiler::startUp();
+
 		// Hidden dependency: Needs to be done before BuiltinEditorResources import as shader include lookup requires it
 		ProjectLibrary::startUp();
 
 		BuiltinEditorResources::startUp();
+		GradientTextureCache::startUp();
 
 		{
 			auto inputConfig = VirtualInput::instance().getConfiguration();
@@ -115,6 +127,7 @@ namespace bs
 
 		ScenePicking::startUp();
 		Selection::startUp();
+		EditorSceneSnapshot::startUp();
 		GizmoManager::startUp();
 		BuildManager::startUp();
 		CodeEditorManager::startUp();
@@ -130,6 +143,7 @@ namespace bs
 		CodeEditorManager::shutDown();
 		BuildManager::shutDown();
 		GizmoManager::shutDown();
+		EditorSceneSnapshot::shutDown();
 		Selection::shutDown();
 		ScenePicking::shutDown();
 
@@ -148,8 +162,20 @@ namespace bs
 		CoreApplication::startUp<EditorApplication>();
 	}
 
+	void EditorApplication::startUpHeadless()
+	{
+		CoreApplication::startUp<EditorApplication>(true);
+	}
+
 	void EditorApplication::startUpRenderer()
 	{
+		// Editor windows stay hidden when headless, there is nothing to show the splash screen in front of
+		if (mIsHeadless)
+		{
+			mSplashScreenShown = false;
+			return;
+		}
+
 		mSplashScreenTimer.reset();
 		SplashScreen::show();
 	}
@@ -170,17 +196,31 @@ namespace bs
 	{
 		Application::preUpdate();
 
-		EditorWidgetManager::instance().update();
+		EditorProfiler::instance().beginFrame();
+
+		{
+			BS_EDITOR_PROFILE_SCOPE("EditorWindows", "EditorWidgetManager::update");
+			EditorWidgetManager::instance().update();
+		}
+
 		DropDownWindowManager::instance().update();
+		ScenePicking::instance().update();
+		gProjectLibrary()._releaseLoadedPreloads();
 	}
 
 	void EditorApplication::postUpdate()
 	{
-		ScriptManager::instance().update();
+		{
+			BS_EDITOR_PROFILE_SCOPE("Scripting", "ScriptManager::update");
+			ScriptManager::instance().update();
+		}
 
 		// Call update on editor widgets before parent's postUpdate because the parent will render the GUI and we need
 		// to ensure editor widget's GUI is updated.
-		EditorWindowManager::instance().update();
+		{
+			BS_EDITOR_PROFILE_SCOPE("EditorWindows", "EditorWindowManager::update");
+			EditorWindowManager::instance().update();
+		}
 
 		Application::postUpdate();
 
@@ -275,6 +315,18 @@ namespace bs
 		if (!FileSystem::exists(internalResourcesDir))
 			FileSystem::createDir(internalResourcesDir);
 
+		// Meta files are always saved with Unix line endings, so keep source control from converting them on checkout, 
+		// which would otherwise make every re-saved meta file show up as modified
+		Path gitAttributesPath = Path::combine(path, ".gitattributes");
+		if (!FileSystem::exists(gitAttributesPath))
+		{
+			const String gitAttributes = "*.meta eol=lf\n";
+
+			SPtr<DataStream> stream = FileSystem::createAndOpenFile(gitAttributesPath);
+			stream->write(gitAttributes.data(), gitAttributes.size());
+			stream->close();
+		}
+
 		saveDefaultWidgetLayout(path);
 	}
 
@@ -351,7 +403,8 @@ namespace bs
 
 	void EditorApplication::saveEditorSettings()
 	{
-		if (mEditorSettings == nullptr)
+		// Headless tools share the settings file with the user's editor, and must not overwrite it
+		if (mEditorSettings == nullptr || mIsHeadless)
 			return;
 
 		Path settingsPath = getEditorSettingsPath();
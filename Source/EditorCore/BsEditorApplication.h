@@ -16,12 +16,22 @@ namespace bs
 	class BS_ED_EXPORT EditorApplication : public Application
 	{
 	public:
-		EditorApplication();
+		EditorApplication(bool headless = false);
 		virtual ~EditorApplication();
 
 		/**	Starts the editor with the specified render and audio systems. */
 		static void startUp();
 
+		/**
+		 * Starts the editor without a render device, using the null render API, and never shows any of the editor
+		 * windows. Scripts are only initialized if a script library was registered. Meant for automated tools like the
+		 * editor benchmark, which must not interact with the user's editor session.
+		 */
+		static void startUpHeadless();
+
+		/** Checks was the editor started using startUpHeadless(). */
+		bool isHeadless() const { return mIsHeadless; }
+
 		/**	Checks whether the editor currently has a project loaded. */
 		bool isProjectLoaded() const { return mIsProjectLoaded; }
 
@@ -133,6 +143,7 @@ namespace bs
 		SPtr<EditorSettings> mEditorSettings;
 		SPtr<ProjectSettings> mProjectSettings;
 
+		bool mIsHeadless;
 		bool mIsProjectLoaded;
 		Path mProjectPath;
 		String mProjectName;
@@ -9,6 +9,9 @@ set(BS_BANSHEEEDITOR_SRC_LIBRARY
 	"Library/BsProjectLibraryEntries.cpp"
 	"Library/BsProjectResourceMeta.cpp"
 	"Library/BsEditorShaderIncludeHandler.cpp"
+	"Library/BsImportGovernor.cpp"
+	"Library/BsImportDependencyGraph.cpp"
+	"Library/BsLibraryChangeBatch.cpp"
 )
 
 set(BS_BANSHEEEDITOR_INC_EDITORWINDOW
@@ -33,12 +36,14 @@ set(BS_BANSHEEEDITOR_INC_SCENE
 	"Scene/BsScenePicking.h"
 	"Scene/BsSelection.h"
 	"Scene/BsSelectionRenderer.h"
+	"Scene/BsEditorSceneSnapshot.h"
 	"Scene/BsSerializedSceneObject.h"
 )
 
 set(BS_BANSHEEEDITOR_SRC_GUI
 	"GUI/BsGUIColor.cpp"
 	"GUI/BsGUIColorGradient.cpp"
+	"GUI/BsGradientTextureCache.cpp"
 	"GUI/BsGUIColorField.cpp"
 	"GUI/BsGUIDockSlider.cpp"
 	"GUI/BsGUIDropButton.cpp"
@@ -77,11 +82,15 @@ set(BS_BANSHEEEDITOR_INC_LIBRARY
 	"Library/BsProjectLibraryEntries.h"
 	"Library/BsProjectResourceMeta.h"
 	"Library/BsEditorShaderIncludeHandler.h"
+	"Library/BsImportGovernor.h"
+	"Library/BsImportDependencyGraph.h"
+	"Library/BsLibraryChangeBatch.h"
 )
 
 set(BS_BANSHEEEDITOR_INC_GUI
 	"GUI/BsGUIColor.h"
 	"GUI/BsGUIColorGradient.h"
+	"GUI/BsGradientTextureCache.h"
 	"GUI/BsGUIColorField.h"
 	"GUI/BsGUIDockSlider.h"
 	"GUI/BsGUIDropButton.h"
@@ -150,6 +159,7 @@ set(BS_BANSHEEEDITOR_SRC_SCENE
 	"Scene/BsSelectionRenderer.cpp"
 	"Scene/BsSelection.cpp"
 	"Scene/BsScenePicking.cpp"
+	"Scene/BsEditorSceneSnapshot.cpp"
 	"Scene/BsSceneGrid.cpp"
 	"Scene/BsSerializedSceneObject.cpp"
 )
@@ -168,12 +178,15 @@ set(BS_BANSHEEEDITOR_INC_HANDLES
 	"Handles/BsHandleSliderManager.h"
 	"Handles/BsHandleSliderPlane.h"
 	"Handles/BsHandleSliderSphere.h"
+	"Handles/BsHandleSliderPointSet.h"
 	"Handles/BsHandleSlider2D.h"
 )
 
 set(BS_BANSHEEEDITOR_SRC_UTILITY
 	"Utility/BsEditorUtility.cpp"
 	"Utility/BsSplashScreen.cpp"
+	"Utility/BsEditorProfiler.cpp"
+	"Utility/BsDrawMeshCache.cpp"
 )
 
 set(BS_BANSHEEEDITOR_SRC_EDITORWINDOW
@@ -196,10 +209,13 @@ set(BS_BANSHEEEDITOR_INC_UTILITY
 	"Utility/BsEditorUtility.h"
 	"Utility/BsBuiltinEditorResources.h"
 	"Utility/BsSplashScreen.h"
+	"Utility/BsEditorProfiler.h"
+	"Utility/BsDrawMeshCache.h"
 )
 
 set(BS_BANSHEEEDITOR_SRC_TESTING
 	"Testing/BsEditorTestSuite.cpp"
+	"Testing/BsEditorBenchmarkSuite.cpp"
 )
 
 set(BS_BANSHEEEDITOR_SRC_SETTINGS
@@ -240,11 +256,13 @@ set(BS_BANSHEEEDITOR_SRC_HANDLES
 	"Handles/BsHandleSliderManager.cpp"
 	"Handles/BsHandleSliderPlane.cpp"
 	"Handles/BsHandleSliderSphere.cpp"
+	"Handles/BsHandleSliderPointSet.cpp"
 	"Handles/BsHandleSlider2D.cpp"
 )
 
 set(BS_BANSHEEEDITOR_INC_TESTING
 	"Testing/BsEditorTestSuite.h"
+	"Testing/BsEditorBenchmarkSuite.h"
 )
 
 set(BS_BANSHEEEDITOR_INC_CODEEDITOR
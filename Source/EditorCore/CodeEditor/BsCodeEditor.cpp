@@ -7,6 +7,8 @@
 #include "Resources/BsScriptCodeImportOptions.h"
 #include "Build/BsBuildManager.h"
 #include "CodeEditor/BsMDCodeEditor.h"
+#include "FileSystem/BsFileSystem.h"
+#include "FileSystem/BsDataStream.h"
 
 #if BS_PLATFORM == BS_PLATFORM_WIN32
 #include "Private/Win32/BsVSCodeEditor.h"
@@ -43,10 +45,21 @@ namespace bs
 		}
 
 		mFactories.push_back(mdCodeEditorFactory);
+
+		mEntryAddedConn = gProjectLibrary().onEntryAdded.connect(
+			std::bind(&CodeEditorManager::onEntryAdded, this, std::placeholders::_1));
+		mEntryRemovedConn = gProjectLibrary().onEntryRemoved.connect(
+			std::bind(&CodeEditorManager::onEntryRemoved, this, std::placeholders::_1));
+		mEntryImportedConn = gProjectLibrary().onEntryImported.connect(
+			std::bind(&CodeEditorManager::onEntryImported, this, std::placeholders::_1));
 	}
 
 	CodeEditorManager::~CodeEditorManager()
 	{
+		mEntryAddedConn.disconnect();
+		mEntryRemovedConn.disconnect();
+		mEntryImportedConn.disconnect();
+
 		for (auto& factory : mFactories)
 			bs_delete(factory);
 
@@ -91,13 +104,6 @@ namespace bs
 		CodeSolutionData slnData;
 		slnData.name = gEditorApplication().getProjectName();
 
-		Vector<UINT32> scriptTypeIds =
-		{
-			TID_ScriptCode, TID_PlainText, TID_Shader, TID_ShaderInclude
-		};
-
-		Vector<USPtr<ProjectLibrary::LibraryEntry>> libraryEntries = gProjectLibrary().search("*", scriptTypeIds);
-		
 		PlatformType activePlatform = BuildManager::instance().getActivePlatform();
 		Vector<String> frameworkAssemblies = BuildManager::instance().getFrameworkAssemblies(activePlatform);
 
@@ -127,38 +133,142 @@ namespace bs
 		editorProject.projectReferences.push_back(CodeProjectReference{ gameProject.name, Path::BLANK });
 
 		//// Add files for both projects
-		for (auto& entry : libraryEntries)
+		refreshSolutionFiles();
+		for (auto& entry : mSolutionFiles)
+		{
+			const SolutionFile& file = entry.second;
+			switch (file.type)
+			{
+			case SolutionFileType::GameCode:
+				gameProject.codeFiles.push_back(file.path);
+				break;
+			case SolutionFileType::EditorCode:
+				editorProject.codeFiles.push_back(file.path);
+				break;
+			case SolutionFileType::NonCode:
+				gameProject.nonCodeFiles.push_back(file.path);
+				break;
+			}
+		}
+
+		mActiveEditor->syncSolution(slnData, gEditorApplication().getProjectPath());
+	}
+
+	Path CodeEditorManager::getSolutionPath() const
+	{
+		Path path = gEditorApplication().getProjectPath();
+		path.append(gEditorApplication().getProjectName() + ".sln");
+
+		return path;
+	}
+
+	void CodeEditorManager::onEntryAdded(const Path& path)
+	{
+		if (!mSolutionFilesDirty)
+			updateSolutionFiles(path);
+	}
+
+	void CodeEditorManager::onEntryRemoved(const Path& path)
+	{
+		if (mSolutionFilesDirty)
+			return;
+
+		// The entry might have been a directory, in which case all the files within it are removed as well
+		const String key = path.toString();
+		for (auto iter = mSolutionFiles.lower_bound(key); iter != mSolutionFiles.end();)
+		{
+			if (iter->first.compare(0, key.size(), key) != 0)
+				break;
+
+			if (path.includes(iter->second.path))
+				iter = mSolutionFiles.erase(iter);
+			else
+				++iter;
+		}
+	}
+
+	void CodeEditorManager::onEntryImported(const Path& path)
+	{
+		// Import options determine which project a script belongs to
+		if (!mSolutionFilesDirty)
+			updateSolutionFiles(path);
+	}
+
+	void CodeEditorManager::updateSolutionFiles(const Path& path) const
+	{
+		auto updateFile = [this](const ProjectLibrary::FileEntry* fileEntry)
 		{
-			if (entry->type != ProjectLibrary::LibraryEntryType::File)
-				continue;
+			const String key = fileEntry->path.toString();
 
-			ProjectLibrary::FileEntry* resEntry = static_cast<ProjectLibrary::FileEntry*>(entry.get());
-			if (resEntry->meta->hasTypeId(TID_ScriptCode))
+			const SPtr<ProjectFileMeta>& meta = fileEntry->meta;
+			if (meta == nullptr)
 			{
-				SPtr<ScriptCodeImportOptions> scriptIO = std::static_pointer_cast<ScriptCodeImportOptions>(resEntry->meta->getImportOptions());
+				mSolutionFiles.erase(key);
+				return;
+			}
+
+			if (meta->hasTypeId(TID_ScriptCode))
+			{
+				SPtr<ScriptCodeImportOptions> scriptIO = std::static_pointer_cast<ScriptCodeImportOptions>(meta->getImportOptions());
 
 				bool isEditorScript = false;
 				if (scriptIO != nullptr)
 					isEditorScript = scriptIO->editorScript;
 
-				if (isEditorScript)
-					editorProject.codeFiles.push_back(resEntry->path);
-				else
-					gameProject.codeFiles.push_back(resEntry->path);
+				mSolutionFiles[key] = { fileEntry->path, isEditorScript ? SolutionFileType::EditorCode : SolutionFileType::GameCode };
 			}
+			else if (meta->hasTypeId(TID_PlainText) || meta->hasTypeId(TID_Shader) || meta->hasTypeId(TID_ShaderInclude))
+				mSolutionFiles[key] = { fileEntry->path, SolutionFileType::NonCode };
 			else
-				gameProject.nonCodeFiles.push_back(resEntry->path);
+				mSolutionFiles.erase(key);
+		};
+
+		USPtr<ProjectLibrary::LibraryEntry> entry = gProjectLibrary().findEntry(path);
+		if (entry == nullptr)
+		{
+			mSolutionFiles.erase(path.toString());
+			return;
 		}
 
-		mActiveEditor->syncSolution(slnData, gEditorApplication().getProjectPath());
+		if (entry->type == ProjectLibrary::LibraryEntryType::File)
+		{
+			updateFile(static_cast<ProjectLibrary::FileEntry*>(entry.get()));
+			return;
+		}
+
+		Stack<ProjectLibrary::DirectoryEntry*> todo;
+		todo.push(static_cast<ProjectLibrary::DirectoryEntry*>(entry.get()));
+
+		while (!todo.empty())
+		{
+			ProjectLibrary::DirectoryEntry* dirEntry = todo.top();
+			todo.pop();
+
+			for (auto& child : dirEntry->mChildren)
+			{
+				if (child->type == ProjectLibrary::LibraryEntryType::Directory)
+					todo.push(static_cast<ProjectLibrary::DirectoryEntry*>(child.get()));
+				else
+					updateFile(static_cast<ProjectLibrary::FileEntry*>(child.get()));
+			}
+		}
 	}
 
-	Path CodeEditorManager::getSolutionPath() const
+	void CodeEditorManager::refreshSolutionFiles() const
 	{
-		Path path = gEditorApplication().getProjectPath();
-		path.append(gEditorApplication().getProjectName() + ".sln");
+		const USPtr<ProjectLibrary::DirectoryEntry>& rootEntry = gProjectLibrary().getRootEntry();
+		if (rootEntry == nullptr)
+			return;
 
-		return path;
+		// Once built, the set is kept up to date through library events, unless a different project was loaded
+		if (!mSolutionFilesDirty && mSolutionFilesRoot == rootEntry->path)
+			return;
+
+		mSolutionFiles.clear();
+		mSolutionFilesRoot = rootEntry->path;
+		mSolutionFilesDirty = false;
+
+		updateSolutionFiles(rootEntry->path);
 	}
 
 	const String CSProject::SLN_TEMPLATE =
@@ -378,4 +488,36 @@ EndProject)";
 		return StringUtil::format(PROJ_TEMPLATE, versionData[version].toolsVersion, projectGUID, 
 			projectData.name, defines, referenceEntries, projectReferenceEntries, codeEntries, nonCodeEntries);
 	}
-}
\ No newline at end of file
+
+	bool CSProject::writeFile(const Path& path, const String& contents)
+	{
+		const size_t numBytes = contents.size() * sizeof(String::value_type);
+
+		// Rewriting a file causes IDEs to reload the solution, so avoid doing it unless something actually changed
+		if (FileSystem::isFile(path))
+		{
+			SPtr<DataStream> existingStream = FileSystem::openFile(path, true);
+			if (existingStream != nullptr && existingStream->size() == numBytes)
+			{
+				Vector<char> existingContents(numBytes);
+				if (numBytes > 0)
+					existingStream->read(existingContents.data(), numBytes);
+
+				existingStream->close();
+
+				if (numBytes == 0 || memcmp(existingContents.data(), contents.data(), numBytes) == 0)
+					return false;
+			}
+		}
+
+		Path tempPath = path;
+		tempPath.setFilename(path.getFilename() + ".tmp");
+
+		SPtr<DataStream> stream = FileSystem::createAndOpenFile(tempPath);
+		stream->write(contents.c_str(), numBytes);
+		stream->close();
+
+		FileSystem::move(tempPath, path, true);
+		return true;
+	}
+}
@@ -77,7 +77,8 @@ namespace bs
 
 		/**
 		 * Synchronizes all code files and assemblies in the active project and updates the project solution for the active
-		 * editor. Each project can only have one solution per editor.
+		 * editor. Each project can only have one solution per editor. Solution and project files are only written if
+		 * their contents changed, so IDEs don't reload the solution unless they need to.
 		 */
 		void syncSolution(const String& gameProjectName, const CodeProjectReference& engineAssemblyRef, 
 			const CodeProjectReference& editorAssemblyRef) const;
@@ -85,11 +86,53 @@ namespace bs
 		/**	Returns the absolute path at which the external editor solution file should be stored. */
 		Path getSolutionPath() const;
 	private:
+		/** Determines in which project, and how, a file is included in the solution. */
+		enum class SolutionFileType
+		{
+			GameCode,
+			EditorCode,
+			NonCode
+		};
+
+		/** File included in the solution. */
+		struct SolutionFile
+		{
+			Path path;
+			SolutionFileType type;
+		};
+
+		/** Triggered when a project library entry is added, or moved to a new location. */
+		void onEntryAdded(const Path& path);
+
+		/** Triggered when a project library entry is removed, or moved from its current location. */
+		void onEntryRemoved(const Path& path);
+
+		/** Triggered when a project library file is (re)imported. */
+		void onEntryImported(const Path& path);
+
+		/**
+		 * Adds, updates or removes the solution file for the project library entry at the provided path. If the entry is
+		 * a directory, all the files within it are updated.
+		 */
+		void updateSolutionFiles(const Path& path) const;
+
+		/** Rebuilds the set of solution files from scratch, if the set is not up to date with the project library. */
+		void refreshSolutionFiles() const;
+
 		CodeEditor* mActiveEditor;
 		CodeEditorType mActiveEditorType;
 		Map<CodeEditorType, CodeEditorFactory*> mFactoryPerEditor;
 		Vector<CodeEditorType> mEditors;
 		Vector<CodeEditorFactory*> mFactories;
+
+		/** Files in the solution, kept in sync with the project library. Keyed by path for deterministic output order. */
+		mutable Map<String, SolutionFile> mSolutionFiles;
+		mutable Path mSolutionFilesRoot;
+		mutable bool mSolutionFilesDirty = true;
+
+		HEvent mEntryAddedConn;
+		HEvent mEntryRemovedConn;
+		HEvent mEntryImportedConn;
 	};
 
 	/** @} */
@@ -183,6 +226,17 @@ namespace bs
 		 */
 		static String writeProject(CSProjectVersion version, const CodeProjectData& projectData);
 
+		/**
+		 * Writes the provided text to a solution or project file, unless the file already contains exactly the same text.
+		 * The text is first written to a temporary file which then replaces the existing file, so external tools never
+		 * observe a partially written file.
+		 *
+		 * @param[in]	path		Absolute path to the file to write.
+		 * @param[in]	contents	Text to write to the file.
+		 * @return					True if the file was written, false if its contents were already up to date.
+		 */
+		static bool writeFile(const Path& path, const String& contents);
+
 	private:
 		static const String SLN_TEMPLATE; /**< Template text used for a solution file. */
 		static const String PROJ_ENTRY_TEMPLATE; /**< Template text used for a project entry in a solution file. */
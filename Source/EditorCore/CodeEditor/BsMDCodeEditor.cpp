@@ -86,14 +86,10 @@ namespace bs
 			Path projectPath = outputPath;
 			projectPath.append(project.name + ".csproj");
 
-			SPtr<DataStream> projectStream = FileSystem::createAndOpenFile(projectPath);
-			projectStream->write(projectString.c_str(), projectString.size() * sizeof(String::value_type));
-			projectStream->close();
+			CSProject::writeFile(projectPath, projectString);
 		}
 
-		SPtr<DataStream> solutionStream = FileSystem::createAndOpenFile(solutionPath);
-		solutionStream->write(solutionString.c_str(), solutionString.size() * sizeof(String::value_type));
-		solutionStream->close();
+		CSProject::writeFile(solutionPath, solutionString);
 	}
 
 	MDCodeEditorFactory::MDCodeEditorFactory()
@@ -4,6 +4,7 @@
 #include "EditorWindow/BsEditorWindow.h"
 #include "EditorWindow/BsMainEditorWindow.h"
 #include "RenderAPI/BsRenderWindow.h"
+#include "GUI/BsGradientTextureCache.h"
 
 namespace bs
 {
@@ -92,6 +93,10 @@ namespace bs
 			bs_delete(windowToDestroy);
 		}
 
+		// Gradient textures used by the closed windows are unlikely to be needed again
+		if(!mScheduledForDestruction.empty())
+			GradientTextureCache::instance().clearUnused();
+
 		mScheduledForDestruction.clear();
 
 		// Make a copy since other editors might be opened/closed from editor update() methods
@@ -82,5 +82,6 @@ namespace bs
 	void MainEditorWindow::update()
 	{
 		mDockManager->update();
+		mStatusBar->update();
 	}
 }
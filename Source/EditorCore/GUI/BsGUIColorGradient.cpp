@@ -25,6 +25,15 @@ namespace bs
 
 	GUIColorGradient::~GUIColorGradient()
 	{
+		if(GradientTextureCache::isStarted())
+		{
+			if(mHasColorTexture)
+				GradientTextureCache::instance().release(mColorTextureKey);
+
+			if(mHasAlphaTexture)
+				GradientTextureCache::instance().release(mAlphaTextureKey);
+		}
+
 		bs_delete(mColorSprite);
 		bs_delete(mAlphaSprite);
 	}
@@ -108,8 +117,12 @@ namespace bs
 		mAlphaImageDesc.width = mLayoutData.area.width;
 		mAlphaImageDesc.height = mLayoutData.area.height - mColorImageDesc.height;
 
-		mColorImageDesc.texture = SpriteTexture::create(generateGradientTexture(mValue, mLayoutData.area.width, false)); 
-		mAlphaImageDesc.texture = SpriteTexture::create(generateGradientTexture(mValue, mLayoutData.area.width, true)); 
+		// Textures only need to change if the gradient or the width changed
+		const UINT32 width = mLayoutData.area.width;
+		updateTexture(GradientTextureCache::Key(mValue, width, false), mColorTextureKey, mHasColorTexture, 
+			mColorImageDesc);
+		updateTexture(GradientTextureCache::Key(mValue, width, true), mAlphaTextureKey, mHasAlphaTexture, 
+			mAlphaImageDesc);
 
 		mColorSprite->update(mColorImageDesc, (UINT64)_getParentWidget());
 		mAlphaSprite->update(mAlphaImageDesc, (UINT64)_getParentWidget());
@@ -164,24 +177,19 @@ namespace bs
 		return false;
 	}
 
-	HTexture GUIColorGradient::generateGradientTexture(const ColorGradient& gradient, UINT32 width, bool alpha)
+	void GUIColorGradient::updateTexture(const GradientTextureCache::Key& key, GradientTextureCache::Key& currentKey, 
+		bool& hasTexture, IMAGE_SPRITE_DESC& desc)
 	{
-		SPtr<PixelData> pixelData = PixelData::create(std::max(width, 1U), 1, 1, PF_RGBA8);
-
-		const float halfPixel = 0.5f / width;
-		for (UINT32 i = 0; i < width; i++)
-		{
-			const float t = i / (float)width + halfPixel;
+		if(hasTexture && key == currentKey)
+			return;
 
-			Color value = Color::fromRGBA(gradient.evaluate(t));
+		GradientTextureCache& cache = GradientTextureCache::instance();
+		desc.texture = cache.acquire(key);
 
-			if (alpha)
-				value = Color::lerp(value.a, Color::Black, Color::White);
+		if(hasTexture)
+			cache.release(currentKey);
 
-			value.a = 1.0f;
-			pixelData->setColorAt(value, i, 0);
-		}
-		
-		return Texture::create(pixelData);
+		currentKey = key;
+		hasTexture = true;
 	}
 }
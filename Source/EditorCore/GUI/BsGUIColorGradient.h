@@ -7,6 +7,7 @@
 #include "2D/BsImageSprite.h"
 #include "GUI/BsGUIContent.h"
 #include "Image/BsColorGradient.h"
+#include "GUI/BsGradientTextureCache.h"
 
 namespace bs
 {
@@ -83,15 +84,16 @@ namespace bs
 		bool _mouseEvent(const GUIMouseEvent& ev) override;
 
 		/** 
-		 * Generates a texture from the provided color gradient value. 
+		 * Updates the texture referenced by the image descriptor so it represents the provided gradient key. The texture
+		 * is retrieved from GradientTextureCache and the previously referenced texture released.
 		 * 
-		 * @param[in]	gradient	Gradient to generate the texture from.
-		 * @param[in]	width		Width of the texture in pixels. Height is always 1.
-		 * @param[in]	alpha		If true generate a texture representing the alpha values of the gradient (grayscale),
-		 *							otherwise generate a color texture.
-		 * @return					Generated texture.
+		 * @param[in]		key			Key of the texture to display.
+		 * @param[in, out]	currentKey	Key of the currently referenced texture, if any. Updated to the new key.
+		 * @param[in, out]	hasTexture	True if @p currentKey references a texture. Set to true on return.
+		 * @param[in, out]	desc		Image descriptor to update.
 		 */
-		static HTexture generateGradientTexture(const ColorGradient& gradient, UINT32 width, bool alpha = false);
+		static void updateTexture(const GradientTextureCache::Key& key, GradientTextureCache::Key& currentKey, 
+			bool& hasTexture, IMAGE_SPRITE_DESC& desc);
 
 	private:
 		static const float ALPHA_SPLIT_POSITION;
@@ -103,6 +105,11 @@ namespace bs
 		IMAGE_SPRITE_DESC mAlphaImageDesc;
 
 		ColorGradient mValue;
+
+		GradientTextureCache::Key mColorTextureKey;
+		GradientTextureCache::Key mAlphaTextureKey;
+		bool mHasColorTexture = false;
+		bool mHasAlphaTexture = false;
 	};
 
 	/** @} */
@@ -14,6 +14,9 @@ namespace bs
 {
 	static constexpr int LINE_SPLIT_WIDTH = 2;
 	static constexpr int TANGENT_LINE_DISTANCE = 30;
+	static constexpr int KEYFRAME_PICK_DISTANCE = 5;
+	static constexpr int KEYFRAME_DRAW_SIZE = 3;
+	static constexpr int MIN_PIXELS_PER_KEYFRAME = 4;
 	static constexpr Color COLOR_MID_GRAY = Color(90.0f / 255.0f, 90.0f / 255.0f, 90.0f / 255.0f, 1.0f);
 	static constexpr Color COLOR_DARK_GRAY = Color(40.0f / 255.0f, 40.0f / 255.0f, 40.0f / 255.0f, 1.0f);
 
@@ -56,6 +59,7 @@ namespace bs
 			return;
 
 		mCurves = curves;
+		mCurveSamplesDirty = true;
 		_markContentAsDirty();
 	}
 
@@ -145,14 +149,28 @@ namespace bs
 	{
 		keyframe = KeyframeRef();
 
+		const UINT32 drawableWidth = getDrawableWidth();
+		if (drawableWidth == 0)
+			return false;
+
+		// Only keyframes within the pick distance horizontally can be under the coordinates. Add an extra pixel to
+		// account for rounding in curveToPixelSpace().
+		const float lengthPerPixel = getRange() / drawableWidth;
+		const float pickTime = mOffset + (pixelCoords.x - (INT32)mPadding) * lengthPerPixel;
+		const float pickWindow = (KEYFRAME_PICK_DISTANCE + 1) * lengthPerPixel;
+
 		float nearestDistance = std::numeric_limits<float>::max();
 		for (UINT32 i = 0; i < (UINT32)mCurves.size(); i++)
 		{
 			const TAnimationCurve<float>& curve = mCurves[i].curve;
 			const Vector<TKeyframe<float>>& keyframes = curve.getKeyFrames();
 
-			for (UINT32 j = 0; j < (UINT32)keyframes.size(); j++)
+			const float windowEnd = pickTime + pickWindow;
+			for (UINT32 j = findFirstKeyframe(keyframes, pickTime - pickWindow); j < (UINT32)keyframes.size(); j++)
 			{
+				if (keyframes[j].time > windowEnd)
+					break;
+
 				const Vector2 keyframeCurveCoords = Vector2(keyframes[j].time, keyframes[j].value);
 				const Vector2I keyframeCoords = curveToPixelSpace(keyframeCurveCoords);
 
@@ -166,7 +184,7 @@ namespace bs
 			}
 		}
 
-		return nearestDistance <= 5.0f;
+		return nearestDistance <= (float)KEYFRAME_PICK_DISTANCE;
 	}
 
 	/**
@@ -365,9 +383,9 @@ namespace bs
 		const Vector2I pixelCoords = curveToPixelSpace(Vector2(t, y));
 
 		if (selected)
-			drawDiamond(pixelCoords, 3, Color::White, Color::BansheeOrange);
+			drawDiamond(pixelCoords, KEYFRAME_DRAW_SIZE, Color::White, Color::BansheeOrange);
 		else
-			drawDiamond(pixelCoords, 3, Color::White, Color::Black);
+			drawDiamond(pixelCoords, KEYFRAME_DRAW_SIZE, Color::White, Color::Black);
 	}
 
 	void GUICurves::drawTangents(const TKeyframe<float>& keyFrame, TangentMode tangentMode)
@@ -391,40 +409,87 @@ namespace bs
 		}
 	}
 
-	void GUICurves::drawCurve(const TAnimationCurve<float>& curve, const Color& color)
+	void GUICurves::sampleCurve(const TAnimationCurve<float>& curve, Vector<Vector2I>& linePoints) const
 	{
-		const float range = getRangeWithPadding();
-		const float widthPerPixel = range / getDrawableWidth();
-		const float heightPerPixel = mYRange / mLayoutData.area.height;
+		linePoints.clear();
 
 		const Vector<TKeyframe<float>>& keyframes = curve.getKeyFrames();
-		if (keyframes.empty())
+		if (keyframes.size() < 2)
 			return;
 
-		// Draw start line
+		const auto addPoint = [&linePoints](const Vector2I& point)
 		{
-			const float curveStart = keyframes[0].time;
-			const float curveValue = curve.evaluate(curveStart, false);
+			if (linePoints.empty() || linePoints.back() != point)
+				linePoints.push_back(point);
+		};
+
+		// Points falling within the same pixel column are collapsed to the first, lowest, highest and last point in
+		// the column. This keeps the shape of the curve (including any spikes) while the number of output points stays
+		// proportional to the width of the element.
+		bool hasColumn = false;
+		Vector2I columnFirst;
+		Vector2I columnLast;
+		INT32 columnMinY = 0;
+		INT32 columnMaxY = 0;
+
+		const auto flushColumn = [&]()
+		{
+			if (!hasColumn)
+				return;
 
-			const Vector2I end = curveToPixelSpace(Vector2(curveStart, curveValue));
-			const Vector2I start = Vector2I(-(INT32)mPadding, end.y);
+			addPoint(columnFirst);
 
-			if (start.x < end.x)
-				mCanvas->drawLine(start, end, COLOR_MID_GRAY);
-		}
+			if (columnFirst.y <= columnLast.y)
+			{
+				addPoint(Vector2I(columnFirst.x, columnMinY));
+				addPoint(Vector2I(columnFirst.x, columnMaxY));
+			}
+			else
+			{
+				addPoint(Vector2I(columnFirst.x, columnMaxY));
+				addPoint(Vector2I(columnFirst.x, columnMinY));
+			}
 
-		Vector<Vector2I> linePoints;
+			addPoint(columnLast);
+			hasColumn = false;
+		};
+
+		const auto samplePoint = [&](const Vector2I& point)
+		{
+			if (hasColumn && point.x != columnFirst.x)
+				flushColumn();
+
+			if (!hasColumn)
+			{
+				columnFirst = point;
+				columnMinY = point.y;
+				columnMaxY = point.y;
+				hasColumn = true;
+			}
+			else
+			{
+				columnMinY = std::min(columnMinY, point.y);
+				columnMaxY = std::max(columnMaxY, point.y);
+			}
+
+			columnLast = point;
+		};
 
-		// Draw in between keyframes
 		const float startVisibleTime = mOffset;
-		const float endVisibleTime = startVisibleTime + range;
-		for (INT32 i = 0; i < (INT32)keyframes.size() - 1; i++)
+		const float endVisibleTime = startVisibleTime + getRangeWithPadding();
+
+		// Start from the segment containing the first visible time
+		UINT32 firstKeyIdx = findFirstKeyframe(keyframes, startVisibleTime);
+		if (firstKeyIdx > 0)
+			firstKeyIdx--;
+
+		for (UINT32 i = firstKeyIdx; i < (UINT32)keyframes.size() - 1; i++)
 		{
 			const float start = keyframes[i].time;
 			const float end = keyframes[i + 1].time;
 
-			if (end < startVisibleTime || start > endVisibleTime)
-				continue;
+			if (start > endVisibleTime)
+				break;
 
 			const bool isStep = keyframes[i].outTangent == std::numeric_limits<float>::infinity() ||
 				keyframes[i + 1].inTangent == std::numeric_limits<float>::infinity();
@@ -435,46 +500,66 @@ namespace bs
 				const float startValue = curve.evaluate(start, false);
 				const float endValue = curve.evaluate(end, false);
 
-				linePoints.push_back(curveToPixelSpace(Vector2(start, startValue)));
-				linePoints.push_back(curveToPixelSpace(Vector2(end, startValue)));
-				linePoints.push_back(curveToPixelSpace(Vector2(end, endValue)));
+				samplePoint(curveToPixelSpace(Vector2(start, startValue)));
+				samplePoint(curveToPixelSpace(Vector2(end, startValue)));
+				samplePoint(curveToPixelSpace(Vector2(end, endValue)));
 			}
 			else // Draw normally
 			{
 				const float startValue = keyframes[i].value;
 				const float endValue = keyframes[i + 1].value;
 
-				Vector2I startPixel = curveToPixelSpace(Vector2(start, startValue));
-				Vector2I endPixel = curveToPixelSpace(Vector2(end, endValue));
-
-				const UINT32 distance = startPixel.manhattanDist(endPixel);
+				const Vector2I startPixel = curveToPixelSpace(Vector2(start, startValue));
+				const Vector2I endPixel = curveToPixelSpace(Vector2(end, endValue));
 
-				INT32 numSplits;
-				float splitIncrement;
-				if (distance > 0)
+				// Segment fits within a single pixel column, there's no need to sample it
+				if (startPixel.x == endPixel.x)
 				{
-					const float fNumSplits = distance / (float)LINE_SPLIT_WIDTH;
-
-					numSplits = Math::ceilToInt(fNumSplits) + 1;
-					splitIncrement = (end - start) / (float)numSplits;
-				}
-				else
-				{
-					numSplits = 1;
-					splitIncrement = 0.0f;
+					samplePoint(startPixel);
+					samplePoint(endPixel);
+					continue;
 				}
 
-				for (int j = 0; j < numSplits; j++)
+				const UINT32 distance = startPixel.manhattanDist(endPixel);
+				const INT32 numSplits = Math::ceilToInt(distance / (float)LINE_SPLIT_WIDTH) + 1;
+				const float splitIncrement = (end - start) / (float)numSplits;
+
+				samplePoint(startPixel);
+				for (int j = 1; j < numSplits; j++)
 				{
 					const float t = std::min(start + j * splitIncrement, end);
 					const float value = curve.evaluate(t, false);
 
-					linePoints.push_back(curveToPixelSpace(Vector2(t, value)));
+					samplePoint(curveToPixelSpace(Vector2(t, value)));
 				}
+				samplePoint(endPixel);
 			}
 		}
 
-		mCanvas->drawPolyLine(linePoints, color);
+		flushColumn();
+	}
+
+	void GUICurves::drawCurve(const TAnimationCurve<float>& curve, const Vector<Vector2I>& linePoints, const Color& color)
+	{
+		const Vector<TKeyframe<float>>& keyframes = curve.getKeyFrames();
+		if (keyframes.empty())
+			return;
+
+		// Draw start line
+		{
+			const float curveStart = keyframes[0].time;
+			const float curveValue = curve.evaluate(curveStart, false);
+
+			const Vector2I end = curveToPixelSpace(Vector2(curveStart, curveValue));
+			const Vector2I start = Vector2I(-(INT32)mPadding, end.y);
+
+			if (start.x < end.x)
+				mCanvas->drawLine(start, end, COLOR_MID_GRAY);
+		}
+
+		// Draw in between keyframes
+		if (!linePoints.empty())
+			mCanvas->drawPolyLine(linePoints, color);
 
 		// Draw end line
 		{
@@ -797,20 +882,61 @@ namespace bs
 			curvesToDraw = 2;
 		}
 
+		// Re-sample the curves only if they changed, or if their mapping to pixels changed
+		const SampleParams sampleParams = getSampleParams();
+		if (mCurveSamplesDirty || sampleParams != mCurveSampleParams || mCurveSamples.size() != curvesToDraw)
+		{
+			mCurveSamples.resize(curvesToDraw);
+			for (UINT32 i = 0; i < curvesToDraw; i++)
+				sampleCurve(mCurves[i].curve, mCurveSamples[i]);
+
+			mCurveSampleParams = sampleParams;
+			mCurveSamplesDirty = false;
+		}
+
 		// Draw curves
 		const bool drawKeyframes = mDrawOptions.isSet(CurveDrawOption::DrawKeyframes);
+		const UINT32 drawableWidth = getDrawableWidth();
+		const float lengthPerPixel = drawableWidth > 0 ? getRange() / drawableWidth : 0.0f;
+		const float keyframeMargin = (mPadding + KEYFRAME_DRAW_SIZE) * lengthPerPixel;
+		const float keyframesStart = mOffset - keyframeMargin;
+		const float keyframesEnd = mOffset + getRange() + keyframeMargin;
+
 		for (UINT32 i = 0; i < curvesToDraw; i++)
 		{
-			drawCurve(mCurves[i].curve, mCurves[i].color);
+			drawCurve(mCurves[i].curve, mCurveSamples[i], mCurves[i].color);
 
 			// Draw keyframes
 			if (drawKeyframes)
 			{
-				const Vector<TKeyframe<float>> keyframes = mCurves[i].curve.getKeyFrames();
-				for (UINT32 j = 0; j < (UINT32)keyframes.size(); j++)
+				const Vector<TKeyframe<float>>& keyframes = mCurves[i].curve.getKeyFrames();
+
+				const UINT32 firstVisible = findFirstKeyframe(keyframes, keyframesStart);
+				UINT32 lastVisible = firstVisible;
+				while (lastVisible < (UINT32)keyframes.size() && keyframes[lastVisible].time <= keyframesEnd)
+					lastVisible++;
+
+				// When keyframes are packed too densely to be distinguished only the selected ones are drawn
+				const UINT32 numVisible = lastVisible - firstVisible;
+				if (numVisible * MIN_PIXELS_PER_KEYFRAME <= drawableWidth)
 				{
-					const bool selected = isSelected(i, j);
-					drawKeyframe(keyframes[j].time, keyframes[j].value, selected);
+					for (UINT32 j = firstVisible; j < lastVisible; j++)
+					{
+						const bool selected = isSelected(i, j);
+						drawKeyframe(keyframes[j].time, keyframes[j].value, selected);
+					}
+				}
+				else
+				{
+					for (auto& entry : mSelectedKeyframes)
+					{
+						const INT32 keyIdx = entry.keyframeRef.keyIdx;
+						if (entry.keyframeRef.curveIdx != (INT32)i || keyIdx < (INT32)firstVisible ||
+							keyIdx >= (INT32)lastVisible)
+							continue;
+
+						drawKeyframe(keyframes[keyIdx].time, keyframes[keyIdx].value, true);
+					}
 				}
 			}
 		}
@@ -822,11 +948,11 @@ namespace bs
 			if (keyframeRef.curveIdx < 0 || keyframeRef.curveIdx >= (INT32)mCurves.size())
 				continue;
 
-			TAnimationCurve<float> curve = mCurves[keyframeRef.curveIdx].curve;
+			const TAnimationCurve<float>& curve = mCurves[keyframeRef.curveIdx].curve;
 			if (keyframeRef.keyIdx < 0 || keyframeRef.keyIdx >= (INT32)curve.getNumKeyFrames())
 				continue;
 
-			const Vector<TKeyframe<float>> keyframes = mCurves[keyframeRef.curveIdx].curve.getKeyFrames();
+			const Vector<TKeyframe<float>>& keyframes = curve.getKeyFrames();
 			const TangentMode tangentMode = entry.tangentMode;
 
 			drawTangents(keyframes[keyframeRef.keyIdx], tangentMode);
@@ -839,6 +965,36 @@ namespace bs
 		GUIElement::updateRenderElementsInternal();
 	}
 
+	GUICurves::SampleParams GUICurves::getSampleParams() const
+	{
+		SampleParams params;
+		params.offset = mOffset;
+		params.range = getRange();
+		params.rangeWithPadding = getRangeWithPadding();
+		params.yOffset = mYOffset;
+		params.yRange = mYRange;
+		params.drawableWidth = getDrawableWidth();
+		params.width = mLayoutData.area.width;
+		params.height = mLayoutData.area.height;
+
+		return params;
+	}
+
+	bool GUICurves::SampleParams::operator== (const SampleParams& rhs) const
+	{
+		return offset == rhs.offset && range == rhs.range && rangeWithPadding == rhs.rangeWithPadding &&
+			yOffset == rhs.yOffset && yRange == rhs.yRange && drawableWidth == rhs.drawableWidth &&
+			width == rhs.width && height == rhs.height;
+	}
+
+	UINT32 GUICurves::findFirstKeyframe(const Vector<TKeyframe<float>>& keyframes, float time)
+	{
+		const auto iterFind = std::lower_bound(keyframes.begin(), keyframes.end(), time,
+			[](const TKeyframe<float>& keyframe, float value) { return keyframe.time < value; });
+
+		return (UINT32)(iterFind - keyframes.begin());
+	}
+
 	bool GUICurves::_mouseEvent(const GUIMouseEvent& ev)
 	{
 		if(ev.getType() == GUIMouseEventType::MouseUp)
@@ -271,13 +271,24 @@ namespace bs
 		 */
 		void drawTangents(const TKeyframe<float>& keyFrame, TangentMode tangentMode);
 
+		/**
+		 * Samples the curve within the currently set range and outputs a line that can be used for drawing it. Multiple
+		 * points falling within the same pixel column are collapsed into the minimum and maximum value in that column,
+		 * so the number of output points is proportional to the width of the element rather than the number of keyframes.
+		 *
+		 * @param[in]	curve		Curve to sample.
+		 * @param[out]	linePoints	Points of the line representing the curve, in pixels relative to this element.
+		 */
+		void sampleCurve(const TAnimationCurve<float>& curve, Vector<Vector2I>& linePoints) const;
+
 		/**
 		 * Draws the curve using the provided color.
 		 *
 		 * @param[in]	curve		Curve to draw within the currently set range.
+		 * @param[in]	linePoints	Line representing the curve within the currently set range, as output by sampleCurve().
 		 * @param[in]	color		Color to draw the curve with.	
 		 */
-		void drawCurve(const TAnimationCurve<float>& curve, const Color& color);
+		void drawCurve(const TAnimationCurve<float>& curve, const Vector<Vector2I>& linePoints, const Color& color);
 
 		/*
 		 * Draws the area between two curves using the provided color.
@@ -305,9 +316,38 @@ namespace bs
 			TangentMode tangentMode;
 		};
 
+		/** Contains all the parameters that determine how are curves mapped to pixels. */
+		struct SampleParams
+		{
+			float offset = 0.0f;
+			float range = 0.0f;
+			float rangeWithPadding = 0.0f;
+			float yOffset = 0.0f;
+			float yRange = 0.0f;
+			UINT32 drawableWidth = 0;
+			UINT32 width = 0;
+			UINT32 height = 0;
+
+			bool operator== (const SampleParams& rhs) const;
+			bool operator!= (const SampleParams& rhs) const { return !operator==(rhs); }
+		};
+
+		/** Returns the parameters that determine the current mapping of curves to pixels. */
+		SampleParams getSampleParams() const;
+
+		/**
+		 * Returns the index of the first keyframe whose time is equal to or larger than the provided time, or the number
+		 * of keyframes if no such keyframe exists.
+		 */
+		static UINT32 findFirstKeyframe(const Vector<TKeyframe<float>>& keyframes, float time);
+
 		Vector<CurveDrawInfo> mCurves;
 		Vector<SelectedKeyframe> mSelectedKeyframes;
 
+		Vector<Vector<Vector2I>> mCurveSamples;
+		SampleParams mCurveSampleParams;
+		bool mCurveSamplesDirty = true;
+
 		float mYRange = 20.0f;
 		float mYOffset = 0.0f;
 		CurveDrawOptions mDrawOptions;
@@ -9,9 +9,11 @@
 #include "UndoRedo/BsCmdDeleteSO.h"
 #include "UndoRedo/BsCmdCloneSO.h"
 #include "UndoRedo/BsCmdCreateSO.h"
+#include "Utility/BsEditorUtility.h"
 #include "GUI/BsDragAndDropManager.h"
 #include "GUI/BsGUIResourceTreeView.h"
 #include "GUI/BsGUIContextMenu.h"
+#include "Utility/BsEditorProfiler.h"
 
 namespace bs
 {
@@ -259,6 +261,8 @@ namespace bs
 
 	void GUISceneTreeView::updateTreeElementHierarchy()
 	{
+		BS_EDITOR_PROFILE_SCOPE("TreeView", "GUISceneTreeView::updateTreeElementHierarchy");
+
 		HSceneObject root = gSceneManager().getMainScene()->getRoot();
 		mRootElement.mSceneObject = root;
 		mRootElement.mId = root->getInstanceId();
@@ -349,6 +353,9 @@ namespace bs
 						sceneObjects.push_back(draggedSceneObjects->objects[i]);
 				}
 
+				// Children of dragged objects move along with their parents
+				EditorUtility::removeDescendants(sceneObjects);
+
 				CmdReparentSO::execute(sceneObjects, newParent);
 				onModified();
 			}
@@ -496,7 +503,7 @@ namespace bs
 			duplicateList.push_back(sceneElement->mSceneObject);
 		}
 
-		cleanDuplicates(duplicateList);
+		EditorUtility::removeDescendants(duplicateList);
 
 		if (duplicateList.size() == 0)
 			return;
@@ -507,19 +514,7 @@ namespace bs
 		else
 			message = "Duplicated " + toString((UINT32)duplicateList.size()) + " elements";
 
-		Vector<Transform> savedTransforms(duplicateList.size());
-		for(UINT32 i = 0; i < (UINT32)duplicateList.size(); i++)
-			savedTransforms[i] = duplicateList[i]->getTransform();
-
-		Vector<HSceneObject> clonedObjects = CmdCloneSO::execute(duplicateList, message);
-
-		for(UINT32 i = 0; i < (UINT32)clonedObjects.size(); i++)
-		{
-			const Transform& tfrm = savedTransforms[i];
-			clonedObjects[i]->setWorldPosition(tfrm.getPosition());
-			clonedObjects[i]->setWorldRotation(tfrm.getRotation());
-			clonedObjects[i]->setWorldScale(tfrm.getScale());
-		}
+		CmdCloneSO::execute(duplicateList, message, HSceneObject(), true);
 
 		onModified();
 	}
@@ -556,7 +551,7 @@ namespace bs
 
 	void GUISceneTreeView::paste()
 	{
-		cleanDuplicates(mCopyList);
+		EditorUtility::removeDescendants(mCopyList);
 
 		if (mCopyList.size() == 0)
 			return;
@@ -587,9 +582,7 @@ namespace bs
 			else
 				message = "Copied " + toString((UINT32)mCopyList.size()) + " elements";
 
-			Vector<HSceneObject> clones = CmdCloneSO::execute(mCopyList, message);
-			for (auto& clone : clones)
-				clone->setParent(parent);
+			CmdCloneSO::execute(mCopyList, message, parent, true);
 		}
 
 		onModified();
@@ -678,38 +671,6 @@ namespace bs
 		onModified();
 	}
 
-	void GUISceneTreeView::cleanDuplicates(Vector<HSceneObject>& objects)
-	{
-		auto isChildOf = [&](const HSceneObject& parent, const HSceneObject& child)
-		{
-			HSceneObject elem = child;
-
-			while (elem != nullptr && elem != parent)
-				elem = elem->getParent();
-
-			return elem == parent;
-		};
-
-		Vector<HSceneObject> cleanList;
-		for (UINT32 i = 0; i < (UINT32)objects.size(); i++)
-		{
-			bool foundParent = false;
-			for (UINT32 j = 0; j < (UINT32)objects.size(); j++)
-			{
-				if (i != j && isChildOf(objects[j], objects[i]))
-				{
-					foundParent = true;
-					break;
-				}
-			}
-
-			if (!foundParent)
-				cleanList.push_back(objects[i]);
-		}
-
-		objects = cleanList;
-	}
-
 	const String& GUISceneTreeView::getGUITypeName()
 	{
 		static String typeName = "SceneTreeView";
@@ -221,12 +221,6 @@ namespace bs
 			}
 		}
 
-		/**
-		 * Cleans duplicate objects from the provided scene object list. This involves removing child elements if their
-		 * parents are already part of the list.
-		 */
-		static void cleanDuplicates(Vector<HSceneObject>& objects);
-
 		SceneTreeElement mRootElement;
 
 		Vector<HSceneObject> mCopyList;
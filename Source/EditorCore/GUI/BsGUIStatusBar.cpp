@@ -166,21 +166,50 @@ namespace bs
 		mMessage->setStyle(getSubStyleName(getGUIMessageTypeName()));
 	}
 
+	void GUIStatusBar::update()
+	{
+		if (!mLogDirty)
+			return;
+
+		refreshMessage();
+		mLogDirty = false;
+	}
+
 	void GUIStatusBar::logModified()
+	{
+		// Many entries can be logged in a single frame, so only update the displayed message once per frame
+		mLogDirty = true;
+	}
+
+	void GUIStatusBar::refreshMessage()
 	{
 		LogEntry entry;
 		if(!gDebug().getLog().getLastEntry(entry))
 		{
-			GUIContent messageContent(HString(""));
-			mMessage->setContent(messageContent);
+			if (mHasMessage)
+			{
+				GUIContent messageContent(HString(""));
+				mMessage->setContent(messageContent);
+
+				mHasMessage = false;
+			}
 
 			return;
 		}
 
+		// Avoid touching the GUI if the last message didn't change, as changing the contents requires a layout update
+		size_t messageHash = bs_hash(entry.getMessage());
+		LogVerbosity verbosity = entry.getVerbosity();
+		if (mHasMessage && messageHash == mMessageHash && verbosity == mMessageVerbosity)
+			return;
+
+		mHasMessage = true;
+		mMessageHash = messageHash;
+		mMessageVerbosity = verbosity;
+
 		HSpriteTexture iconTexture;
 		Color textColor = COLOR_INFO;
 
-		LogVerbosity verbosity = entry.getVerbosity();
 		switch (verbosity)
 		{
 		case LogVerbosity::VeryVerbose:
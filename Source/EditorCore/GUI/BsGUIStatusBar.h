@@ -4,6 +4,7 @@
 
 #include "BsEditorPrerequisites.h"
 #include "GUI/BsGUIElementContainer.h"
+#include "Debug/BsLog.h"
 
 namespace bs
 {
@@ -71,6 +72,12 @@ namespace bs
 		 */
 		void setIsImporting(bool importing, float percentage);
 
+		/** 
+		 * Refreshes the displayed log message if the log was modified since the last call. Should be called once per
+		 * frame.
+		 */
+		void update();
+
 		/** @copydoc GUIElement::setTint */
 		void setTint(const Color& color) override;
 
@@ -90,6 +97,9 @@ namespace bs
 		/**	Triggered when the debug Log was modified. */
 		void logModified();
 
+		/** Updates the message display with the last entry in the log. */
+		void refreshMessage();
+
 		/**	Triggered when the user clicks on the message display. */
 		void messageBtnClicked();
 
@@ -113,6 +123,11 @@ namespace bs
 		GUIProgressBar* mImportProgressBar;
 		GUITexture* mBackground;
 
+		bool mLogDirty = false;
+		bool mHasMessage = false;
+		size_t mMessageHash = 0;
+		LogVerbosity mMessageVerbosity = LogVerbosity::Info;
+
 		HEvent mLogEntryAddedConn;
 		HEvent mMessageBtnPressedConn;
 	};
@@ -16,6 +16,7 @@
 #include "GUI/BsGUIScrollArea.h"
 #include "GUI/BsDragAndDropManager.h"
 #include "Utility/BsTime.h"
+#include "Utility/BsEditorProfiler.h"
 
 using namespace std::placeholders;
 
@@ -974,6 +975,8 @@ namespace bs
 
 	void GUITreeView::_updateLayoutInternal(const GUILayoutData& data)
 	{
+		BS_EDITOR_PROFILE_SCOPE("TreeView", "GUITreeView::updateLayout");
+
 		struct UpdateTreeElement
 		{
 			UpdateTreeElement(TreeElement* element, UINT32 indent)
@@ -0,0 +1,158 @@
+//********************************** Banshee Engine (www.banshee3d.com) **************************************************//
+//**************** Copyright (c) 2016 Marko Pintera (marko.pintera@gmail.com). All rights reserved. **********************//
+#include "GUI/BsGradientTextureCache.h"
+#include "Image/BsSpriteTexture.h"
+#include "Image/BsTexture.h"
+#include "Image/BsPixelData.h"
+
+namespace bs
+{
+	GradientTextureCache::Key::Key(const ColorGradient& gradient, UINT32 width, bool alpha)
+		:gradient(gradient), width(width), alpha(alpha)
+	{
+		bs_hash_combine(hash, width);
+		bs_hash_combine(hash, alpha);
+
+		UINT32 numKeys = gradient.getNumKeys();
+		for(UINT32 i = 0; i < numKeys; i++)
+		{
+			ColorGradientKey gradientKey = gradient.getKey(i);
+
+			bs_hash_combine(hash, gradientKey.time);
+			bs_hash_combine(hash, gradientKey.color.r);
+			bs_hash_combine(hash, gradientKey.color.g);
+			bs_hash_combine(hash, gradientKey.color.b);
+			bs_hash_combine(hash, gradientKey.color.a);
+		}
+	}
+
+	bool GradientTextureCache::Key::operator==(const Key& rhs) const
+	{
+		return hash == rhs.hash && width == rhs.width && alpha == rhs.alpha && gradient == rhs.gradient;
+	}
+
+	GradientTextureCache::GradientTextureCache(UINT32 budget)
+		:mBudget(budget)
+	{ }
+
+	HSpriteTexture GradientTextureCache::acquire(const Key& key)
+	{
+		auto iterFind = mEntries.find(key);
+		if(iterFind != mEntries.end())
+		{
+			Entry& entry = iterFind->second;
+			if(entry.refCount == 0)
+				mUnusedSize -= entry.size;
+
+			entry.refCount++;
+			return entry.texture;
+		}
+
+		Entry entry;
+		entry.texture = generate(key);
+		entry.refCount = 1;
+		entry.size = std::max(key.width, 1U) * 4;
+
+		mEntries[key] = entry;
+		return entry.texture;
+	}
+
+	void GradientTextureCache::release(const Key& key)
+	{
+		auto iterFind = mEntries.find(key);
+		if(iterFind == mEntries.end())
+			return;
+
+		Entry& entry = iterFind->second;
+		assert(entry.refCount > 0);
+
+		entry.refCount--;
+		if(entry.refCount == 0)
+		{
+			entry.releaseTime = mReleaseCounter++;
+			mUnusedSize += entry.size;
+
+			if(mUnusedSize > mBudget)
+				evict();
+		}
+	}
+
+	void GradientTextureCache::clearUnused()
+	{
+		for(auto iter = mEntries.begin(); iter != mEntries.end();)
+		{
+			if(iter->second.refCount == 0)
+			{
+				iter = mEntries.erase(iter);
+			}
+			else
+				++iter;
+		}
+
+		mUnusedSize = 0;
+	}
+
+	void GradientTextureCache::evict()
+	{
+		Vector<std::pair<UINT64, Key>> unused;
+		for(auto& entry : mEntries)
+		{
+			if(entry.second.refCount == 0)
+				unused.push_back(std::make_pair(entry.second.releaseTime, entry.first));
+		}
+
+		std::sort(unused.begin(), unused.end(), 
+			[](const std::pair<UINT64, Key>& a, const std::pair<UINT64, Key>& b)
+		{
+			return a.first < b.first;
+		});
+
+		// Evict down to half of the budget, so that eviction doesn't need to run on every following release
+		const UINT32 target = mBudget / 2;
+		for(auto& entry : unused)
+		{
+			if(mUnusedSize <= target)
+				break;
+
+			auto iterFind = mEntries.find(entry.second);
+
+			mUnusedSize -= iterFind->second.size;
+
+			// Note: Texture is destroyed once the last handle to it is released
+			mEntries.erase(iterFind);
+		}
+	}
+
+	HSpriteTexture GradientTextureCache::generate(const Key& key)
+	{
+		const UINT32 width = std::max(key.width, 1U);
+		SPtr<PixelData> pixelData = PixelData::create(width, 1, 1, PF_RGBA8);
+
+		evaluateRow(key.gradient, width, key.alpha, (UINT32*)pixelData->getData());
+		return SpriteTexture::create(Texture::create(pixelData));
+	}
+
+	void GradientTextureCache::evaluateRow(const ColorGradient& gradient, UINT32 width, bool alpha, UINT32* output)
+	{
+		// Note: Evaluated values are packed in the same byte order as PF_RGBA8 so they can be written out directly,
+		// avoiding the per-pixel conversion to and from floating point that PixelData::setColorAt would perform
+		const float invWidth = 1.0f / width;
+		const float halfPixel = 0.5f * invWidth;
+
+		if(alpha)
+		{
+			for (UINT32 i = 0; i < width; i++)
+			{
+				const RGBA value = gradient.evaluate(i * invWidth + halfPixel);
+				const UINT32 a = (value >> 24) & 0xFF;
+
+				output[i] = a | (a << 8) | (a << 16) | 0xFF000000;
+			}
+		}
+		else
+		{
+			for (UINT32 i = 0; i < width; i++)
+				output[i] = gradient.evaluate(i * invWidth + halfPixel) | 0xFF000000;
+		}
+	}
+}
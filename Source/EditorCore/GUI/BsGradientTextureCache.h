@@ -0,0 +1,99 @@
+//********************************** Banshee Engine (www.banshee3d.com) **************************************************//
+//**************** Copyright (c) 2016 Marko Pintera (marko.pintera@gmail.com). All rights reserved. **********************//
+#pragma once
+
+#include "BsEditorPrerequisites.h"
+#include "Utility/BsModule.h"
+#include "Image/BsColorGradient.h"
+
+namespace bs
+{
+	/** @addtogroup GUI-Editor-Internal
+	 *  @{
+	 */
+
+	/**
+	 * Keeps track of textures generated from color gradients, so that GUI elements displaying the same gradient at the
+	 * same size share a single texture, and textures don't need to be regenerated when the element is re-laid out.
+	 * Textures are reference counted. Unreferenced textures remain cached until their total size exceeds a budget, after
+	 * which the least recently released ones are destroyed.
+	 */
+	class BS_ED_EXPORT GradientTextureCache : public Module<GradientTextureCache>
+	{
+	public:
+		/** Identifies a single texture in the cache. */
+		struct Key
+		{
+			Key() = default;
+			Key(const ColorGradient& gradient, UINT32 width, bool alpha);
+
+			bool operator==(const Key& rhs) const;
+			bool operator!=(const Key& rhs) const { return !(*this == rhs); }
+
+			ColorGradient gradient;
+			UINT32 width = 0;
+			bool alpha = false;
+			size_t hash = 0;
+		};
+
+		/** 
+		 * @param[in]	budget	Maximum size, in bytes, of all the textures that are cached but not referenced by any GUI 
+		 *						element.
+		 */
+		GradientTextureCache(UINT32 budget = DEFAULT_BUDGET);
+
+		/**
+		 * Returns a texture representing the gradient with the specified key, generating it if not already cached.
+		 * Each call must be paired with a call to release() once the texture is no longer used.
+		 */
+		HSpriteTexture acquire(const Key& key);
+
+		/** Releases a reference to a texture previously returned by acquire(). */
+		void release(const Key& key);
+
+		/** Destroys all cached textures that are not currently referenced. */
+		void clearUnused();
+
+		/** 
+		 * Fills a single row of pixels by evaluating the gradient. 
+		 * 
+		 * @param[in]	gradient	Gradient to evaluate.
+		 * @param[in]	width		Number of pixels in the row.
+		 * @param[in]	alpha		If true the row will contain the alpha values of the gradient (grayscale), otherwise it 
+		 *							will contain the gradient color.
+		 * @param[out]	output		Pre-allocated buffer of @p width pixels, in RGBA8 format.
+		 */
+		static void evaluateRow(const ColorGradient& gradient, UINT32 width, bool alpha, UINT32* output);
+
+		static constexpr UINT32 DEFAULT_BUDGET = 1024 * 1024;
+
+	private:
+		/** Key hasher, to be used by the cache lookup map. */
+		struct KeyHash
+		{
+			size_t operator()(const Key& key) const { return key.hash; }
+		};
+
+		/** Information about a single cached texture. */
+		struct Entry
+		{
+			HSpriteTexture texture;
+			UINT32 refCount = 0;
+			UINT32 size = 0;
+			UINT64 releaseTime = 0;
+		};
+
+		/** Destroys least recently released textures until the unused textures fit the budget. */
+		void evict();
+
+		/** Generates a new texture for the gradient with the specified key. */
+		static HSpriteTexture generate(const Key& key);
+
+		UnorderedMap<Key, Entry, KeyHash> mEntries;
+		UINT32 mBudget;
+		UINT32 mUnusedSize = 0;
+		UINT64 mReleaseCounter = 0;
+	};
+
+	/** @} */
+}
@@ -14,6 +14,7 @@
 #include "Image/BsTexture.h"
 #include "Utility/BsTime.h"
 #include "RenderAPI/BsRenderAPI.h"
+#include "Utility/BsEditorProfiler.h"
 
 using namespace std::placeholders;
 
@@ -46,12 +47,14 @@ namespace bs
 	HandleDrawManager::~HandleDrawManager()
 	{
 		clearMeshes();
+		mMeshCache.clear();
 		bs_delete(mDrawHelper);
 	}
 
 	void HandleDrawManager::setColor(const Color& color)
 	{
 		mDrawHelper->setColor(color);
+		mMeshCache.record("color", color);
 	}
 
 	void HandleDrawManager::setTransform(const Matrix4& transform)
@@ -62,6 +65,7 @@ namespace bs
 	void HandleDrawManager::setLayer(UINT64 layer)
 	{
 		mDrawHelper->setLayer(layer);
+		mMeshCache.record("layer", layer);
 	}
 
 	void HandleDrawManager::drawCube(const Vector3& position, const Vector3& extents, float size)
@@ -70,6 +74,7 @@ namespace bs
 		mDrawHelper->setTransform(mTransform * scale);
 
 		mDrawHelper->cube(position, extents);
+		mMeshCache.record("cube", mTransform, size, position, extents);
 	}
 
 	void HandleDrawManager::drawSphere(const Vector3& position, float radius, float size)
@@ -78,6 +83,7 @@ namespace bs
 		mDrawHelper->setTransform(mTransform * scale);
 
 		mDrawHelper->sphere(position, radius);
+		mMeshCache.record("sphere", mTransform, size, position, radius);
 	}
 
 	void HandleDrawManager::drawWireCube(const Vector3& position, const Vector3& extents, float size)
@@ -86,6 +92,7 @@ namespace bs
 		mDrawHelper->setTransform(mTransform * scale);
 
 		mDrawHelper->wireCube(position, extents);
+		mMeshCache.record("wireCube", mTransform, size, position, extents);
 	}
 
 	void HandleDrawManager::drawWireSphere(const Vector3& position, float radius, float size)
@@ -94,6 +101,7 @@ namespace bs
 		mDrawHelper->setTransform(mTransform * scale);
 
 		mDrawHelper->wireSphere(position, radius);
+		mMeshCache.record("wireSphere", mTransform, size, position, radius);
 	}
 
 	void HandleDrawManager::drawCone(const Vector3& base, const Vector3& normal, float height, float radius, float size)
@@ -102,6 +110,7 @@ namespace bs
 
 		mDrawHelper->setTransform(mTransform * scale);
 		mDrawHelper->cone(base, normal, height, radius);
+		mMeshCache.record("cone", mTransform, size, base, normal, height, radius);
 	}
 
 	void HandleDrawManager::drawLine(const Vector3& start, const Vector3& end, float size)
@@ -110,6 +119,7 @@ namespace bs
 		mDrawHelper->setTransform(mTransform * scale);
 
 		mDrawHelper->line(start, end);
+		mMeshCache.record("line", mTransform, size, start, end);
 	}
 
 	void HandleDrawManager::drawDisc(const Vector3& position, const Vector3& normal, float radius, float size)
@@ -118,6 +128,7 @@ namespace bs
 		mDrawHelper->setTransform(mTransform * scale);
 
 		mDrawHelper->disc(position, normal, radius);
+		mMeshCache.record("disc", mTransform, size, position, normal, radius);
 	}
 
 	void HandleDrawManager::drawWireDisc(const Vector3& position, const Vector3& normal, float radius, float size)
@@ -126,6 +137,7 @@ namespace bs
 		mDrawHelper->setTransform(mTransform * scale);
 
 		mDrawHelper->wireDisc(position, normal, radius);
+		mMeshCache.record("wireDisc", mTransform, size, position, normal, radius);
 	}
 
 	void HandleDrawManager::drawArc(const Vector3& position, const Vector3& normal, float radius, Degree startAngle, Degree amountAngle, float size)
@@ -134,6 +146,7 @@ namespace bs
 		mDrawHelper->setTransform(mTransform * scale);
 
 		mDrawHelper->arc(position, normal, radius, startAngle, amountAngle);
+		mMeshCache.record("arc", mTransform, size, position, normal, radius, startAngle, amountAngle);
 	}
 
 	void HandleDrawManager::drawWireArc(const Vector3& position, const Vector3& normal, float radius, Degree startAngle, Degree amountAngle, float size)
@@ -142,6 +155,7 @@ namespace bs
 		mDrawHelper->setTransform(mTransform * scale);
 
 		mDrawHelper->wireArc(position, normal, radius, startAngle, amountAngle);
+		mMeshCache.record("wireArc", mTransform, size, position, normal, radius, startAngle, amountAngle);
 	}
 
 	void HandleDrawManager::drawRect(const Rect3& area, float size)
@@ -150,6 +164,7 @@ namespace bs
 		mDrawHelper->setTransform(mTransform * scale);
 
 		mDrawHelper->rectangle(area);
+		mMeshCache.record("rectangle", mTransform, size, area);
 	}
 
 	void HandleDrawManager::drawText(const Vector3& position, const String& text, const HFont& font, UINT32 fontSize)
@@ -161,10 +176,13 @@ namespace bs
 			myFont = BuiltinEditorResources::instance().getDefaultAAFont();
 
 		mDrawHelper->text(position, text, myFont, fontSize);
+		mMeshCache.record("text", mTransform, position, text, myFont, fontSize);
 	}
 
 	void HandleDrawManager::draw(const SPtr<Camera>& camera)
 	{
+		BS_EDITOR_PROFILE_SCOPE("Handles", "HandleDrawManager::draw");
+
 		ct::HandleRenderer* renderer = mRenderer.get();
 
 		// Clear meshes from previous frame
@@ -177,8 +195,9 @@ namespace bs
 			mLastFrameIdx = frameIdx;
 		}
 
+		// Meshes are only rebuilt if the handles or the camera changed since the last frame
 		const Vector<DrawHelper::ShapeMeshData>& meshes =
-			mDrawHelper->buildMeshes(DrawHelper::SortType::BackToFront, camera.get(), camera->getLayers());
+			mMeshCache.getMeshes(*mDrawHelper, DrawHelper::SortType::BackToFront, camera.get(), camera->getLayers());
 
 		mActiveMeshes.push_back(meshes);
 
@@ -212,6 +231,7 @@ namespace bs
 	void HandleDrawManager::clear()
 	{
 		mDrawHelper->clear();
+		mMeshCache.clearCommands();
 	}
 
 	void HandleDrawManager::clearMeshes()
@@ -251,6 +271,8 @@ namespace bs
 
 	void HandleRenderer::queueForDraw(const SPtr<Camera>& camera, Vector<MeshData>& meshes)
 	{
+		BS_EDITOR_PROFILE_SCOPE("Handles", "HandleRenderer::queueForDraw");
+
 		SPtr<Renderer> activeRenderer = RendererManager::instance().getActive();
 		if (camera != nullptr)
 		{
@@ -307,6 +329,7 @@ namespace bs
 	void HandleRenderer::render(const Camera& camera)
 	{
 		THROW_IF_NOT_CORE_THREAD;
+		BS_EDITOR_PROFILE_SCOPE("Handles", "HandleRenderer::render");
 
 		for (auto& entry : mQueuedData)
 		{
@@ -7,6 +7,7 @@
 #include "RenderAPI/BsGpuParams.h"
 #include "Utility/BsDrawHelper.h"
 #include "Renderer/BsParamBlocks.h"
+#include "Utility/BsDrawMeshCache.h"
 
 namespace bs
 {
@@ -179,6 +180,7 @@ namespace bs
 		Matrix4 mTransform;
 		SPtr<ct::HandleRenderer> mRenderer;
 		DrawHelper* mDrawHelper;
+		DrawMeshCache mMeshCache;
 	};
 
 	/** @} */
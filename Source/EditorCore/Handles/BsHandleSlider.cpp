@@ -3,13 +3,16 @@
 #include "Handles/BsHandleSlider.h"
 #include "Components/BsCCamera.h"
 #include "Handles/BsHandleManager.h"
+#include "Handles/BsHandleSliderManager.h"
+#include "Math/BsSphere.h"
+#include "Math/BsRect2I.h"
 #include "Debug/BsDebug.h"
 
 namespace bs
 {
 	HandleSlider::HandleSlider(bool fixedScale, UINT64 layer)
 		: mFixedScale(fixedScale), mLayer(layer), mPosition(BsZero), mRotation(BsZero), mScale(Vector3::ONE)
-		, mDistanceScale(1.0f), mState(State::Inactive), mEnabled(true), mTransformDirty(true)
+		, mDistanceScale(1.0f), mState(State::Inactive), mEnabled(true), mManager(nullptr), mTransformDirty(true)
 	{
 
 	}
@@ -18,32 +21,96 @@ namespace bs
 	{
 		if (mFixedScale)
 		{
-			mDistanceScale = HandleManager::instance().getHandleSize(camera, mPosition);
-			mTransformDirty = true;
+			float distanceScale = HandleManager::instance().getHandleSize(camera, mPosition);
+			if (distanceScale != mDistanceScale)
+			{
+				mDistanceScale = distanceScale;
+				markDirty();
+			}
 		}
 	}
 
 	void HandleSlider::setPosition(const Vector3& position)
 	{
+		// Handles get re-positioned every frame, avoid invalidating cached bounds unless something actually moved
+		if (mPosition == position)
+			return;
+
 		mPosition = position;
-		mTransformDirty = true;
+		markDirty();
 	}
 
 	void HandleSlider::setRotation(const Quaternion& rotation)
 	{
+		if (mRotation == rotation)
+			return;
+
 		mRotation = rotation;
-		mTransformDirty = true;
+		markDirty();
 	}
 
 	void HandleSlider::setScale(const Vector3& scale)
 	{
+		if (mScale == scale)
+			return;
+
 		mScale = scale;
-		mTransformDirty = true;
+		markDirty();
 	}
 
 	void HandleSlider::setEnabled(bool enabled)
 	{
+		if (mEnabled == enabled)
+			return;
+
 		mEnabled = enabled;
+		markDirty();
+	}
+
+	bool HandleSlider::getScreenBounds(const SPtr<Camera>& camera, Rect2I& bounds) const
+	{
+		Sphere localBounds;
+		if (!getLocalBounds(localBounds))
+			return false;
+
+		const Matrix4& tfrm = getTransform();
+		Vector3 center = tfrm.multiplyAffine(localBounds.getCenter());
+
+		Vector3 scale = mScale;
+		if (mFixedScale)
+			scale *= mDistanceScale;
+
+		float radius = localBounds.getRadius() * std::max(Math::abs(scale.x), std::max(Math::abs(scale.y), 
+			Math::abs(scale.z)));
+
+		// Project the corners of the box enclosing the sphere, which gives us conservative bounds regardless of 
+		// projection type
+		INT32 minX = std::numeric_limits<INT32>::max();
+		INT32 minY = std::numeric_limits<INT32>::max();
+		INT32 maxX = std::numeric_limits<INT32>::min();
+		INT32 maxY = std::numeric_limits<INT32>::min();
+
+		for (UINT32 i = 0; i < 8; i++)
+		{
+			Vector3 corner(
+				center.x + ((i & 1) ? radius : -radius),
+				center.y + ((i & 2) ? radius : -radius),
+				center.z + ((i & 4) ? radius : -radius));
+
+			Vector3 viewPoint = camera->worldToViewPoint(corner);
+			if (-viewPoint.z < camera->getNearClipDistance()) // Straddles the near plane, can't project reliably
+				return false;
+
+			Vector2I screenPoint = camera->viewToScreenPoint(viewPoint);
+			minX = std::min(minX, screenPoint.x);
+			minY = std::min(minY, screenPoint.y);
+			maxX = std::max(maxX, screenPoint.x);
+			maxY = std::max(maxY, screenPoint.y);
+		}
+
+		// Pad by a pixel to account for rounding during projection
+		bounds = Rect2I(minX - 1, minY - 1, (UINT32)(maxX - minX) + 3, (UINT32)(maxY - minY) + 3);
+		return true;
 	}
 
 	const Matrix4& HandleSlider::getTransform() const
@@ -78,6 +145,14 @@ namespace bs
 		mTransformDirty = false;
 	}
 
+	void HandleSlider::markDirty()
+	{
+		mTransformDirty = true;
+
+		if (mManager != nullptr)
+			mManager->_notifySliderModified();
+	}
+
 	void HandleSlider::setInactive() 
 	{ 
 		mState = State::Inactive; 
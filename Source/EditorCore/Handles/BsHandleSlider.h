@@ -50,6 +50,17 @@ namespace bs
 		 */
 		virtual bool intersects(const Vector2I& screenPos, const Ray& ray, float& t) const = 0;
 
+		/**
+		 * Calculates a screen space rectangle that fully encloses the slider geometry, as seen through the provided
+		 * camera. Used for quickly culling sliders that cannot be under the pointer before calling intersects().
+		 *
+		 * @param[in]	camera	Camera through which the slider is being viewed.
+		 * @param[out]	bounds	Conservative screen space bounds of the slider, in pixels.
+		 * @return				True if the bounds could be determined. If false the slider must always be tested using
+		 *						intersects().
+		 */
+		virtual bool getScreenBounds(const SPtr<Camera>& camera, Rect2I& bounds) const;
+
 		/**
 		 * Updates a slider that is currently active (being dragged).
 		 *
@@ -133,6 +144,18 @@ namespace bs
 		/**	Updates the internal transform from the stored position, rotation and scale values. */
 		void updateCachedTransform() const;
 
+		/**
+		 * Returns a sphere that fully encloses the slider geometry, in the slider's local space. Used for calculating the
+		 * screen space bounds of the slider.
+		 *
+		 * @param[out]	bounds	Bounding sphere in local space.
+		 * @return				True if the slider has local bounds, false otherwise.
+		 */
+		virtual bool getLocalBounds(Sphere& bounds) const { return false; }
+
+		/** Notifies the slider manager that the slider transform, shape or enabled state changed. */
+		void markDirty();
+
 		/**
 		 * Calculates amount of movement along the provided ray depending on pointer movement.
 		 *
@@ -159,6 +182,8 @@ namespace bs
 		State mState;
 		bool mEnabled;
 
+		HandleSliderManager* mManager;
+
 		mutable bool mTransformDirty;
 		mutable Matrix4 mTransform;
 		mutable Matrix4 mTransformInv;
@@ -31,6 +31,14 @@ namespace bs
 		return currentArea.contains(screenPos);
 	}
 
+	bool HandleSlider2D::getScreenBounds(const SPtr<Camera>& camera, Rect2I& bounds) const
+	{
+		Vector2I center((INT32)mPosition.x, (INT32)mPosition.y);
+
+		bounds = Rect2I(center.x - mWidth / 2, center.y - mHeight, mWidth, mHeight);
+		return true;
+	}
+
 	void HandleSlider2D::handleInput(const SPtr<Camera>& camera, const Vector2I& inputDelta)
 	{
 		assert(getState() == State::Active);
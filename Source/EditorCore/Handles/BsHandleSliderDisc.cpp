@@ -6,6 +6,7 @@
 #include "Math/BsRay.h"
 #include "Math/BsVector3.h"
 #include "Math/BsQuaternion.h"
+#include "Math/BsSphere.h"
 #include "Components/BsCCamera.h"
 
 namespace bs
@@ -32,6 +33,9 @@ namespace bs
 	{
 		mHasCutoffPlane = enabled;
 
+		// Cutoff plane changes which rays intersect the slider, so any cached hover results are no longer valid
+		markDirty();
+
 		if (mHasCutoffPlane)
 		{
 			Vector3 up = mNormal;
@@ -71,6 +75,12 @@ namespace bs
 		return false;
 	}
 
+	bool HandleSliderDisc::getLocalBounds(Sphere& bounds) const
+	{
+		bounds = Sphere(Vector3::ZERO, mRadius + TORUS_RADIUS);
+		return true;
+	}
+
 	Vector3 HandleSliderDisc::calculateClosestPointOnArc(const Ray& inputRay, const Vector3& center, const Vector3& up,
 		float radius, Degree startAngle, Degree angleAmount)
 	{
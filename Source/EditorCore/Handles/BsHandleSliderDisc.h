@@ -65,6 +65,9 @@ namespace bs
 		/** @copydoc HandleSlider::reset */
 		void reset() override { mDelta = 0.0f; }
 
+		/** @copydoc HandleSlider::getLocalBounds */
+		bool getLocalBounds(Sphere& bounds) const override;
+
 		/**
 		 * Calculates the closest point on an arc from a ray.
 		 *
@@ -72,6 +72,14 @@ namespace bs
 		return gotIntersect;
 	}
 
+	bool HandleSliderLine::getLocalBounds(Sphere& bounds) const
+	{
+		float halfLength = mLength * 0.5f;
+		bounds = Sphere(mDirection * halfLength, halfLength + std::max(SPHERE_RADIUS, CAPSULE_RADIUS));
+
+		return true;
+	}
+
 	void HandleSliderLine::handleInput(const SPtr<Camera>& camera, const Vector2I& inputDelta)
 	{
 		assert(getState() == State::Active);
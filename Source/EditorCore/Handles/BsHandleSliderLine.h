@@ -51,6 +51,9 @@ namespace bs
 		/** @copydoc HandleSlider::reset */
 		void reset() override { mDelta = 0.0f; }
 
+		/** @copydoc HandleSlider::getLocalBounds */
+		bool getLocalBounds(Sphere& bounds) const override;
+
 		static const float CAPSULE_RADIUS;
 		static const float SPHERE_RADIUS;
 
@@ -4,6 +4,7 @@
 #include "Utility/BsBuiltinEditorResources.h"
 #include "Components/BsCCamera.h"
 #include "Handles/BsHandleSlider.h"
+#include "RenderAPI/BsViewport.h"
 
 using namespace std::placeholders;
 
@@ -29,7 +30,7 @@ namespace bs
 		}
 		else
 		{
-			HandleSlider* newHoverSlider = findUnderCursor(camera, inputPos);
+			HandleSlider* newHoverSlider = findUnderCursor(camera, state, inputPos);
 
 			if (newHoverSlider != state.hoverSlider)
 			{
@@ -50,9 +51,9 @@ namespace bs
 
 	void HandleSliderManager::trySelect(const SPtr<Camera>& camera, const Vector2I& inputPos)
 	{
-		HandleSlider* newActiveSlider = findUnderCursor(camera, inputPos);
-
 		StatePerCamera& state = mStates[camera->getInternalID()];
+		HandleSlider* newActiveSlider = findUnderCursor(camera, state, inputPos);
+
 		if (state.hoverSlider != nullptr)
 		{
 			state.hoverSlider->setInactive();
@@ -94,22 +95,24 @@ namespace bs
 		}
 	}
 
-	HandleSlider* HandleSliderManager::findUnderCursor(const SPtr<Camera>& camera, const Vector2I& inputPos) const
+	HandleSlider* HandleSliderManager::findUnderCursor(const SPtr<Camera>& camera, StatePerCamera& state, 
+		const Vector2I& inputPos)
 	{
+		updateBroadPhase(camera, state);
+
+		// Nothing changed since the last query, the result is still valid
+		if (state.hoverCached && state.hoverInputPos == inputPos)
+			return state.hoverResult;
+
 		Ray inputRay = camera->screenPointToRay(inputPos);
 
 		float nearestT = std::numeric_limits<float>::max();
 		HandleSlider* overSlider = nullptr;
-		
-		for (auto& slider : mSliders)
-		{
-			if (!slider->getEnabled())
-				continue;
-
-			bool layerMatches = (camera->getLayers() & slider->getLayer()) != 0;
 
+		auto testSlider = [&](HandleSlider* slider)
+		{
 			float t;
-			if (layerMatches && slider->intersects(inputPos, inputRay, t))
+			if (slider->intersects(inputPos, inputRay, t))
 			{
 				if (t < nearestT)
 				{
@@ -117,19 +120,138 @@ namespace bs
 					nearestT = t;
 				}
 			}
+		};
+
+		for (auto& slider : state.unboundedSliders)
+			testSlider(slider);
+
+		const Rect2I& area = state.viewportArea;
+		if (state.gridWidth > 0 && state.gridHeight > 0 && area.contains(inputPos))
+		{
+			UINT32 cellX = std::min((UINT32)(inputPos.x - area.x) / GRID_CELL_SIZE, state.gridWidth - 1);
+			UINT32 cellY = std::min((UINT32)(inputPos.y - area.y) / GRID_CELL_SIZE, state.gridHeight - 1);
+			UINT32 cellIdx = cellY * state.gridWidth + cellX;
+
+			for (UINT32 i = state.cellOffsets[cellIdx]; i < state.cellOffsets[cellIdx + 1]; i++)
+			{
+				const BroadPhaseEntry& entry = state.cellSliders[i];
+				if (entry.bounds.contains(inputPos))
+					testSlider(entry.slider);
+			}
 		}
 
+		state.hoverCached = true;
+		state.hoverInputPos = inputPos;
+		state.hoverResult = overSlider;
+
 		return overSlider;
 	}
 
+	void HandleSliderManager::updateBroadPhase(const SPtr<Camera>& camera, StatePerCamera& state)
+	{
+		Rect2I viewportArea = camera->getViewport()->getPixelArea();
+		Matrix4 viewProj = camera->getProjectionMatrixRS() * camera->getViewMatrix();
+		UINT64 layers = camera->getLayers();
+
+		if (state.sliderVersion == mSliderVersion && state.layers == layers && state.viewportArea == viewportArea &&
+			state.viewProj == viewProj)
+		{
+			return;
+		}
+
+		state.sliderVersion = mSliderVersion;
+		state.layers = layers;
+		state.viewportArea = viewportArea;
+		state.viewProj = viewProj;
+		state.hoverCached = false;
+		state.unboundedSliders.clear();
+
+		state.gridWidth = (viewportArea.width + GRID_CELL_SIZE - 1) / GRID_CELL_SIZE;
+		state.gridHeight = (viewportArea.height + GRID_CELL_SIZE - 1) / GRID_CELL_SIZE;
+
+		// Find screen space bounds of all sliders that can be interacted with through this camera
+		mTempBounds.clear();
+		for (auto& slider : mSliders)
+		{
+			if (!slider->getEnabled())
+				continue;
+
+			bool layerMatches = (layers & slider->getLayer()) != 0;
+			if (!layerMatches)
+				continue;
+
+			Rect2I bounds;
+			if (!slider->getScreenBounds(camera, bounds))
+			{
+				state.unboundedSliders.push_back(slider);
+				continue;
+			}
+
+			// Clip to viewport, and ignore sliders that are off-screen
+			INT32 left = std::max(bounds.x, viewportArea.x);
+			INT32 top = std::max(bounds.y, viewportArea.y);
+			INT32 right = std::min(bounds.x + (INT32)bounds.width, viewportArea.x + (INT32)viewportArea.width);
+			INT32 bottom = std::min(bounds.y + (INT32)bounds.height, viewportArea.y + (INT32)viewportArea.height);
+
+			if (left >= right || top >= bottom)
+				continue;
+
+			mTempBounds.push_back({ slider, Rect2I(left, top, (UINT32)(right - left), (UINT32)(bottom - top)) });
+		}
+
+		// Bin the sliders into grid cells. Done in two passes so all sliders can be stored in a single contiguous array.
+		UINT32 numCells = state.gridWidth * state.gridHeight;
+		state.cellOffsets.assign(numCells + 1, 0);
+
+		auto getCellRange = [&](const Rect2I& bounds, UINT32& x0, UINT32& y0, UINT32& x1, UINT32& y1)
+		{
+			x0 = (UINT32)(bounds.x - viewportArea.x) / GRID_CELL_SIZE;
+			y0 = (UINT32)(bounds.y - viewportArea.y) / GRID_CELL_SIZE;
+			x1 = std::min((UINT32)(bounds.x + bounds.width - 1 - viewportArea.x) / GRID_CELL_SIZE, state.gridWidth - 1);
+			y1 = std::min((UINT32)(bounds.y + bounds.height - 1 - viewportArea.y) / GRID_CELL_SIZE, state.gridHeight - 1);
+		};
+
+		for (auto& entry : mTempBounds)
+		{
+			UINT32 x0, y0, x1, y1;
+			getCellRange(entry.bounds, x0, y0, x1, y1);
+
+			for (UINT32 y = y0; y <= y1; y++)
+				for (UINT32 x = x0; x <= x1; x++)
+					state.cellOffsets[y * state.gridWidth + x + 1]++;
+		}
+
+		for (UINT32 i = 0; i < numCells; i++)
+			state.cellOffsets[i + 1] += state.cellOffsets[i];
+
+		state.cellSliders.resize(state.cellOffsets[numCells]);
+		mTempCellCursors.assign(state.cellOffsets.begin(), state.cellOffsets.end() - 1);
+
+		for (auto& entry : mTempBounds)
+		{
+			UINT32 x0, y0, x1, y1;
+			getCellRange(entry.bounds, x0, y0, x1, y1);
+
+			for (UINT32 y = y0; y <= y1; y++)
+				for (UINT32 x = x0; x <= x1; x++)
+					state.cellSliders[mTempCellCursors[y * state.gridWidth + x]++] = entry;
+		}
+	}
+
 	void HandleSliderManager::_registerSlider(HandleSlider* slider)
 	{
 		mSliders.insert(slider);
+		slider->mManager = this;
+
+		mSliderVersion++;
 	}
 
 	void HandleSliderManager::_unregisterSlider(HandleSlider* slider)
 	{
 		mSliders.erase(slider);
+		slider->mManager = nullptr;
+
+		mSliderVersion++;
 
 		for(auto& entry : mStates)
 		{
@@ -138,6 +260,12 @@ namespace bs
 
 			if (entry.second.hoverSlider == slider)
 				entry.second.hoverSlider = nullptr;
+
+			// Broad phase will get rebuilt on next query, but make sure not to leave dangling pointers in the meantime
+			if (entry.second.hoverResult == slider)
+				entry.second.hoverResult = nullptr;
+
+			entry.second.hoverCached = false;
 		}
 	}
-}
\ No newline at end of file
+}
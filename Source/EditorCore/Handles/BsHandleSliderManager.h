@@ -3,6 +3,9 @@
 #pragma once
 
 #include "BsEditorPrerequisites.h"
+#include "Math/BsMatrix4.h"
+#include "Math/BsRect2I.h"
+#include "Math/BsVector2I.h"
 
 namespace bs
 {
@@ -13,13 +16,60 @@ namespace bs
 	/** Controls all instantiated HandleSlider%s. */
 	class BS_ED_EXPORT HandleSliderManager
 	{
+		/** Slider and its screen space bounds, as stored in the broad phase grid. */
+		struct BroadPhaseEntry
+		{
+			HandleSlider* slider;
+			Rect2I bounds;
+		};
+
 		/** Contains active/hover sliders for each camera. */
 		struct StatePerCamera
 		{
 			HandleSlider* activeSlider = nullptr;
 			HandleSlider* hoverSlider = nullptr;
+
+			/** Version of the slider set the broad phase was built for. */
+			UINT64 sliderVersion = (UINT64)-1;
+
+			/** Camera layers the broad phase was built for. */
+			UINT64 layers = 0;
+
+			/** Camera view-projection transform the broad phase was built for. */
+			Matrix4 viewProj = Matrix4::ZERO;
+
+			/** Camera viewport area the broad phase was built for. */
+			Rect2I viewportArea;
+
+			/** Number of cells in the broad phase grid, along X and Y. */
+			UINT32 gridWidth = 0;
+			UINT32 gridHeight = 0;
+
+			/** 
+			 * Offsets into @p cellSliders for each grid cell. Sliders of cell N are in range [cellOffsets[N], 
+			 * cellOffsets[N + 1]).
+			 */
+			Vector<UINT32> cellOffsets;
+
+			/** Sliders overlapping each of the grid cells, laid out sequentially per cell. */
+			Vector<BroadPhaseEntry> cellSliders;
+
+			/** Enabled sliders with unknown screen bounds, that must always be tested. */
+			Vector<HandleSlider*> unboundedSliders;
+
+			/** True if the last hover query result is still valid. */
+			bool hoverCached = false;
+
+			/** Pointer position of the last hover query. */
+			Vector2I hoverInputPos;
+
+			/** Result of the last hover query. */
+			HandleSlider* hoverResult = nullptr;
 		};
 
+		/** Size of a single broad phase grid cell, in pixels. */
+		static constexpr UINT32 GRID_CELL_SIZE = 64;
+
 	public:
 		/**
 		 * Updates all underlying sliders, changing their state and dragging them depending on their state and pointer 
@@ -51,19 +101,37 @@ namespace bs
 		/**	Unregisters a previously instantiated slider. */
 		void _unregisterSlider(HandleSlider* slider);
 
+		/** 
+		 * Notifies the manager that transform or enabled state of one of the sliders changed, invalidating any cached 
+		 * bounds and hover results.
+		 */
+		void _notifySliderModified() { mSliderVersion++; }
+
 	private:
 
 		/**
-		 * Attempts to find slider at the specified position.
+		 * Attempts to find slider at the specified position. Results are cached until the pointer, camera or any of the
+		 * sliders change.
 		 *
 		 * @param[in]	camera		Camera through which we're interacting with sliders.
+		 * @param[in]	state		State for the provided camera.
 		 * @param[in]	inputPos	Position of the pointer.
 		 * @return					Slider if we're intersecting with one, or null otherwise.
 		 */
-		HandleSlider* findUnderCursor(const SPtr<Camera>& camera, const Vector2I& inputPos) const;
+		HandleSlider* findUnderCursor(const SPtr<Camera>& camera, StatePerCamera& state, const Vector2I& inputPos);
+
+		/** 
+		 * Rebuilds the screen space grid used for culling the sliders for the provided camera, if the camera or any of 
+		 * the sliders changed since it was last built.
+		 */
+		void updateBroadPhase(const SPtr<Camera>& camera, StatePerCamera& state);
 
 		UnorderedMap<UINT64, StatePerCamera> mStates;
 		UnorderedSet<HandleSlider*> mSliders;
+		UINT64 mSliderVersion = 0;
+
+		Vector<BroadPhaseEntry> mTempBounds;
+		Vector<UINT32> mTempCellCursors;
 	};
 
 	/** @} */
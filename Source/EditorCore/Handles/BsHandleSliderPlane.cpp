@@ -6,6 +6,7 @@
 #include "Math/BsVector3.h"
 #include "Math/BsRay.h"
 #include "Math/BsPlane.h"
+#include "Math/BsSphere.h"
 #include "Renderer/BsCamera.h"
 
 namespace bs
@@ -48,6 +49,13 @@ namespace bs
 		return false;
 	}
 
+	bool HandleSliderPlane::getLocalBounds(Sphere& bounds) const
+	{
+		// Half-diagonal of the square collider
+		bounds = Sphere(mCollider.getCenter(), mLength * 0.5f * Math::sqrt(2.0f));
+		return true;
+	}
+
 	void HandleSliderPlane::activate(const SPtr<Camera>& camera, const Vector2I& pointerPos)
 	{
 		mStartPlanePosition = getPosition();
@@ -54,6 +54,9 @@ namespace bs
 		/** @copydoc HandleSlider::reset */
 		void reset() override { mDelta = Vector2::ZERO; }
 
+		/** @copydoc HandleSlider::getLocalBounds */
+		bool getLocalBounds(Sphere& bounds) const override;
+
 		/**
 		 * Returns the position on plane based on pointer position.
 		 *
@@ -0,0 +1,285 @@
+//********************************** Banshee Engine (www.banshee3d.com) **************************************************//
+//**************** Copyright (c) 2019 Marko Pintera (marko.pintera@gmail.com). All rights reserved. **********************//
+#include "Handles/BsHandleSliderPointSet.h"
+#include "Handles/BsHandleManager.h"
+#include "Handles/BsHandleSliderManager.h"
+#include "Math/BsSphere.h"
+#include "Math/BsRay.h"
+
+namespace bs
+{
+	/**
+	 * Finds the nearest non-negative position along the ray at which it intersects the provided sphere. Ray direction
+	 * doesn't need to be normalized.
+	 */
+	static bool intersectSphere(const Vector3& origin, const Vector3& dir, const Vector3& center, float radius, float& t)
+	{
+		const Vector3 diff = origin - center;
+
+		const float a = dir.dot(dir);
+		const float b = 2.0f * diff.dot(dir);
+		const float c = diff.dot(diff) - radius * radius;
+
+		const float discriminant = b * b - 4.0f * a * c;
+		if (discriminant < 0.0f || a <= 0.0f)
+			return false;
+
+		const float root = std::sqrt(discriminant);
+		const float t0 = (-b - root) / (2.0f * a);
+		const float t1 = (-b + root) / (2.0f * a);
+
+		if (t1 < 0.0f)
+			return false;
+
+		t = t0 >= 0.0f ? t0 : t1;
+		return true;
+	}
+
+	HandleSliderPointSet::HandleSliderPointSet(float radius, bool fixedScale, UINT64 layer)
+		: HandleSlider(fixedScale, layer), mRadius(radius)
+	{
+		HandleSliderManager& sliderManager = HandleManager::instance().getSliderManager();
+		sliderManager._registerSlider(this);
+	}
+
+	HandleSliderPointSet::~HandleSliderPointSet()
+	{
+		HandleSliderManager& sliderManager = HandleManager::instance().getSliderManager();
+		sliderManager._unregisterSlider(this);
+	}
+
+	void HandleSliderPointSet::setPoints(const Vector3* points, UINT32 numPoints)
+	{
+		if (numPoints == (UINT32)mPoints.size() && std::equal(mPoints.begin(), mPoints.end(), points))
+			return;
+
+		mPoints.assign(points, points + numPoints);
+		buildGrid();
+
+		if (mIntersectedPoint >= numPoints)
+			mIntersectedPoint = NO_POINT;
+
+		if (mActivePoint >= numPoints)
+			mActivePoint = NO_POINT;
+
+		// Bounds changed
+		markDirty();
+	}
+
+	void HandleSliderPointSet::buildGrid()
+	{
+		mCellOffsets.clear();
+		mCellPoints.clear();
+
+		if (mPoints.empty())
+		{
+			mGridSize[0] = mGridSize[1] = mGridSize[2] = 0;
+			return;
+		}
+
+		Vector3 min = mPoints[0];
+		Vector3 max = mPoints[0];
+		for (auto& point : mPoints)
+		{
+			min.min(point);
+			max.max(point);
+		}
+
+		const Vector3 radius(mRadius, mRadius, mRadius);
+		mBounds = AABox(min - radius, max + radius);
+
+		// Aim for roughly one point per cell, but don't make cells smaller than a single collider
+		const Vector3 extents = mBounds.getMax() - mBounds.getMin();
+		const float minCellSize = std::max(mRadius * 2.0f, 0.0001f);
+		const float volume = std::max(extents.x, minCellSize) * std::max(extents.y, minCellSize) *
+			std::max(extents.z, minCellSize);
+		const float cellSize = std::max(minCellSize, std::cbrt(volume / mPoints.size()));
+
+		UINT32 numCells = 1;
+		for (UINT32 i = 0; i < 3; i++)
+		{
+			mGridSize[i] = (UINT32)Math::clamp(Math::ceilToInt(extents[i] / cellSize), 1, (INT32)MAX_GRID_CELLS_PER_AXIS);
+			mCellSize[i] = std::max(extents[i] / mGridSize[i], minCellSize);
+			numCells *= mGridSize[i];
+		}
+
+		// Each point is added to every cell its collider overlaps, so a ray only needs to test the cells it passes through
+		auto forEachCell = [this](const Vector3& point, auto callback)
+		{
+			UINT32 cellMin[3];
+			UINT32 cellMax[3];
+			for (UINT32 i = 0; i < 3; i++)
+			{
+				const float localMin = point[i] - mRadius - mBounds.getMin()[i];
+				const float localMax = point[i] + mRadius - mBounds.getMin()[i];
+
+				cellMin[i] = (UINT32)Math::clamp(Math::floorToInt(localMin / mCellSize[i]), 0, (INT32)mGridSize[i] - 1);
+				cellMax[i] = (UINT32)Math::clamp(Math::floorToInt(localMax / mCellSize[i]), 0, (INT32)mGridSize[i] - 1);
+			}
+
+			for (UINT32 z = cellMin[2]; z <= cellMax[2]; z++)
+				for (UINT32 y = cellMin[1]; y <= cellMax[1]; y++)
+					for (UINT32 x = cellMin[0]; x <= cellMax[0]; x++)
+						callback((z * mGridSize[1] + y) * mGridSize[0] + x);
+		};
+
+		mCellOffsets.resize(numCells + 1, 0);
+		for (auto& point : mPoints)
+			forEachCell(point, [this](UINT32 cell) { mCellOffsets[cell + 1]++; });
+
+		for (UINT32 i = 0; i < numCells; i++)
+			mCellOffsets[i + 1] += mCellOffsets[i];
+
+		Vector<UINT32> cellCounts(numCells, 0);
+		mCellPoints.resize(mCellOffsets[numCells]);
+		for (UINT32 i = 0; i < (UINT32)mPoints.size(); i++)
+		{
+			forEachCell(mPoints[i], [this, i, &cellCounts](UINT32 cell)
+			{
+				mCellPoints[mCellOffsets[cell] + cellCounts[cell]++] = i;
+			});
+		}
+	}
+
+	UINT32 HandleSliderPointSet::findPoint(const Ray& ray, float& t) const
+	{
+		t = std::numeric_limits<float>::max();
+		if (mPoints.empty())
+			return NO_POINT;
+
+		Ray localRay = ray;
+		localRay.transformAffine(getTransformInv());
+
+		const Vector3& origin = localRay.getOrigin();
+		const Vector3& dir = localRay.getDirection();
+
+		// Find the range along the ray that is within the grid
+		float tEnter = 0.0f;
+		float tExit = std::numeric_limits<float>::max();
+		for (UINT32 i = 0; i < 3; i++)
+		{
+			if (Math::approxEquals(dir[i], 0.0f))
+			{
+				if (origin[i] < mBounds.getMin()[i] || origin[i] > mBounds.getMax()[i])
+					return NO_POINT;
+
+				continue;
+			}
+
+			float t0 = (mBounds.getMin()[i] - origin[i]) / dir[i];
+			float t1 = (mBounds.getMax()[i] - origin[i]) / dir[i];
+			if (t0 > t1)
+				std::swap(t0, t1);
+
+			tEnter = std::max(tEnter, t0);
+			tExit = std::min(tExit, t1);
+		}
+
+		if (tEnter > tExit)
+			return NO_POINT;
+
+		// Walk the cells along the ray, nearest first
+		const Vector3 start = origin + dir * tEnter;
+
+		INT32 cell[3];
+		INT32 step[3];
+		float tNext[3];
+		float tDelta[3];
+		for (UINT32 i = 0; i < 3; i++)
+		{
+			const float localStart = start[i] - mBounds.getMin()[i];
+			cell[i] = Math::clamp(Math::floorToInt(localStart / mCellSize[i]), 0, (INT32)mGridSize[i] - 1);
+
+			if (Math::approxEquals(dir[i], 0.0f))
+			{
+				step[i] = 0;
+				tNext[i] = std::numeric_limits<float>::max();
+				tDelta[i] = std::numeric_limits<float>::max();
+			}
+			else if (dir[i] > 0.0f)
+			{
+				step[i] = 1;
+				tNext[i] = tEnter + ((cell[i] + 1) * mCellSize[i] - localStart) / dir[i];
+				tDelta[i] = mCellSize[i] / dir[i];
+			}
+			else
+			{
+				step[i] = -1;
+				tNext[i] = tEnter + (cell[i] * mCellSize[i] - localStart) / dir[i];
+				tDelta[i] = -mCellSize[i] / dir[i];
+			}
+		}
+
+		UINT32 nearestPoint = NO_POINT;
+		float nearestT = std::numeric_limits<float>::max();
+		while (true)
+		{
+			const UINT32 cellIdx = (cell[2] * mGridSize[1] + cell[1]) * mGridSize[0] + cell[0];
+			for (UINT32 i = mCellOffsets[cellIdx]; i < mCellOffsets[cellIdx + 1]; i++)
+			{
+				const UINT32 pointIdx = mCellPoints[i];
+
+				float pointT;
+				if (intersectSphere(origin, dir, mPoints[pointIdx], mRadius, pointT) && pointT < nearestT)
+				{
+					nearestT = pointT;
+					nearestPoint = pointIdx;
+				}
+			}
+
+			UINT32 axis = 0;
+			if (tNext[1] < tNext[axis]) axis = 1;
+			if (tNext[2] < tNext[axis]) axis = 2;
+
+			// Any hit in a later cell would be further away than the one already found
+			if (nearestT <= tNext[axis] || tNext[axis] > tExit)
+				break;
+
+			cell[axis] += step[axis];
+			if (cell[axis] < 0 || cell[axis] >= (INT32)mGridSize[axis])
+				break;
+
+			tNext[axis] += tDelta[axis];
+		}
+
+		if (nearestPoint == NO_POINT)
+			return NO_POINT;
+
+		Vector3 intrPoint = localRay.getPoint(nearestT);
+		intrPoint = getTransform().multiplyAffine(intrPoint);
+		t = (intrPoint - ray.getOrigin()).length(); // Get distance in world space
+
+		return nearestPoint;
+	}
+
+	bool HandleSliderPointSet::intersects(const Vector2I& screenPos, const Ray& ray, float& t) const
+	{
+		mIntersectedPoint = findPoint(ray, t);
+		return mIntersectedPoint != NO_POINT;
+	}
+
+	void HandleSliderPointSet::activate(const SPtr<Camera>& camera, const Vector2I& pointerPos)
+	{
+		mActivePoint = mIntersectedPoint;
+	}
+
+	void HandleSliderPointSet::reset()
+	{
+		mActivePoint = NO_POINT;
+	}
+
+	bool HandleSliderPointSet::getLocalBounds(Sphere& bounds) const
+	{
+		if (mPoints.empty())
+			return false;
+
+		const Vector3 center = mBounds.getCenter();
+		bounds = Sphere(center, (mBounds.getMax() - center).length());
+		return true;
+	}
+
+	void HandleSliderPointSet::handleInput(const SPtr<Camera>& camera, const Vector2I& inputDelta)
+	{
+		// Do nothing
+	}
+}
@@ -0,0 +1,103 @@
+//********************************** Banshee Engine (www.banshee3d.com) **************************************************//
+//**************** Copyright (c) 2019 Marko Pintera (marko.pintera@gmail.com). All rights reserved. **********************//
+#pragma once
+
+#include "BsEditorPrerequisites.h"
+#include "Handles/BsHandleSlider.h"
+#include "Math/BsAABox.h"
+
+namespace bs
+{
+	/** @addtogroup Handles
+	 *  @{
+	 */
+
+	/**
+	 * Handle slider represented by a set of spheres of equal size, one at each of the provided points. Equivalent to
+	 * a HandleSliderSphere per point, but registered and tested as a single slider, making it suitable for handles with
+	 * thousands of points (e.g. light probe nodes, spline control points). The slider doesn't allow dragging, but reports
+	 * which of the points is hovered over or was selected.
+	 */
+	class BS_ED_EXPORT HandleSliderPointSet : public HandleSlider
+	{
+	public:
+		/** Value returned by getHoverPoint() and getActivePoint() if no point is hovered over or active. */
+		static constexpr UINT32 NO_POINT = (UINT32)-1;
+
+		/**
+		 * Constructs a new point set slider.
+		 *
+		 * @param[in]	radius		Radius of the collider sphere around each point.
+		 * @param[in]	fixedScale	If true the handle slider will always try to maintain the same visible area in the
+		 *							viewport regardless of distance from camera.
+		 * @param[in]	layer		Layer that allows filtering of which sliders are interacted with from a specific camera.
+		 */
+		HandleSliderPointSet(float radius, bool fixedScale, UINT64 layer);
+		~HandleSliderPointSet();
+
+		/**
+		 * Replaces the points of the slider. Points are relative to the slider transform. Does nothing if the points
+		 * are identical to the current ones.
+		 */
+		void setPoints(const Vector3* points, UINT32 numPoints);
+
+		/** Returns the number of points in the slider. */
+		UINT32 getNumPoints() const { return (UINT32)mPoints.size(); }
+
+		/** Returns the index of the point the pointer is hovering over, or NO_POINT if the slider isn't hovered over. */
+		UINT32 getHoverPoint() const { return mState == State::Hover ? mIntersectedPoint : NO_POINT; }
+
+		/** Returns the index of the point that was selected, or NO_POINT if the slider isn't active. */
+		UINT32 getActivePoint() const { return mState == State::Active ? mActivePoint : NO_POINT; }
+
+		/** @copydoc	HandleSlider::intersects */
+		bool intersects(const Vector2I& screenPos, const Ray& ray, float& t) const override;
+
+		/** @copydoc	HandleSlider::handleInput */
+		void handleInput(const SPtr<Camera>& camera, const Vector2I& inputDelta) override;
+
+		/**
+		 * Finds the point whose collider sphere is nearest along the ray.
+		 *
+		 * @param[in]	ray		Ray in world space.
+		 * @param[out]	t		Distance along the ray to the intersection, in world space. Only valid if a point was
+		 *						found.
+		 * @return				Index of the intersected point, or NO_POINT if the ray doesn't intersect any points.
+		 */
+		UINT32 findPoint(const Ray& ray, float& t) const;
+
+	protected:
+		/** @copydoc HandleSlider::activate */
+		void activate(const SPtr<Camera>& camera, const Vector2I& pointerPos) override;
+
+		/** @copydoc HandleSlider::reset */
+		void reset() override;
+
+		/** @copydoc HandleSlider::getLocalBounds */
+		bool getLocalBounds(Sphere& bounds) const override;
+
+		/** Bins the points into the uniform grid used for accelerating ray queries. */
+		void buildGrid();
+
+		/** Maximum number of grid cells along a single axis. */
+		static constexpr UINT32 MAX_GRID_CELLS_PER_AXIS = 64;
+
+		float mRadius;
+		Vector<Vector3> mPoints;
+
+		AABox mBounds;
+		Vector3 mCellSize;
+		UINT32 mGridSize[3] = { 0, 0, 0 };
+
+		/** Offsets into @p mCellPoints for each cell. Points of cell N are in range [mCellOffsets[N], mCellOffsets[N + 1]). */
+		Vector<UINT32> mCellOffsets;
+
+		/** Indices of points whose collider overlaps each of the cells, laid out sequentially per cell. */
+		Vector<UINT32> mCellPoints;
+
+		mutable UINT32 mIntersectedPoint = NO_POINT;
+		UINT32 mActivePoint = NO_POINT;
+	};
+
+	/** @} */
+}
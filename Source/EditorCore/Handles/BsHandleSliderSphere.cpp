@@ -44,6 +44,12 @@ namespace bs
 		return false;
 	}
 
+	bool HandleSliderSphere::getLocalBounds(Sphere& bounds) const
+	{
+		bounds = mSphereCollider;
+		return true;
+	}
+
 	void HandleSliderSphere::handleInput(const SPtr<Camera>& camera, const Vector2I& inputDelta)
 	{
 		// Do nothing
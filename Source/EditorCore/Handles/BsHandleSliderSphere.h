@@ -37,6 +37,9 @@ namespace bs
 		void handleInput(const SPtr<Camera>& camera, const Vector2I& inputDelta) override;
 
 	protected:
+		/** @copydoc HandleSlider::getLocalBounds */
+		bool getLocalBounds(Sphere& bounds) const override;
+
 		Sphere mSphereCollider;
 	};
 
@@ -0,0 +1,201 @@
+//********************************** Banshee Engine (www.banshee3d.com) **************************************************//
+//**************** Copyright (c) 2019 Marko Pintera (marko.pintera@gmail.com). All rights reserved. **********************//
+#include "Library/BsImportDependencyGraph.h"
+
+namespace bs
+{
+	void ImportDependencyGraph::setDependencies(const Path& dependant, const Vector<Path>& dependencies)
+	{
+		const NodeId dependantId = getOrCreateNode(dependant);
+		mNodes[dependantId].isFile = true;
+
+		removeDependencies(dependant);
+
+		for (auto& dependency : dependencies)
+		{
+			const NodeId dependencyId = getOrCreateNode(dependency);
+			if (dependencyId == dependantId)
+				continue;
+
+			// Note: Not using a reference to the node, as creating the node above can reallocate the array
+			if (mNodes[dependencyId].dependants.insert(dependantId).second)
+				mNodes[dependantId].dependencies.push_back(dependencyId);
+		}
+	}
+
+	void ImportDependencyGraph::removeDependencies(const Path& dependant)
+	{
+		const NodeId dependantId = findNode(dependant);
+		if (dependantId == INVALID_NODE)
+			return;
+
+		const Vector<NodeId> dependencies = std::move(mNodes[dependantId].dependencies);
+		mNodes[dependantId].dependencies.clear();
+
+		for (auto& dependencyId : dependencies)
+		{
+			mNodes[dependencyId].dependants.erase(dependantId);
+			releaseIfUnused(dependencyId);
+		}
+	}
+
+	void ImportDependencyGraph::removeFile(const Path& path)
+	{
+		const NodeId nodeId = findNode(path);
+		if (nodeId == INVALID_NODE)
+			return;
+
+		removeDependencies(path);
+
+		mNodes[nodeId].isFile = false;
+		releaseIfUnused(nodeId);
+	}
+
+	Vector<Path> ImportDependencyGraph::getDependants(const Path& path) const
+	{
+		Vector<Path> output;
+
+		const NodeId rootId = findNode(path);
+		if (rootId == INVALID_NODE)
+			return output;
+
+		// Find all nodes reachable from the root, and count how many of their dependencies are reachable as well
+		UnorderedMap<NodeId, UINT32> numPendingDependencies;
+		Vector<NodeId> reachable;
+
+		Stack<NodeId> todo;
+		todo.push(rootId);
+
+		while (!todo.empty())
+		{
+			const NodeId nodeId = todo.top();
+			todo.pop();
+
+			for (auto& dependantId : mNodes[nodeId].dependants)
+			{
+				if (dependantId == rootId)
+					continue;
+
+				auto iterFind = numPendingDependencies.find(dependantId);
+				if (iterFind == numPendingDependencies.end())
+				{
+					numPendingDependencies[dependantId] = 1;
+					reachable.push_back(dependantId);
+
+					todo.push(dependantId);
+				}
+				else
+					iterFind->second++;
+			}
+		}
+
+		// Output nodes once all of their reachable dependencies have been output (Kahn's algorithm)
+		output.reserve(reachable.size());
+
+		Vector<NodeId> ready;
+		const auto release = [&](NodeId nodeId)
+		{
+			for (auto& dependantId : mNodes[nodeId].dependants)
+			{
+				if (dependantId == rootId)
+					continue;
+
+				if (--numPendingDependencies[dependantId] == 0)
+					ready.push_back(dependantId);
+			}
+		};
+
+		release(rootId);
+
+		UnorderedSet<NodeId> visited;
+		while (!ready.empty())
+		{
+			const NodeId nodeId = ready.back();
+			ready.pop_back();
+
+			visited.insert(nodeId);
+			output.push_back(mNodes[nodeId].path);
+
+			release(nodeId);
+		}
+
+		// Nodes in a cycle never become ready, append them so they still get processed
+		for (auto& nodeId : reachable)
+		{
+			if (visited.find(nodeId) == visited.end())
+				output.push_back(mNodes[nodeId].path);
+		}
+
+		return output;
+	}
+
+	Vector<Path> ImportDependencyGraph::getDirectDependants(const Path& path) const
+	{
+		Vector<Path> output;
+
+		const NodeId nodeId = findNode(path);
+		if (nodeId == INVALID_NODE)
+			return output;
+
+		output.reserve(mNodes[nodeId].dependants.size());
+		for (auto& dependantId : mNodes[nodeId].dependants)
+			output.push_back(mNodes[dependantId].path);
+
+		return output;
+	}
+
+	ImportDependencyGraph::NodeId ImportDependencyGraph::findNode(const Path& path) const
+	{
+		auto iterFind = mNodeLookup.find(path);
+		if (iterFind == mNodeLookup.end())
+			return INVALID_NODE;
+
+		return iterFind->second;
+	}
+
+	void ImportDependencyGraph::clear()
+	{
+		mNodes.clear();
+		mFreeNodes.clear();
+		mNodeLookup.clear();
+	}
+
+	ImportDependencyGraph::NodeId ImportDependencyGraph::getOrCreateNode(const Path& path)
+	{
+		auto iterFind = mNodeLookup.find(path);
+		if (iterFind != mNodeLookup.end())
+			return iterFind->second;
+
+		Node node;
+		node.path = path;
+
+		NodeId nodeId;
+		if (!mFreeNodes.empty())
+		{
+			nodeId = mFreeNodes.back();
+			mFreeNodes.pop_back();
+
+			mNodes[nodeId] = std::move(node);
+		}
+		else
+		{
+			nodeId = (NodeId)mNodes.size();
+			mNodes.push_back(std::move(node));
+		}
+
+		mNodeLookup[path] = nodeId;
+		return nodeId;
+	}
+
+	void ImportDependencyGraph::releaseIfUnused(NodeId nodeId)
+	{
+		Node& node = mNodes[nodeId];
+		if (node.isFile || !node.dependants.empty() || !node.dependencies.empty())
+			return;
+
+		mNodeLookup.erase(node.path);
+		node = Node();
+
+		mFreeNodes.push_back(nodeId);
+	}
+}
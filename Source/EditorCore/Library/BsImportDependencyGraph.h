@@ -0,0 +1,88 @@
+//********************************** Banshee Engine (www.banshee3d.com) **************************************************//
+//**************** Copyright (c) 2019 Marko Pintera (marko.pintera@gmail.com). All rights reserved. **********************//
+#pragma once
+
+#include "BsEditorPrerequisites.h"
+
+namespace bs
+{
+	/** @addtogroup Library-Internal
+	 *  @{
+	 */
+
+	/**
+	 * Directed graph of import dependencies between files, where an edge from A to B means A needs to be reimported
+	 * when B changes (for example a shader and the include file it references). Each referenced path is assigned a
+	 * numeric identifier on first use, and edges are stored using those identifiers so that adding and removing
+	 * dependencies doesn't require any path comparisons or linear scans. Identifiers of paths that are no longer
+	 * referenced are released and reused.
+	 *
+	 * Files may reference paths that are not (yet) part of the library, for example an include that hasn't been
+	 * created yet, in which case the dependency starts applying once the file appears.
+	 */
+	class BS_ED_EXPORT ImportDependencyGraph
+	{
+	public:
+		/** Identifier of a single node in the graph. */
+		typedef UINT32 NodeId;
+
+		/** Identifier returned when a node for a path doesn't exist. */
+		static constexpr NodeId INVALID_NODE = (NodeId)-1;
+
+		/**
+		 * Replaces all the dependencies of the provided file with a new set of dependencies. Duplicate dependencies, and
+		 * dependencies of the file on itself, are ignored.
+		 */
+		void setDependencies(const Path& dependant, const Vector<Path>& dependencies);
+
+		/** Removes all the dependencies of the provided file. Files depending on it are unaffected. */
+		void removeDependencies(const Path& dependant);
+
+		/**
+		 * Removes a file that was deleted or moved, along with all of its dependencies. The node for the file is kept only
+		 * if other files still depend on it, so the dependency starts applying again if the file is re-created.
+		 */
+		void removeFile(const Path& path);
+
+		/**
+		 * Returns all the files that directly or indirectly depend on the provided file, in topological order. Each file
+		 * is listed after all the other returned files it depends on. Files that are part of a dependency cycle are
+		 * returned after all the others.
+		 */
+		Vector<Path> getDependants(const Path& path) const;
+
+		/** Returns the files that directly depend on the provided file, in no particular order. */
+		Vector<Path> getDirectDependants(const Path& path) const;
+
+		/** Returns the identifier of the node for the provided path, or INVALID_NODE if one doesn't exist. */
+		NodeId findNode(const Path& path) const;
+
+		/** Returns the path the provided node was created for. */
+		const Path& getPath(NodeId node) const { return mNodes[node].path; }
+
+		/** Removes all nodes and dependencies. */
+		void clear();
+
+	private:
+		/** A single file referenced by the graph. */
+		struct Node
+		{
+			Path path;
+			Vector<NodeId> dependencies;
+			UnorderedSet<NodeId> dependants;
+			bool isFile = false; /**< True if the dependencies of the node were set, false if it is only referenced. */
+		};
+
+		/** Returns the identifier of the node for the provided path, creating the node if it doesn't exist. */
+		NodeId getOrCreateNode(const Path& path);
+
+		/** Releases the node if it is no longer a file and nothing references it, so its identifier can be reused. */
+		void releaseIfUnused(NodeId nodeId);
+
+		Vector<Node> mNodes;
+		Vector<NodeId> mFreeNodes;
+		UnorderedMap<Path, NodeId> mNodeLookup;
+	};
+
+	/** @} */
+}
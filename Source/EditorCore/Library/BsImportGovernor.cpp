@@ -0,0 +1,146 @@
+//********************************** Banshee Engine (www.banshee3d.com) **************************************************//
+//**************** Copyright (c) 2019 Marko Pintera (marko.pintera@gmail.com). All rights reserved. **********************//
+#include "Library/BsImportGovernor.h"
+#include "Threading/BsTaskScheduler.h"
+#include "FileSystem/BsFileSystem.h"
+#include "Utility/BsPlatformUtility.h"
+
+namespace bs
+{
+	/** Smallest amount of memory any import is assumed to require, covering the importer's own overhead. */
+	static constexpr UINT64 MIN_IMPORT_MEMORY = 4 * 1024 * 1024;
+
+	/** Budget used if the amount of system memory cannot be determined. */
+	static constexpr UINT64 FALLBACK_MEMORY_BUDGET = 2048ULL * 1024 * 1024;
+
+	/** Ratio between the peak memory used by an import and the size of the source file, for a file extension. */
+	struct ImportExpansionFactor
+	{
+		const char* extension;
+		UINT32 factor;
+	};
+
+	static constexpr ImportExpansionFactor EXPANSION_FACTORS[] =
+	{
+		// Compressed images decode to raw pixels, and then generate mipmaps and compressed copies
+		{ ".png", 16 }, { ".jpg", 24 }, { ".jpeg", 24 }, { ".gif", 16 },
+		{ ".psd", 4 }, { ".tga", 4 }, { ".bmp", 4 }, { ".tif", 4 }, { ".tiff", 4 }, { ".hdr", 6 }, { ".exr", 8 },
+
+		// Meshes are parsed into an intermediate scene, and then converted into vertex data and animation clips
+		{ ".fbx", 12 }, { ".dae", 6 }, { ".obj", 6 }, { ".blend", 12 }, { ".3ds", 8 }, { ".gltf", 8 }, { ".glb", 8 },
+
+		// Fonts render glyphs into bitmap pages
+		{ ".ttf", 32 }, { ".otf", 32 },
+
+		// Compressed audio decodes into raw samples
+		{ ".ogg", 12 }, { ".flac", 4 }, { ".wav", 3 },
+	};
+
+	/** Factor used for file types not listed above. */
+	static constexpr UINT32 DEFAULT_EXPANSION_FACTOR = 4;
+
+	ImportGovernor::ImportGovernor()
+	{
+		// Leave half of the system memory for the editor itself and the rest of the system
+		const UINT64 systemMemory = (UINT64)PlatformUtility::getSystemInfo().memoryAmountMb * 1024 * 1024;
+		mMemoryBudget = systemMemory > 0 ? systemMemory / 2 : FALLBACK_MEMORY_BUDGET;
+	}
+
+	void ImportGovernor::submit(const SPtr<Task>& task, UINT64 memoryEstimate)
+	{
+		Lock lock(mMutex);
+
+		mPending.push_back({ task, memoryEstimate });
+		admitPending();
+	}
+
+	void ImportGovernor::release(UINT64 memoryEstimate)
+	{
+		Lock lock(mMutex);
+
+		assert(mNumRunning > 0 && mMemoryInUse >= memoryEstimate);
+		mMemoryInUse -= memoryEstimate;
+		mNumRunning--;
+
+		admitPending();
+	}
+
+	void ImportGovernor::expedite(const SPtr<Task>& task)
+	{
+		Lock lock(mMutex);
+
+		auto iterFind = std::find_if(mPending.begin(), mPending.end(),
+			[&task](const PendingImport& entry) { return entry.task == task; });
+
+		if (iterFind == mPending.end())
+			return;
+
+		// Earlier tasks might be dependencies of the expedited one, so they are submitted as well
+		const auto iterEnd = iterFind + 1;
+		for (auto iter = mPending.begin(); iter != iterEnd; ++iter)
+		{
+			mMemoryInUse += iter->memoryEstimate;
+			mNumRunning++;
+
+			TaskScheduler::instance().addTask(iter->task);
+		}
+
+		mPending.erase(mPending.begin(), iterEnd);
+	}
+
+	void ImportGovernor::setMemoryBudget(UINT64 budget)
+	{
+		Lock lock(mMutex);
+
+		mMemoryBudget = budget;
+		admitPending();
+	}
+
+	UINT64 ImportGovernor::getMemoryBudget() const
+	{
+		Lock lock(mMutex);
+		return mMemoryBudget;
+	}
+
+	UINT32 ImportGovernor::getNumPending() const
+	{
+		Lock lock(mMutex);
+		return (UINT32)mPending.size();
+	}
+
+	UINT64 ImportGovernor::estimateMemory(const Path& path)
+	{
+		const String extension = StringUtil::toLowerCase(path.getExtension());
+
+		UINT32 factor = DEFAULT_EXPANSION_FACTOR;
+		for (auto& entry : EXPANSION_FACTORS)
+		{
+			if (extension == entry.extension)
+			{
+				factor = entry.factor;
+				break;
+			}
+		}
+
+		const UINT64 fileSize = FileSystem::exists(path) ? FileSystem::getFileSize(path) : 0;
+		return std::max(fileSize * factor, MIN_IMPORT_MEMORY);
+	}
+
+	void ImportGovernor::admitPending()
+	{
+		while (!mPending.empty())
+		{
+			const PendingImport& next = mPending.front();
+
+			// Tasks are admitted strictly in order, so imports queued for the same file keep their ordering
+			if (mNumRunning > 0 && mMemoryInUse + next.memoryEstimate > mMemoryBudget)
+				break;
+
+			mMemoryInUse += next.memoryEstimate;
+			mNumRunning++;
+
+			TaskScheduler::instance().addTask(next.task);
+			mPending.pop_front();
+		}
+	}
+}
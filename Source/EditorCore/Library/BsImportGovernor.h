@@ -0,0 +1,84 @@
+//********************************** Banshee Engine (www.banshee3d.com) **************************************************//
+//**************** Copyright (c) 2019 Marko Pintera (marko.pintera@gmail.com). All rights reserved. **********************//
+#pragma once
+
+#include "BsEditorPrerequisites.h"
+
+namespace bs
+{
+	/** @addtogroup Library-Internal
+	 *  @{
+	 */
+
+	/**
+	 * Limits the number of imports running on worker threads at once, based on how much memory each import is
+	 * estimated to require. Imports that would exceed the memory budget are held back and submitted to the task
+	 * scheduler, in the order they were queued, as the running ones finish.
+	 *
+	 * @note	Thread safe.
+	 */
+	class BS_ED_EXPORT ImportGovernor
+	{
+		/** Import task that has not yet been submitted to the task scheduler. */
+		struct PendingImport
+		{
+			SPtr<Task> task;
+			UINT64 memoryEstimate;
+		};
+
+	public:
+		/** Creates a governor with the default memory budget, determined from the amount of system memory. */
+		ImportGovernor();
+
+		/**
+		 * Queues the provided import task for execution. The task is submitted to the task scheduler right away if the
+		 * memory budget allows it, otherwise it is held back until enough running imports finish. A task is always
+		 * submitted if no other imports are running, even if it exceeds the budget on its own.
+		 *
+		 * @param[in]	task			Task performing the import. The task must call release() when done.
+		 * @param[in]	memoryEstimate	Amount of memory the import is expected to require, in bytes. See
+		 *								estimateMemory().
+		 */
+		void submit(const SPtr<Task>& task, UINT64 memoryEstimate);
+
+		/**
+		 * Notifies the governor an import task previously queued with submit() finished, freeing up its share of the
+		 * budget and submitting any held back tasks that now fit.
+		 */
+		void release(UINT64 memoryEstimate);
+
+		/**
+		 * Ensures the provided task and all the tasks queued before it are submitted to the task scheduler, regardless
+		 * of the budget. Must be called before waiting on a queued task, otherwise the wait might never complete.
+		 */
+		void expedite(const SPtr<Task>& task);
+
+		/** Sets the total amount of memory, in bytes, that imports running at the same time are allowed to use. */
+		void setMemoryBudget(UINT64 budget);
+
+		/** @copydoc setMemoryBudget */
+		UINT64 getMemoryBudget() const;
+
+		/** Returns the number of import tasks held back because of the memory budget. */
+		UINT32 getNumPending() const;
+
+		/**
+		 * Estimates the peak amount of memory, in bytes, an import of the provided file will require. The estimate is
+		 * based on the size of the file and a per-type expansion factor, as compressed source formats decode into
+		 * much larger in-memory representations.
+		 */
+		static UINT64 estimateMemory(const Path& path);
+
+	private:
+		/** Submits held back tasks, in order, until one doesn't fit in the budget. Caller must hold the mutex. */
+		void admitPending();
+
+		mutable Mutex mMutex;
+		Deque<PendingImport> mPending;
+		UINT64 mMemoryBudget = 0;
+		UINT64 mMemoryInUse = 0;
+		UINT32 mNumRunning = 0;
+	};
+
+	/** @} */
+}
@@ -0,0 +1,133 @@
+//********************************** Banshee Engine (www.banshee3d.com) **************************************************//
+//**************** Copyright (c) 2019 Marko Pintera (marko.pintera@gmail.com). All rights reserved. **********************//
+#include "Library/BsLibraryChangeBatch.h"
+
+namespace bs
+{
+	void LibraryChangeBatch::addChange(const Path& path)
+	{
+		mChanges.push_back(path);
+	}
+
+	void LibraryChangeBatch::addRename(const Path& from, const Path& to)
+	{
+		mRenames.push_back({ from, to });
+	}
+
+	Vector<LibraryChangeBatch::Rename> LibraryChangeBatch::takeRenames()
+	{
+		Vector<Rename> output;
+		for (auto& rename : mRenames)
+		{
+			if (rename.from.getExtension() == ".meta")
+			{
+				mChanges.push_back(rename.from);
+				mChanges.push_back(rename.to);
+			}
+			else
+				output.push_back(rename);
+		}
+
+		mRenames.clear();
+		return output;
+	}
+
+	Vector<Path> LibraryChangeBatch::collapse(const Path& root, const std::function<UINT32(const Path&)>& getNumEntries)
+	{
+		Vector<Path> refreshPaths;
+
+		// Renames that were not taken are refreshed like any other change
+		for (auto& rename : takeRenames())
+		{
+			mChanges.push_back(rename.from);
+			mChanges.push_back(rename.to);
+		}
+
+		// Remove duplicates
+		UnorderedMap<String, Path> changes;
+		for (auto& path : mChanges)
+			changes.insert(std::make_pair(toKey(path), path));
+
+		// Refresh folders as a whole if many of their entries changed, repeating for parent folders as long as
+		// something gets collapsed
+		bool collapsed = true;
+		while (collapsed)
+		{
+			collapsed = false;
+
+			UnorderedMap<String, std::pair<Path, UINT32>> numChangesPerFolder;
+			for (auto& entry : changes)
+			{
+				Path folder = entry.second.getParent();
+
+				// Never refresh anything outside of the root folder
+				if (!root.includes(folder))
+					continue;
+
+				String folderKey = toKey(folder);
+
+				auto iterFind = numChangesPerFolder.find(folderKey);
+				if (iterFind == numChangesPerFolder.end())
+					numChangesPerFolder.insert(std::make_pair(std::move(folderKey), std::make_pair(std::move(folder), 1U)));
+				else
+					iterFind->second.second++;
+			}
+
+			for (auto& entry : numChangesPerFolder)
+			{
+				const Path& folder = entry.second.first;
+				const UINT32 numChanges = entry.second.second;
+
+				if (numChanges < FOLDER_REFRESH_THRESHOLD)
+					continue;
+
+				if (getNumEntries != nullptr && numChanges * 2 < getNumEntries(folder))
+					continue;
+
+				if (changes.insert(std::make_pair(entry.first, folder)).second)
+					collapsed = true;
+			}
+		}
+
+		// Drop changes contained in another changed folder, as refreshing the folder also refreshes its contents
+		for (auto& entry : changes)
+		{
+			bool covered = false;
+
+			Path parent = entry.second;
+			while (parent.getNumDirectories() > 0)
+			{
+				parent = parent.getParent();
+				if (changes.find(toKey(parent)) != changes.end())
+				{
+					covered = true;
+					break;
+				}
+			}
+
+			if (!covered)
+				refreshPaths.push_back(entry.second);
+		}
+
+		std::sort(refreshPaths.begin(), refreshPaths.end(),
+			[](const Path& a, const Path& b) { return a.toString() < b.toString(); });
+
+		mChanges.clear();
+		return refreshPaths;
+	}
+
+	void LibraryChangeBatch::clear()
+	{
+		mChanges.clear();
+		mRenames.clear();
+	}
+
+	String LibraryChangeBatch::toKey(const Path& path)
+	{
+		String key = path.toString();
+		while (!key.empty() && (key.back() == '/' || key.back() == '\\'))
+			key.pop_back();
+
+		return key;
+	}
+}
@@ -0,0 +1,74 @@
+//********************************** Banshee Engine (www.banshee3d.com) **************************************************//
+//**************** Copyright (c) 2019 Marko Pintera (marko.pintera@gmail.com). All rights reserved. **********************//
+#pragma once
+
+#include "BsEditorPrerequisites.h"
+
+namespace bs
+{
+	/** @addtogroup Library-Internal
+	 *  @{
+	 */
+
+	/**
+	 * Accumulates file system changes reported by a folder monitor, and collapses them into a minimal set of operations
+	 * that bring the project library up to date. Repeated changes to the same path are merged, changes covered by a
+	 * change to one of the parent folders are dropped, and folders with many changed entries are refreshed as a whole.
+	 */
+	class BS_ED_EXPORT LibraryChangeBatch
+	{
+	public:
+		/**
+		 * Minimum number of changed entries in a single folder required before the folder is refreshed as a whole,
+		 * instead of refreshing each entry individually.
+		 */
+		static constexpr UINT32 FOLDER_REFRESH_THRESHOLD = 16;
+
+		/** A file or folder that was moved, and whose library entry can be moved along with it. */
+		struct Rename
+		{
+			Path from;
+			Path to;
+		};
+
+		/** Registers a file or folder that was added, removed or modified. */
+		void addChange(const Path& path);
+
+		/** Registers a file or folder that was renamed or moved. */
+		void addRename(const Path& from, const Path& to);
+
+		/** Checks if any changes have been registered since the batch was last collapsed or cleared. */
+		bool isEmpty() const { return mChanges.empty() && mRenames.empty(); }
+
+		/**
+		 * Returns all registered renames in the order they happened, and removes them from the batch. Renames of .meta
+		 * files are not returned, as those are moved together with their resources. Instead their source and destination
+		 * paths are registered as regular changes. Renames should be applied before calling collapse(), and any renames
+		 * that cannot be applied should be registered as changes instead.
+		 */
+		Vector<Rename> takeRenames();
+
+		/**
+		 * Collapses all registered changes into a minimal list of files and folders to refresh, and clears the batch.
+		 * None of the output paths is contained in another output path.
+		 *
+		 * @param[in]	root			Folder containing all the changes. Folders outside of it are never refreshed.
+		 * @param[in]	getNumEntries	Optional callback returning the current number of entries in a folder. A folder
+		 *								is only refreshed as a whole if at least half of its entries changed. If not
+		 *								provided only FOLDER_REFRESH_THRESHOLD is taken into account.
+		 */
+		Vector<Path> collapse(const Path& root, const std::function<UINT32(const Path&)>& getNumEntries = nullptr);
+
+		/** Removes all registered changes. */
+		void clear();
+
+	private:
+		/** Converts the path into a string usable as a key, the same for both the file and the folder form of the path. */
+		static String toKey(const Path& path);
+
+		Vector<Path> mChanges;
+		Vector<Rename> mRenames;
+	};
+
+	/** @} */
+}
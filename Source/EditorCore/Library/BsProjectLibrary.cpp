@@ -24,6 +24,8 @@
 #include "Threading/BsTaskScheduler.h"
 #include "RenderAPI/BsRenderTexture.h"
 #include "Renderer/BsRendererUtility.h"
+#include "Utility/BsEditorProfiler.h"
+#include "Library/BsEditorShaderIncludeHandler.h"
 #include <regex>
 
 using namespace std::placeholders;
@@ -130,12 +132,16 @@ namespace bs
 
 	ProjectLibrary::~ProjectLibrary()
 	{
+		stopMonitor();
 		_finishQueuedImports(true);
+		mPendingPreloads.clear();
 		clearEntries();
 	}
 
 	UINT32 ProjectLibrary::checkForModifications(const Path& fullPath)
 	{
+		BS_EDITOR_PROFILE_SCOPE("ProjectLibrary", "checkForModifications");
+
 		UINT32 resourcesToImport = 0;
 
 		if (!mResourcesFolder.includes(fullPath))
@@ -382,7 +388,7 @@ namespace bs
 		if(iterQueuedImport != mQueuedImports.end())
 			iterQueuedImport->second->canceled = true;
 
-		removeDependencies(resource.get());
+		mDependencies.removeFile(originalPath);
 		*resource = FileEntry();
 
 		reimportDependants(originalPath);
@@ -427,12 +433,9 @@ namespace bs
 		{
 			if(FileSystem::isFile(metaPath))
 			{
-				FileDecoder fs(metaPath);
-				SPtr<IReflectable> loadedMeta = fs.decode();
-
-				if(loadedMeta != nullptr && loadedMeta->isDerivedFrom(ProjectFileMeta::getRTTIStatic()))
+				SPtr<ProjectFileMeta> fileMeta = ProjectFileMeta::load(metaPath);
+				if(fileMeta != nullptr)
 				{
-					const SPtr<ProjectFileMeta>& fileMeta = std::static_pointer_cast<ProjectFileMeta>(loadedMeta);
 					fileEntry->meta = fileMeta;
 
 					auto& resourceMetas = fileEntry->meta->getResourceMetaData();
@@ -453,6 +456,21 @@ namespace bs
 
 		if (!isUpToDate(fileEntry) || forceReimport)
 		{
+			// Meta files that fail to decode have lost their import options and resource meta-data, in which case the
+			// meta is dropped and the file imported anew
+			if (fileEntry->meta != nullptr)
+			{
+				fileEntry->meta->decode();
+
+				if (fileEntry->meta->hasDecodeFailed())
+				{
+					for (auto& resMeta : fileEntry->meta->getAllResourceMetaData())
+						mUUIDToPath.erase(resMeta->getUUID());
+
+					fileEntry->meta = nullptr;
+				}
+			}
+
 			// Note: If resource is native we just copy it to the internal folder. We could avoid the copy and 
 			// load the resource directly from the Resources folder but that requires complicating library code.
 			const bool isNativeResource = isNative(fileEntry->path);
@@ -462,7 +480,8 @@ namespace bs
 			{
 				if (fileEntry->meta != nullptr)
 					curImportOptions = fileEntry->meta->getImportOptions();
-				else
+
+				if (curImportOptions == nullptr)
 					curImportOptions = Importer::instance().createImportOptions(fileEntry->path);
 			}
 			else
@@ -506,6 +525,21 @@ namespace bs
 			// and we can't have the task closure holding a reference back, otherwise it leaks
 			std::weak_ptr<QueuedImport> queuedImportWeak = queuedImport;
 
+			// Async imports are admitted by the governor based on their estimated memory use, and must report back to it
+			// once done
+			const UINT64 memoryEstimate = synchronous ? 0 : ImportGovernor::estimateMemory(fileEntry->path);
+			const auto createImportTask = [memoryEstimate, &governor = mImportGovernor, &dependency]
+				(std::function<void()> importAsync)
+			{
+				const auto importAndRelease = [importAsync = std::move(importAsync), memoryEstimate, &governor]()
+				{
+					importAsync();
+					governor.release(memoryEstimate);
+				};
+
+				return Task::create("ProjectLibraryImport", importAndRelease, TaskPriority::Normal, dependency);
+			};
+
 			if(!isNativeResource)
 			{
 				// Find UUIDs for any existing sub-resources
@@ -520,6 +554,8 @@ namespace bs
 				// resource on disk
 				const auto importAsync = [queuedImportWeak, &projectFolder = mProjectFolder, &mutex = mQueuedImportMutex]()
 				{
+					BS_EDITOR_PROFILE_SCOPE("ProjectLibrary", "importAsync");
+
 					SPtr<QueuedImport> queuedImport = queuedImportWeak.lock();
 
 					Vector<SubResourceRaw> importedResources = gImporter()._importAll(queuedImport->filePath, 
@@ -575,8 +611,7 @@ namespace bs
 
 				if(!synchronous)
 				{
-					queuedImport->importTask = Task::create("ProjectLibraryImport", importAsync, TaskPriority::Normal,
-						dependency);
+					queuedImport->importTask = createImportTask(importAsync);
 				}
 				else
 					importAsync();
@@ -593,6 +628,8 @@ namespace bs
 
 				const auto importAsync = [queuedImportWeak, &projectFolder = mProjectFolder, &mutex = mQueuedImportMutex]()
 				{
+					BS_EDITOR_PROFILE_SCOPE("ProjectLibrary", "importAsync");
+
 					// Don't load dependencies because we don't need them, but also because they might not be in the
 					// manifest which would screw up their UUIDs.
 					SPtr<QueuedImport> queuedImport = queuedImportWeak.lock();
@@ -622,8 +659,7 @@ namespace bs
 
 				if(!synchronous)
 				{
-					queuedImport->importTask = Task::create("ProjectLibraryImport", importAsync, TaskPriority::Normal,
-						dependency);
+					queuedImport->importTask = createImportTask(importAsync);
 				}
 				else
 					importAsync();
@@ -631,7 +667,7 @@ namespace bs
 
 			if(!synchronous)
 			{
-				TaskScheduler::instance().addTask(queuedImport->importTask);
+				mImportGovernor.submit(queuedImport->importTask, memoryEstimate);
 				mQueuedImports[fileEntry] = queuedImport;
 			}
 
@@ -649,7 +685,11 @@ namespace bs
 		if (import.importTask != nullptr && !import.importTask->isComplete())
 		{
 			if (wait)
+			{
+				// Task might still be held back by the governor, in which case it would never complete
+				mImportGovernor.expedite(import.importTask);
 				import.importTask->wait();
+			}
 			else
 				return false;
 		}
@@ -794,8 +834,7 @@ namespace bs
 		if(metaModified)
 		{
 			// Save the meta file
-			FileEncoder fs(metaPath);
-			fs.encode(fileEntry->meta.get());
+			fileEntry->meta->save(metaPath);
 		}
 
 		// Register any dependencies this resource depends on
@@ -812,13 +851,121 @@ namespace bs
 
 	void ProjectLibrary::_finishQueuedImports(bool wait)
 	{
-		for(auto iter = mQueuedImports.begin(); iter != mQueuedImports.end();)
+		BS_EDITOR_PROFILE_SCOPE("ProjectLibrary", "finishQueuedImports");
+
+		// Finished imports can queue reimports of their dependants, which need to finish as well when waiting
+		do
+		{
+			for(auto iter = mQueuedImports.begin(); iter != mQueuedImports.end();)
+			{
+				if(finishQueuedImport(iter->first, *iter->second, wait))
+					iter = mQueuedImports.erase(iter);
+				else
+					++iter;
+			}
+		} while (reimportQueuedDependants() > 0 && wait);
+	}
+
+	void ProjectLibrary::startMonitor()
+	{
+		stopMonitor();
+
+		if (!mIsLoaded)
+			return;
+
+		FolderChangeBits folderChanges;
+		folderChanges |= FolderChangeBit::FileName;
+		folderChanges |= FolderChangeBit::DirName;
+		folderChanges |= FolderChangeBit::FileWrite;
+
+		mFolderMonitor = bs_unique_ptr_new<FolderMonitor>();
+		mFolderMonitor->onAdded.connect([this](const Path& path) { queueMonitorChange(path); });
+		mFolderMonitor->onRemoved.connect([this](const Path& path) { queueMonitorChange(path); });
+		mFolderMonitor->onModified.connect([this](const Path& path) { queueMonitorChange(path); });
+		mFolderMonitor->onRenamed.connect([this](const Path& from, const Path& to) { queueMonitorRename(from, to); });
+		mFolderMonitor->startMonitor(mResourcesFolder, true, folderChanges);
+
+		mMonitorTimer.reset();
+	}
+
+	void ProjectLibrary::stopMonitor()
+	{
+		if (mFolderMonitor == nullptr)
+			return;
+
+		mFolderMonitor->stopMonitorAll();
+		mFolderMonitor = nullptr;
+
+		mMonitorChanges.clear();
+	}
+
+	UINT32 ProjectLibrary::_updateMonitor()
+	{
+		if (mFolderMonitor == nullptr)
+			return 0;
+
+		// Triggers the monitor events, which queue the changes
+		mFolderMonitor->_update();
+
+		if (mMonitorChanges.isEmpty())
+			return 0;
+
+		// Wait until the changes settle down, so that operations touching many files are applied at once
+		const UINT64 time = mMonitorTimer.getMilliseconds();
+		if (time - mLastMonitorChangeTime < MONITOR_QUIET_PERIOD && time - mFirstMonitorChangeTime < MONITOR_MAX_DELAY)
+			return 0;
+
+		BS_EDITOR_PROFILE_SCOPE("ProjectLibrary", "updateMonitor");
+
+		// Move the entries of renamed files and folders, so they keep their meta-data and don't need to be reimported
+		for (auto& rename : mMonitorChanges.takeRenames())
 		{
-			if(finishQueuedImport(iter->first, *iter->second, wait))
-				iter = mQueuedImports.erase(iter);
+			const bool canMove = findEntry(rename.from) != nullptr && findEntry(rename.to) == nullptr &&
+				!FileSystem::exists(rename.from) && FileSystem::exists(rename.to);
+
+			if (canMove)
+				moveEntry(rename.from, rename.to);
 			else
-				++iter;
+			{
+				mMonitorChanges.addChange(rename.from);
+				mMonitorChanges.addChange(rename.to);
+			}
 		}
+
+		const Vector<Path> refreshPaths = mMonitorChanges.collapse(mResourcesFolder, [this](const Path& folder)
+		{
+			USPtr<LibraryEntry> entry = findEntry(folder);
+			if (entry == nullptr || entry->type != LibraryEntryType::Directory)
+				return 0U;
+
+			return (UINT32)static_cast<DirectoryEntry*>(entry.get())->mChildren.size();
+		});
+
+		UINT32 numImports = 0;
+		for (auto& path : refreshPaths)
+			numImports += checkForModifications(path);
+
+		return numImports;
+	}
+
+	void ProjectLibrary::queueMonitorChange(const Path& path)
+	{
+		const UINT64 time = mMonitorTimer.getMilliseconds();
+		if (mMonitorChanges.isEmpty())
+			mFirstMonitorChangeTime = time;
+
+		mLastMonitorChangeTime = time;
+		mMonitorChanges.addChange(path);
+	}
+
+	void ProjectLibrary::queueMonitorRename(const Path& from, const Path& to)
+	{
+		const UINT64 time = mMonitorTimer.getMilliseconds();
+		if (mMonitorChanges.isEmpty())
+			mFirstMonitorChangeTime = time;
+
+		mLastMonitorChangeTime = time;
+		mMonitorChanges.addRename(from, to);
 	}
 
 	bool ProjectLibrary::isUpToDate(FileEntry* resource) const
@@ -836,6 +983,9 @@ namespace bs
 		}
 		else
 		{
+			if (resource->meta->hasDecodeFailed())
+				return false;
+
 			auto& resourceMetas = resource->meta->getResourceMetaData();
 			for (auto& resMeta : resourceMetas)
 			{
@@ -1224,7 +1374,7 @@ namespace bs
 				if (oldEntry->type == LibraryEntryType::File)
 				{
 					fileEntry = static_pointer_cast<FileEntry>(oldEntry);
-					removeDependencies(fileEntry.get());
+					mDependencies.removeFile(oldFullPath);
 
 					// Update uuid <-> path mapping
 					if(fileEntry->meta != nullptr)
@@ -1249,6 +1399,9 @@ namespace bs
 				if(FileSystem::isFile(oldMetaPath))
 					FileSystem::move(oldMetaPath, newMetaPath);
 
+				if (fileEntry != nullptr && fileEntry->meta != nullptr)
+					fileEntry->meta->_notifyMoved(newMetaPath);
+
 				DirectoryEntry* parent = oldEntry->parent;
 				auto findIter = std::find(parent->mChildren.begin(), parent->mChildren.end(), oldEntry);
 				if(findIter != parent->mChildren.end())
@@ -1287,11 +1440,23 @@ namespace bs
 						DirectoryEntry* curDirEntry = static_cast<DirectoryEntry*>(curEntry);
 						for(auto& child : curDirEntry->mChildren)
 						{
+							const Path oldChildPath = child->path;
+
 							child->path = child->parent->path;
 							child->path.append(child->elementName);
 
 							if(child->type == LibraryEntryType::Directory)
 								todo.push(child.get());
+							else
+							{
+								// Meta files were moved along with the directory
+								auto* childFileEntry = static_cast<FileEntry*>(child.get());
+								if (childFileEntry->meta != nullptr)
+									childFileEntry->meta->_notifyMoved(getMetaPath(childFileEntry->path));
+
+								mDependencies.removeFile(oldChildPath);
+								restoreDependencies(childFileEntry);
+							}
 						}
 					}
 				}
@@ -1300,6 +1465,8 @@ namespace bs
 
 				if (fileEntry != nullptr)
 				{
+					restoreDependencies(fileEntry.get());
+
 					reimportDependants(oldFullPath);
 					reimportDependants(newFullPath);
 				}
@@ -1488,8 +1655,7 @@ namespace bs
 		Path metaPath = fileEntry->path;
 		metaPath.setFilename(metaPath.getFilename() + ".meta");
 
-		FileEncoder fs(metaPath);
-		fs.encode(fileEntry->meta.get());
+		fileEntry->meta->save(metaPath);
 	}
 
 	void ProjectLibrary::setUserData(const Path& path, const SPtr<IReflectable>& userData)
@@ -1509,13 +1675,14 @@ namespace bs
 		if (resMeta == nullptr)
 			return;
 
+		// Make sure the user data isn't overwritten once the rest of the meta file gets decoded
+		fileEntry->meta->decode();
 		resMeta->mUserData = userData;
 
 		Path metaPath = fileEntry->path;
 		metaPath.setFilename(metaPath.getFilename() + ".meta");
 
-		FileEncoder fs(metaPath);
-		fs.encode(fileEntry->meta.get());
+		fileEntry->meta->save(metaPath);
 	}
 
 	Vector<USPtr<ProjectLibrary::FileEntry>> ProjectLibrary::getResourcesForBuild() const
@@ -1554,12 +1721,152 @@ namespace bs
 		if (meta == nullptr)
 			return HResource();
 
+		// Scenes usually reference a large number of resources, load them in parallel before the scene itself
+		Vector<HResource> dependencies;
+		if (meta->getTypeID() == TID_Prefab)
+			dependencies = preloadDependencies(path);
+
 		ResourceLoadFlags loadFlags = ResourceLoadFlag::Default | ResourceLoadFlag::KeepSourceData;
 
+		// Load is synchronous, so the scene references all its dependencies by the time the preloaded handles are released
 		const UUID& resUUID = meta->getUUID();
 		return gResources().loadFromUUID(resUUID, false, loadFlags);
 	}
 
+	/** Returns the order in which resources of a specific type should be loaded when preloading. Lower loads first. */
+	static UINT32 getPreloadPriority(UINT32 typeId)
+	{
+		switch(typeId)
+		{
+		case TID_Shader:
+		case TID_ShaderInclude:
+			return 0;
+		case TID_Mesh:
+			return 1;
+		case TID_Material:
+			return 2;
+		case TID_Texture:
+		case TID_SpriteTexture:
+			return 4;
+		default:
+			return 3;
+		}
+	}
+
+	Vector<HResource> ProjectLibrary::preloadDependencies(const Path& path)
+	{
+		SPtr<ProjectResourceMeta> meta = findResourceMeta(path);
+		if (meta == nullptr)
+			return Vector<HResource>();
+
+		Path resourcePath;
+		if (!gResources().getFilePathFromUUID(meta->getUUID(), resourcePath))
+			return Vector<HResource>();
+
+		struct PreloadEntry
+		{
+			UUID uuid;
+			Path path;
+			UINT32 priority;
+			UINT64 size;
+		};
+
+		// Dependencies are loaded as separate entries, so there's no need for each load to recurse on its own
+		ResourceLoadFlags loadFlags = ResourceLoadFlag::KeepSourceData;
+
+		Vector<HResource> output;
+		Vector<PreloadEntry> entries;
+		UnorderedSet<UUID> visited = { meta->getUUID() };
+
+		// Walk the dependency graph breadth first, so direct dependencies are requested before indirect ones. Loads are
+		// issued as soon as the dependencies are found, so they can proceed while the rest of the graph is being read.
+		Vector<Path> toVisit = { resourcePath };
+		for (UINT32 i = 0; i < (UINT32)toVisit.size(); i++)
+		{
+			entries.clear();
+
+			Vector<UUID> dependencies = gResources().getDependencies(toVisit[i]);
+			for (auto& dependency : dependencies)
+			{
+				if (!visited.insert(dependency).second)
+					continue;
+
+				Path dependencyPath;
+				if (!gResources().getFilePathFromUUID(dependency, dependencyPath))
+					continue;
+
+				UINT32 typeId = 0;
+				LibraryEntry* libEntry = findEntry(uuidToPath(dependency)).get();
+				if (libEntry != nullptr && libEntry->type == LibraryEntryType::File)
+				{
+					auto fileEntry = static_cast<FileEntry*>(libEntry);
+					if (fileEntry->meta != nullptr)
+					{
+						for (auto& resMeta : fileEntry->meta->getResourceMetaData())
+						{
+							if (resMeta->getUUID() == dependency)
+							{
+								typeId = resMeta->getTypeID();
+								break;
+							}
+						}
+					}
+				}
+
+				PreloadEntry entry;
+				entry.uuid = dependency;
+				entry.path = dependencyPath;
+				entry.priority = getPreloadPriority(typeId);
+				entry.size = FileSystem::getFileSize(dependencyPath);
+
+				entries.push_back(entry);
+			}
+
+			std::sort(entries.begin(), entries.end(), 
+				[](const PreloadEntry& a, const PreloadEntry& b)
+			{
+				if (a.priority != b.priority)
+					return a.priority < b.priority;
+
+				return a.size < b.size;
+			});
+
+			for (auto& entry : entries)
+			{
+				output.push_back(gResources().loadFromUUID(entry.uuid, true, loadFlags));
+				toVisit.push_back(entry.path);
+			}
+		}
+
+		return output;
+	}
+
+	void ProjectLibrary::_keepUntilLoaded(const HResource& resource, Vector<HResource> dependencies)
+	{
+		if (dependencies.empty())
+			return;
+
+		PendingPreload preload;
+		preload.resource = resource;
+		preload.dependencies = std::move(dependencies);
+
+		mPendingPreloads.push_back(std::move(preload));
+	}
+
+	void ProjectLibrary::_releaseLoadedPreloads()
+	{
+		for (auto iter = mPendingPreloads.begin(); iter != mPendingPreloads.end();)
+		{
+			// Once loaded the resource references the dependencies itself. If it is neither loaded nor loading, its load
+			// failed and the dependencies are no longer needed either.
+			const HResource& resource = iter->resource;
+			if (resource.isLoaded(false) || !gResources().isLoaded(resource.getUUID()))
+				iter = mPendingPreloads.erase(iter);
+			else
+				++iter;
+		}
+	}
+
 	void ProjectLibrary::createInternalParentHierarchy(const Path& fullPath, DirectoryEntry** newHierarchyRoot, 
 		DirectoryEntry** newHierarchyLeaf)
 	{
@@ -1630,7 +1937,9 @@ namespace bs
 		if (!mIsLoaded)
 			return;
 
+		stopMonitor();
 		_finishQueuedImports(true);
+		mPendingPreloads.clear();
 
 		mProjectFolder = Path::BLANK;
 		mResourcesFolder = Path::BLANK;
@@ -1639,6 +1948,8 @@ namespace bs
 		mRootEntry = bs_ushared_ptr_new<DirectoryEntry>(mResourcesFolder, mResourcesFolder.getTail(), nullptr);
 
 		mDependencies.clear();
+		mQueuedDependants.clear();
+		mQueuedDependantSet.clear();
 		gResources().unregisterResourceManifest(mResourceManifest);
 		mResourceManifest = nullptr;
 		mIsLoaded = false;
@@ -1652,7 +1963,13 @@ namespace bs
 		{
 			entry->path.makeRelative(root);
 
-			if (entry->type == LibraryEntryType::Directory)
+			if (entry->type == LibraryEntryType::File)
+			{
+				FileEntry* fileEntry = static_cast<FileEntry*>(entry);
+				for (auto& dependency : fileEntry->dependencies)
+					dependency.makeRelative(root);
+			}
+			else if (entry->type == LibraryEntryType::Directory)
 			{
 				DirectoryEntry* dirEntry = static_cast<DirectoryEntry*>(entry);
 				for (auto& child : dirEntry->mChildren)
@@ -1671,7 +1988,13 @@ namespace bs
 		{
 			entry->path.makeAbsolute(root);
 
-			if (entry->type == LibraryEntryType::Directory)
+			if (entry->type == LibraryEntryType::File)
+			{
+				FileEntry* fileEntry = static_cast<FileEntry*>(entry);
+				for (auto& dependency : fileEntry->dependencies)
+					dependency.makeAbsolute(root);
+			}
+			else if (entry->type == LibraryEntryType::Directory)
 			{
 				DirectoryEntry* dirEntry = static_cast<DirectoryEntry*>(entry);
 				for (auto& child : dirEntry->mChildren)
@@ -1752,6 +2075,7 @@ namespace bs
 		todo.push(mRootEntry.get());
 
 		Vector<USPtr<LibraryEntry>> deletedEntries;
+		Vector<USPtr<FileEntry>> undecodableEntries;
 
 		while(!todo.empty())
 		{
@@ -1771,17 +2095,9 @@ namespace bs
 							Path metaPath = resEntry->path;
 							metaPath.setFilename(metaPath.getFilename() + ".meta");
 
+							// Only the meta file header is read, the rest is decoded when first needed
 							if (FileSystem::isFile(metaPath))
-							{
-								FileDecoder fs(metaPath);
-								SPtr<IReflectable> loadedMeta = fs.decode();
-
-								if (loadedMeta != nullptr && loadedMeta->isDerivedFrom(ProjectFileMeta::getRTTIStatic()))
-								{
-									SPtr<ProjectFileMeta> fileMeta = std::static_pointer_cast<ProjectFileMeta>(loadedMeta);
-									resEntry->meta = fileMeta;
-								}
-							}
+								resEntry->meta = ProjectFileMeta::load(metaPath);
 						}
 
 						if (resEntry->meta != nullptr)
@@ -1800,7 +2116,13 @@ namespace bs
 							}
 						}
 
-						addDependencies(resEntry.get());
+						// Dependencies are normally stored with the library entries, and are only found again for
+						// libraries saved before they were stored
+						restoreDependencies(resEntry.get());
+
+						// Finding dependencies decodes some of the meta files, which might turn out to be corrupted
+						if (resEntry->meta != nullptr && resEntry->meta->hasDecodeFailed())
+							undecodableEntries.push_back(resEntry);
 					}
 					else
 						deletedEntries.push_back(resEntry);
@@ -1824,6 +2146,10 @@ namespace bs
 				deleteDirectoryInternal(static_pointer_cast<DirectoryEntry>(deletedEntry));
 		}
 
+		// Reimport entries whose meta files couldn't be decoded, so their meta-data gets recreated
+		for (auto& undecodableEntry : undecodableEntries)
+			reimportResourceInternal(undecodableEntry.get());
+
 		// Clean up internal library folder from obsolete files
 		Path internalResourcesFolder = mProjectFolder;
 		internalResourcesFolder.append(INTERNAL_RESOURCES_DIR);
@@ -1882,6 +2208,27 @@ namespace bs
 		mRootEntry = nullptr;
 	}
 
+	/** Finds the names of all files referenced by #include directives in shader source code. */
+	static void findShaderIncludes(const String& source, Vector<String>& output)
+	{
+		static constexpr char INCLUDE_DIRECTIVE[] = "#include";
+		static constexpr UINT32 INCLUDE_DIRECTIVE_LENGTH = sizeof(INCLUDE_DIRECTIVE) - 1;
+
+		String::size_type pos = source.find(INCLUDE_DIRECTIVE);
+		while (pos != String::npos)
+		{
+			const String::size_type nameStart = source.find_first_not_of(" \t", pos + INCLUDE_DIRECTIVE_LENGTH);
+			if (nameStart != String::npos && source[nameStart] == '"')
+			{
+				const String::size_type nameEnd = source.find_first_of("\"\n", nameStart + 1);
+				if (nameEnd != String::npos && source[nameEnd] == '"')
+					output.push_back(source.substr(nameStart + 1, nameEnd - nameStart - 1));
+			}
+
+			pos = source.find(INCLUDE_DIRECTIVE, pos + INCLUDE_DIRECTIVE_LENGTH);
+		}
+	}
+
 	Vector<Path> ProjectLibrary::getImportDependencies(const FileEntry* entry)
 	{
 		Vector<Path> output;
@@ -1889,66 +2236,117 @@ namespace bs
 		if (entry->meta == nullptr)
 			return output;
 
+		const auto addDependency = [this, &output](const String& include)
+		{
+			Path path = EditorShaderIncludeHandler::toResourcePath(include);
+			if (path.isEmpty())
+				return;
+
+			// Includes may be specified relative to the resources folder, while library entries are always absolute
+			if (!path.isAbsolute())
+				path.makeAbsolute(mResourcesFolder);
+
+			output.push_back(path);
+		};
+
 		auto& resourceMetas = entry->meta->getResourceMetaData();
 		for(auto& resMeta : resourceMetas)
 		{
 			if (resMeta->getTypeID() == TID_Shader)
 			{
 				SPtr<ShaderMetaData> metaData = std::static_pointer_cast<ShaderMetaData>(resMeta->getResourceMetaData());
+				if (metaData == nullptr)
+					continue;
 
 				for (auto& include : metaData->includes)
-					output.push_back(include);
+					addDependency(include);
+			}
+			else if (resMeta->getTypeID() == TID_ShaderInclude)
+			{
+				// Includes don't record what they include themselves, so scan the source in order to track include chains
+				SPtr<DataStream> stream = FileSystem::openFile(entry->path);
+				if (stream == nullptr)
+					continue;
+
+				Vector<String> includes;
+				findShaderIncludes(stream->getAsString(), includes);
+				stream->close();
+
+				for (auto& include : includes)
+					addDependency(include);
 			}
 		}
 
 		return output;
 	}
 
-	void ProjectLibrary::addDependencies(const FileEntry* entry)
+	void ProjectLibrary::addDependencies(FileEntry* entry)
+	{
+		entry->dependencies = getImportDependencies(entry);
+		entry->hasDependencies = true;
+
+		mDependencies.setDependencies(entry->path, entry->dependencies);
+	}
+
+	void ProjectLibrary::restoreDependencies(FileEntry* entry)
 	{
-		Vector<Path> dependencies = getImportDependencies(entry);
-		for (auto& dependency : dependencies)
-			mDependencies[dependency].push_back(entry->path);
+		if (entry->hasDependencies)
+			mDependencies.setDependencies(entry->path, entry->dependencies);
+		else
+			addDependencies(entry);
 	}
 
 	void ProjectLibrary::removeDependencies(const FileEntry* entry)
 	{
-		Vector<Path> dependencies = getImportDependencies(entry);
-		for (auto& dependency : dependencies)
-		{
-			Vector<Path>& curDependencies = mDependencies[dependency];
-			auto iterRemove = std::remove_if(curDependencies.begin(), curDependencies.end(),
-				[&](const Path& x)
-			{
-				return x == entry->path;
-			});
+		mDependencies.removeDependencies(entry->path);
+	}
 
-			curDependencies.erase(iterRemove, curDependencies.end());
+	void ProjectLibrary::reimportDependants(const Path& entryPath)
+	{
+		for (auto& dependant : mDependencies.getDependants(entryPath))
+		{
+			if (mQueuedDependantSet.insert(dependant).second)
+				mQueuedDependants.push_back(dependant);
 		}
 	}
 
-	void ProjectLibrary::reimportDependants(const Path& entryPath)
+	UINT32 ProjectLibrary::reimportQueuedDependants()
 	{
-		auto iterFind = mDependencies.find(entryPath);
-		if (iterFind == mDependencies.end())
-			return;
+		// Make a copy since reimports might queue more dependants
+		Vector<Path> dependants = std::move(mQueuedDependants);
+		mQueuedDependants.clear();
+		mQueuedDependantSet.clear();
 
-		// Make a copy since we might modify this list during reimport
-		Vector<Path> dependencies = iterFind->second;
-		for (auto& dependency : dependencies)
+		UINT32 numReimports = 0;
+		for (auto& dependant : dependants)
 		{
-			LibraryEntry* entry = findEntry(dependency).get();
-			if (entry != nullptr && entry->type == LibraryEntryType::File)
+			LibraryEntry* entry = findEntry(dependant).get();
+			if (entry == nullptr || entry->type != LibraryEntryType::File)
+				continue;
+
+			FileEntry* resEntry = static_cast<FileEntry*>(entry);
+
+			// Include files only store their own source, so they don't need to be reimported when a file they include
+			// changes. Their dependants were already found through the include chain.
+			SPtr<ImportOptions> importOptions;
+			if (resEntry->meta != nullptr)
 			{
-				FileEntry* resEntry = static_cast<FileEntry*>(entry);
+				const auto& resourceMetas = resEntry->meta->getResourceMetaData();
+				const bool isIncludeOnly = std::all_of(resourceMetas.begin(), resourceMetas.end(),
+					[](const SPtr<ProjectResourceMeta>& resMeta) { return resMeta->getTypeID() == TID_ShaderInclude; });
 
-				SPtr<ImportOptions> importOptions;
-				if (resEntry->meta != nullptr)
-					importOptions = resEntry->meta->getImportOptions();
+				if (!resourceMetas.empty() && isIncludeOnly)
+					continue;
 
-				reimportResourceInternal(resEntry, importOptions, true);
+				importOptions = resEntry->meta->getImportOptions();
 			}
+
+			// Each reimport runs as a separate task, so independent dependants are reimported in parallel
+			if (reimportResourceInternal(resEntry, importOptions, true))
+				numReimports++;
 		}
+
+		return numReimports;
 	}
 
 	BS_ED_EXPORT ProjectLibrary& gProjectLibrary()
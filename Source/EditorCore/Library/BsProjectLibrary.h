@@ -6,6 +6,11 @@
 #include "Utility/BsModule.h"
 #include "Threading/BsAsyncOp.h"
 #include "Utility/BsUSPtr.h"
+#include "Library/BsImportGovernor.h"
+#include "Library/BsImportDependencyGraph.h"
+#include "Library/BsLibraryChangeBatch.h"
+#include "Platform/BsFolderMonitor.h"
+#include "Utility/BsTimer.h"
 
 namespace bs
 {
@@ -54,6 +59,13 @@ namespace bs
 
 			SPtr<ProjectFileMeta> meta; /**< Meta file containing various information about the resource(s). */
 			std::time_t lastUpdateTime = 0; /**< Timestamp of when we last imported the resource. */
+
+			/** 
+			 * Files that this file needs to be reimported after, as found during its last import. Stored with the
+			 * library so the dependencies can be restored without reading the file or decoding its meta-data.
+			 */
+			Vector<Path> dependencies;
+			bool hasDependencies = false; /**< True if @p dependencies are known, false if they must be found again. */
 		};
 
 		/**	A library entry representing a folder that contains other entries. */
@@ -248,12 +260,40 @@ namespace bs
 		 */
 		HResource load(const Path& path);
 
+		/**
+		 * Starts asynchronous loads for all resources that the resource at the specified path depends on, directly or
+		 * indirectly. This allows the dependencies to load in parallel, rather than serially as they are encountered
+		 * while the resource is being deserialized. Loads are issued as soon as the dependencies are discovered, while
+		 * the rest of the dependency graph is still being read. Direct dependencies are issued before indirect ones, and
+		 * dependencies of the same resource are ordered so that shaders and meshes are loaded first and textures last,
+		 * and within the same type smaller resources are loaded before larger ones.
+		 *
+		 * The caller must keep the returned handles until the resource itself finishes loading, otherwise the
+		 * dependencies may get unloaded before the resource gets to reference them. See _keepUntilLoaded().
+		 *
+		 * @param[in]	path	Path of the resource, absolute or relative to resources folder. If a sub-resource within
+		 *						a file is needed, append the name of the subresource to the path 
+		 *						(for example mymesh.fbx/my_animation).
+		 * @return				Handles to all the resources whose loads were started.
+		 */
+		Vector<HResource> preloadDependencies(const Path& path);
+
 		/** Returns the path to the project's resource folder where all the assets are stored. */
 		const Path& getResourcesFolder() const { return mResourcesFolder; }
 
 		/** Returns the number of resources currently queued for import. */
 		UINT32 getInProgressImportCount() const { return (UINT32)mQueuedImports.size(); }
 
+		/**
+		 * Sets the amount of memory, in bytes, that asynchronous imports running at the same time are allowed to use.
+		 * Imports that would exceed the budget are delayed until enough of the running ones finish. By default the
+		 * budget is half of the system memory.
+		 */
+		void setImportMemoryBudget(UINT64 budget) { mImportGovernor.setMemoryBudget(budget); }
+
+		/** @copydoc setImportMemoryBudget */
+		UINT64 getImportMemoryBudget() const { return mImportGovernor.getMemoryBudget(); }
+
 		/**
 		 * Saves all the project library data so it may be restored later, at the default save location in the project
 		 * folder. Project must be loaded when calling this.
@@ -269,6 +309,16 @@ namespace bs
 		/**	Clears all library data. */
 		void unloadLibrary();
 
+		/**
+		 * Starts monitoring the resources folder for changes made outside of the library (e.g. by a version control
+		 * system). Detected changes are collected and applied in batches by _updateMonitor(). Project must be loaded when
+		 * calling this.
+		 */
+		void startMonitor();
+
+		/** Stops monitoring the resources folder for changes. Any changes not yet applied are discarded. */
+		void stopMonitor();
+
 		/** Triggered whenever an entry is removed from the library. Path provided is absolute. */
 		Event<void(const Path&)> onEntryRemoved; 
 
@@ -293,10 +343,38 @@ namespace bs
 		 */
 		void _finishQueuedImports(bool wait = false);
 
+		/**
+		 * Keeps the provided handles, usually returned by preloadDependencies(), alive until the provided resource
+		 * finishes loading asynchronously, or its load fails.
+		 */
+		void _keepUntilLoaded(const HResource& resource, Vector<HResource> dependencies);
+
+		/** 
+		 * Releases handles registered with _keepUntilLoaded() whose resource has finished loading. This should be called
+		 * on a regular basis (e.g. every frame).
+		 */
+		void _releaseLoadedPreloads();
+
+		/**
+		 * Applies changes detected by the folder monitor started with startMonitor(). Changes are only applied once no
+		 * new changes have been reported for MONITOR_QUIET_PERIOD milliseconds, or MONITOR_MAX_DELAY milliseconds have
+		 * passed since the first unapplied change, so that operations touching many files are applied in a single pass.
+		 * This should be called on a regular basis (e.g. every frame).
+		 *
+		 * @return	Number of resources queued for import.
+		 */
+		UINT32 _updateMonitor();
+
 		/** @} */
 
 		static const Path RESOURCES_DIR;
 		static const Path INTERNAL_RESOURCES_DIR;
+
+		/** Time without new changes after which monitored changes are applied, in milliseconds. */
+		static constexpr UINT64 MONITOR_QUIET_PERIOD = 100;
+
+		/** Maximum time monitored changes are delayed for before being applied, in milliseconds. */
+		static constexpr UINT64 MONITOR_MAX_DELAY = 500;
 	private:
 		/** Name/resource pair for a single imported resource. */
 		struct QueuedImportResource
@@ -315,6 +393,13 @@ namespace bs
 			UUID uuid;
 		};
 
+		/** Resource being loaded asynchronously, and the dependencies preloaded for it. */
+		struct PendingPreload
+		{
+			HResource resource;
+			Vector<HResource> dependencies;
+		};
+
 		/** Information about an asynchronously queued import. */
 		struct QueuedImport
 		{
@@ -426,19 +511,37 @@ namespace bs
 
 		/**
 		 * Returns a set of resource paths that are dependent on the provided resource entry. (for example a shader file
-		 * might be dependent on shader include file).
+		 * might be dependent on shader include file). Include files are scanned for nested includes, so that chains of
+		 * includes are tracked as well.
 		 */
 		Vector<Path> getImportDependencies(const FileEntry* entry);
 
-		/**	Registers any import dependencies for the specified resource. */
-		void addDependencies(const FileEntry* entry);
+		/**	Finds and registers any import dependencies for the specified resource. */
+		void addDependencies(FileEntry* entry);
+
+		/** 
+		 * Registers the import dependencies stored in the specified resource entry, or finds them if the entry doesn't
+		 * have them stored.
+		 */
+		void restoreDependencies(FileEntry* entry);
 
 		/**	Removes any import dependencies for the specified resource. */
 		void removeDependencies(const FileEntry* entry);
 
-		/**	Finds dependants resource for the specified resource entry and reimports them. */
+		/**
+		 * Finds all resources that directly or indirectly depend on the specified resource entry and queues them for
+		 * reimport. The reimports are started on the next call to _finishQueuedImports(), so that a dependant affected
+		 * by multiple changed resources is only reimported once.
+		 */
 		void reimportDependants(const Path& entryPath);
 
+		/**
+		 * Starts asynchronous reimports of all the dependants queued by reimportDependants(). Each reimport is a
+		 * separate task without dependencies on the others, so they can complete in any order. Returns the number of
+		 * started reimports.
+		 */
+		UINT32 reimportQueuedDependants();
+
 		/**	Makes all library entry paths relative to the current resources folder. */
 		void makeEntriesRelative();
 
@@ -469,6 +572,12 @@ namespace bs
 		 */
 		void waitForQueuedImport(FileEntry* fileEntry);
 
+		/** Registers a file or folder change reported by the folder monitor. */
+		void queueMonitorChange(const Path& path);
+
+		/** Registers a file or folder rename reported by the folder monitor. */
+		void queueMonitorRename(const Path& from, const Path& to);
+
 		static const char* LIBRARY_ENTRIES_FILENAME;
 		static const char* RESOURCE_MANIFEST_FILENAME;
 
@@ -480,9 +589,19 @@ namespace bs
 
 		Mutex mQueuedImportMutex;
 		UnorderedMap<FileEntry*, SPtr<QueuedImport>> mQueuedImports;
+		ImportGovernor mImportGovernor;
 
-		UnorderedMap<Path, Vector<Path>> mDependencies;
+		ImportDependencyGraph mDependencies;
+		Vector<Path> mQueuedDependants;
+		UnorderedSet<Path> mQueuedDependantSet;
 		UnorderedMap<UUID, Path> mUUIDToPath;
+		Vector<PendingPreload> mPendingPreloads;
+
+		UPtr<FolderMonitor> mFolderMonitor;
+		LibraryChangeBatch mMonitorChanges;
+		Timer mMonitorTimer;
+		UINT64 mFirstMonitorChangeTime = 0;
+		UINT64 mLastMonitorChangeTime = 0;
 	};
 
 	/**	Provides easy access to ProjectLibrary. */
@@ -3,6 +3,12 @@
 #include "Library/BsProjectResourceMeta.h"
 #include "Private/RTTI/BsProjectResourceMetaRTTI.h"
 #include "String/BsUnicode.h"
+#include "FileSystem/BsFileSystem.h"
+#include "FileSystem/BsDataStream.h"
+#include "Serialization/BsFileSerializer.h"
+#include "Serialization/BsMemorySerializer.h"
+#include "Serialization/BsSerializedObject.h"
+#include "Importer/BsImportOptions.h"
 
 namespace bs
 {
@@ -16,6 +22,36 @@ namespace bs
 		return UTF8::fromWide(mName);
 	}
 
+	SPtr<ResourceMetaData> ProjectResourceMeta::getResourceMetaData() const
+	{
+		decode();
+		return mResourceMeta;
+	}
+
+	const ProjectResourceIcons& ProjectResourceMeta::getPreviewIcons() const
+	{
+		decode();
+		return mPreviewIcons;
+	}
+
+	void ProjectResourceMeta::setPreviewIcons(const ProjectResourceIcons& icons)
+	{
+		decode();
+		mPreviewIcons = icons;
+	}
+
+	SPtr<IReflectable> ProjectResourceMeta::getUserData() const
+	{
+		decode();
+		return mUserData;
+	}
+
+	void ProjectResourceMeta::decode() const
+	{
+		if (mUndecodedOwner != nullptr)
+			mUndecodedOwner->decode();
+	}
+
 	SPtr<ProjectResourceMeta> ProjectResourceMeta::create(const String& name, const UUID& uuid, UINT32 typeId,
 		const ProjectResourceIcons& previewIcons, const SPtr<ResourceMetaData>& resourceMetaData)
 	{
@@ -48,12 +84,391 @@ namespace bs
 		return ProjectResourceMeta::getRTTIStatic();
 	}
 
+	/** Hashes the provided bytes, used for validating the encoded part of a meta file. */
+	static UINT64 hashMetaData(const UINT8* data, UINT32 size)
+	{
+		// FNV-1a
+		UINT64 hash = 14695981039346656037ULL;
+		for (UINT32 i = 0; i < size; i++)
+		{
+			hash ^= data[i];
+			hash *= 1099511628211ULL;
+		}
+
+		return hash;
+	}
+
+	static const char* BASE64_CHARS = "ABCDEFGHIJKLMNOPQRSTUVWXYZabcdefghijklmnopqrstuvwxyz0123456789+/";
+
+	/** Returns the number of characters required for encoding @p size bytes in base64. */
+	static UINT32 getBase64Length(UINT32 size)
+	{
+		return ((size + 2) / 3) * 4;
+	}
+
+	/** Encodes the provided bytes in base64, so they can be stored in a text file. */
+	static String encodeBase64(const UINT8* data, UINT32 size)
+	{
+		String output;
+		output.reserve(getBase64Length(size));
+
+		for (UINT32 i = 0; i < size; i += 3)
+		{
+			const UINT32 numBytes = std::min(size - i, 3U);
+
+			UINT32 triple = data[i] << 16;
+			if (numBytes > 1) triple |= data[i + 1] << 8;
+			if (numBytes > 2) triple |= data[i + 2];
+
+			output += BASE64_CHARS[(triple >> 18) & 0x3F];
+			output += BASE64_CHARS[(triple >> 12) & 0x3F];
+			output += numBytes > 1 ? BASE64_CHARS[(triple >> 6) & 0x3F] : '=';
+			output += numBytes > 2 ? BASE64_CHARS[triple & 0x3F] : '=';
+		}
+
+		return output;
+	}
+
+	/** 
+	 * Decodes @p size bytes from base64 encoded @p text into @p output. Returns false if the text isn't valid base64 or
+	 * doesn't contain the expected number of bytes.
+	 */
+	static bool decodeBase64(const char* text, UINT32 length, UINT8* output, UINT32 size)
+	{
+		if (length != getBase64Length(size))
+			return false;
+
+		UINT32 numWritten = 0;
+		for (UINT32 i = 0; i < length; i += 4)
+		{
+			UINT32 triple = 0;
+			UINT32 numBytes = 3;
+			for (UINT32 j = 0; j < 4; j++)
+			{
+				const char c = text[i + j];
+
+				UINT32 value;
+				if (c >= 'A' && c <= 'Z') value = c - 'A';
+				else if (c >= 'a' && c <= 'z') value = c - 'a' + 26;
+				else if (c >= '0' && c <= '9') value = c - '0' + 52;
+				else if (c == '+') value = 62;
+				else if (c == '/') value = 63;
+				else if (c == '=' && j >= 2)
+				{
+					value = 0;
+					numBytes = std::min(numBytes, j - 1);
+				}
+				else
+					return false;
+
+				triple = (triple << 6) | value;
+			}
+
+			for (UINT32 j = 0; j < numBytes && numWritten < size; j++)
+				output[numWritten++] = (UINT8)((triple >> (16 - j * 8)) & 0xFF);
+		}
+
+		return numWritten == size;
+	}
+
+	/** Encodes the provided bytes as a string of hexadecimal digits. */
+	static String encodeHex(const UINT8* data, UINT32 size)
+	{
+		static const char* HEX_CHARS = "0123456789abcdef";
+
+		String output;
+		output.reserve(size * 2);
+
+		for (UINT32 i = 0; i < size; i++)
+		{
+			output += HEX_CHARS[data[i] >> 4];
+			output += HEX_CHARS[data[i] & 0xF];
+		}
+
+		return output;
+	}
+
+	/** Decodes a string of hexadecimal digits. Returns false if the text isn't valid. */
+	static bool decodeHex(const String& text, Vector<UINT8>& output)
+	{
+		if (text.size() % 2 != 0)
+			return false;
+
+		const auto toNibble = [](char c) -> INT32
+		{
+			if (c >= '0' && c <= '9') return c - '0';
+			if (c >= 'a' && c <= 'f') return c - 'a' + 10;
+			if (c >= 'A' && c <= 'F') return c - 'A' + 10;
+
+			return -1;
+		};
+
+		output.resize(text.size() / 2);
+		for (size_t i = 0; i < output.size(); i++)
+		{
+			const INT32 high = toNibble(text[i * 2]);
+			const INT32 low = toNibble(text[i * 2 + 1]);
+			if (high < 0 || low < 0)
+				return false;
+
+			output[i] = (UINT8)((high << 4) | low);
+		}
+
+		return true;
+	}
+
+	/** Header of a meta file, as written by ProjectFileMeta::save(). */
+	struct ProjectFileMetaHeader
+	{
+		struct Resource
+		{
+			UUID uuid;
+			UINT32 typeId = 0;
+			String name;
+		};
+
+		/** Serialized value of a single import options field. */
+		struct ImportOption
+		{
+			UINT32 typeId = 0;
+			UINT32 fieldId = 0;
+			Vector<UINT8> value;
+		};
+
+		UINT32 version = 0;
+		bool includeInBuild = false;
+		Vector<Resource> resources;
+
+		/** 
+		 * Type IDs of the import options class and all its base classes, most derived first. Empty if the import options
+		 * are stored in the encoded meta-data instead of the header.
+		 */
+		Vector<UINT32> importOptionsTypeIds;
+		Vector<ImportOption> importOptions;
+
+		UINT32 dataSize = 0;
+		UINT64 dataHash = 0;
+	};
+
+	/** 
+	 * Writes import options as a header line listing their types, followed by a line per field. Each field is written
+	 * separately so changes to import options show up as changes to individual lines, and changes to different fields
+	 * can be merged. Returns false if the import options contain fields that aren't plain values, in which case they
+	 * must be encoded together with the rest of the meta-data.
+	 */
+	static bool writeImportOptions(ImportOptions& importOptions, StringStream& output)
+	{
+		SPtr<SerializedObject> serialized = SerializedObject::create(importOptions);
+
+		StringStream lines;
+		lines << "importOptions";
+		for (auto& subObject : serialized->subObjects)
+			lines << " " << subObject.typeId;
+
+		lines << "\n";
+
+		for (auto& subObject : serialized->subObjects)
+		{
+			RTTITypeBase* rtti = IReflectable::_getRTTIfromTypeId(subObject.typeId);
+
+			// Fields are sorted so saving the same options always produces the same output
+			Vector<UINT32> fieldIds;
+			for (auto& entry : subObject.entries)
+				fieldIds.push_back(entry.first);
+
+			std::sort(fieldIds.begin(), fieldIds.end());
+
+			for (auto& fieldId : fieldIds)
+			{
+				const SerializedEntry& entry = subObject.entries.at(fieldId);
+
+				SPtr<SerializedField> field = std::dynamic_pointer_cast<SerializedField>(entry.serialized);
+				if (field == nullptr)
+					return false;
+
+				// Field name is only there for readability, fields are identified by their IDs
+				RTTIField* rttiField = rtti != nullptr ? rtti->findField(fieldId) : nullptr;
+				const String fieldName = rttiField != nullptr ? rttiField->mName : "unknown";
+
+				lines << "option " << subObject.typeId << " " << fieldId << " " << fieldName;
+				if (field->size > 0)
+					lines << " " << encodeHex(field->value, field->size);
+
+				lines << "\n";
+			}
+		}
+
+		output << lines.str();
+		return true;
+	}
+
+	/** Restores import options from the fields read from the meta file header. Returns null if they can't be decoded. */
+	static SPtr<ImportOptions> readImportOptions(const ProjectFileMetaHeader& header)
+	{
+		SPtr<SerializedObject> serialized = bs_shared_ptr_new<SerializedObject>();
+		for (auto& typeId : header.importOptionsTypeIds)
+		{
+			SerializedSubObject subObject;
+			subObject.typeId = typeId;
+
+			serialized->subObjects.push_back(subObject);
+		}
+
+		for (auto& option : header.importOptions)
+		{
+			auto iterFind = std::find_if(serialized->subObjects.begin(), serialized->subObjects.end(),
+				[&option](const SerializedSubObject& subObject) { return subObject.typeId == option.typeId; });
+
+			if (iterFind == serialized->subObjects.end())
+				return nullptr;
+
+			SPtr<SerializedField> field = bs_shared_ptr_new<SerializedField>();
+			field->size = (UINT32)option.value.size();
+
+			if (field->size > 0)
+			{
+				field->value = (UINT8*)bs_alloc(field->size);
+				field->ownsMemory = true;
+
+				memcpy(field->value, option.value.data(), field->size);
+			}
+
+			SerializedEntry entry;
+			entry.fieldId = option.fieldId;
+			entry.serialized = field;
+
+			iterFind->entries[option.fieldId] = entry;
+		}
+
+		SPtr<IReflectable> object = serialized->decode();
+		if (object == nullptr || !object->isDerivedFrom(ImportOptions::getRTTIStatic()))
+			return nullptr;
+
+		return std::static_pointer_cast<ImportOptions>(object);
+	}
+
+	/** 
+	 * Reads the header from the start of a meta file. On success the stream is left positioned at the start of the
+	 * encoded meta-data following the header.
+	 */
+	static bool readMetaHeader(const SPtr<DataStream>& stream, const char* magic, ProjectFileMetaHeader& header)
+	{
+		const size_t magicLength = strlen(magic);
+
+		// Headers only contain a line per resource, so are read in small chunks until the line preceding the encoded
+		// data is found
+		static constexpr UINT32 CHUNK_SIZE = 512;
+		char chunk[CHUNK_SIZE];
+
+		String text;
+		size_t dataStart = String::npos;
+		while (dataStart == String::npos && !stream->eof())
+		{
+			const size_t numRead = stream->read(chunk, CHUNK_SIZE);
+			if (numRead == 0)
+				break;
+
+			text.append(chunk, numRead);
+
+			if (text.size() >= magicLength && text.compare(0, magicLength, magic) != 0)
+				return false;
+
+			const size_t dataLine = text.find("\ndata ");
+			if (dataLine != String::npos)
+				dataStart = text.find('\n', dataLine + 1);
+		}
+
+		if (dataStart == String::npos)
+			return false;
+
+		Vector<String> lines = StringUtil::split(text.substr(0, dataStart), "\n");
+		for (auto& line : lines)
+		{
+			// Source control might convert line endings on checkout
+			if (!line.empty() && line.back() == '\r')
+				line.pop_back();
+
+			const size_t separator = line.find(' ');
+			if (separator == String::npos)
+				continue;
+
+			const String key = line.substr(0, separator);
+			const String value = line.substr(separator + 1);
+
+			if (key == magic)
+				header.version = parseUINT32(value);
+			else if (key == "includeInBuild")
+				header.includeInBuild = parseBool(value);
+			else if (key == "resource")
+			{
+				// UUID and type ID are followed by the name, which might contain spaces
+				Vector<String> values = StringUtil::split(value, " ", 2);
+				if (values.size() < 2)
+					return false;
+
+				ProjectFileMetaHeader::Resource resource;
+				resource.uuid = UUID(values[0]);
+				resource.typeId = parseUINT32(values[1]);
+
+				const size_t nameStart = value.find(' ', value.find(' ') + 1);
+				if (nameStart != String::npos)
+					resource.name = value.substr(nameStart + 1);
+
+				header.resources.push_back(resource);
+			}
+			else if (key == "importOptions")
+			{
+				for (auto& typeId : StringUtil::split(value, " "))
+					header.importOptionsTypeIds.push_back(parseUINT32(typeId));
+			}
+			else if (key == "option")
+			{
+				// Type and field IDs are followed by the field name, and the value unless it is empty
+				Vector<String> values = StringUtil::split(value, " ");
+				if (values.size() < 3)
+					return false;
+
+				ProjectFileMetaHeader::ImportOption option;
+				option.typeId = parseUINT32(values[0]);
+				option.fieldId = parseUINT32(values[1]);
+
+				if (values.size() > 3 && !decodeHex(values[3], option.value))
+					return false;
+
+				header.importOptions.push_back(option);
+			}
+			else if (key == "data")
+			{
+				Vector<String> values = StringUtil::split(value, " ");
+				if (values.size() < 2)
+					return false;
+
+				header.dataSize = parseUINT32(values[0]);
+				header.dataHash = parseUINT64(values[1]);
+			}
+		}
+
+		stream->seek(dataStart + 1);
+		return true;
+	}
+
+	const char* ProjectFileMeta::HEADER_MAGIC = "BansheeMeta";
+
 	ProjectFileMeta::ProjectFileMeta(const ConstructPrivately& dummy)
 		:mIncludeInBuild(false)
 	{
 
 	}
 
+	ProjectFileMeta::~ProjectFileMeta()
+	{
+		for (auto& entry : mResourceMetaData)
+		{
+			if (entry->mUndecodedOwner == this)
+				entry->mUndecodedOwner = nullptr;
+		}
+	}
+
 	SPtr<ProjectFileMeta> ProjectFileMeta::create(const SPtr<ImportOptions>& importOptions)
 	{
 		SPtr<ProjectFileMeta> meta = bs_shared_ptr_new<ProjectFileMeta>(ConstructPrivately());
@@ -65,16 +480,20 @@ namespace bs
 
 	void ProjectFileMeta::add(const SPtr<ProjectResourceMeta>& resourceMeta)
 	{
+		decode();
 		mResourceMetaData.push_back(resourceMeta);
 	}
 
 	void ProjectFileMeta::addInactive(const SPtr<ProjectResourceMeta>& resourceMeta)
 	{
+		decode();
 		mInactiveResourceMetaData.push_back(resourceMeta);
 	}
 
-	Vector<SPtr<ProjectResourceMeta>> ProjectFileMeta::getAllResourceMetaData() const
+	Vector<SPtr<ProjectResourceMeta>> ProjectFileMeta::getAllResourceMetaData()
 	{
+		decode();
+
 		Vector<SPtr<ProjectResourceMeta>> output(mResourceMetaData);
 
 		for (auto& entry : mInactiveResourceMetaData)
@@ -85,6 +504,8 @@ namespace bs
 
 	void ProjectFileMeta::clearResourceMetaData()
 	{
+		decode();
+
 		mResourceMetaData.clear();
 		mInactiveResourceMetaData.clear();
 	}
@@ -111,6 +532,196 @@ namespace bs
 		return false;
 	}
 
+	void ProjectFileMeta::decode()
+	{
+		if (mUndecodedPath.isEmpty())
+			return;
+
+		const Path path = mUndecodedPath;
+		mUndecodedPath = Path::BLANK;
+
+		for (auto& entry : mResourceMetaData)
+			entry->mUndecodedOwner = nullptr;
+
+		SPtr<ProjectFileMeta> decoded;
+		if (FileSystem::isFile(path))
+		{
+			SPtr<DataStream> stream = FileSystem::openFile(path);
+
+			ProjectFileMetaHeader header;
+			if (readMetaHeader(stream, HEADER_MAGIC, header) && header.version <= HEADER_VERSION)
+			{
+				UINT8* data = (UINT8*)bs_alloc(header.dataSize);
+
+				bool isValid;
+				if (header.version >= 2)
+				{
+					// Meta-data is stored as a single line of base64 text. Only the encoded characters are read, so any
+					// line ending following them doesn't matter.
+					const UINT32 length = getBase64Length(header.dataSize);
+					char* text = (char*)bs_alloc(length);
+
+					const UINT32 numRead = (UINT32)stream->read(text, length);
+					isValid = decodeBase64(text, numRead, data, header.dataSize);
+
+					bs_free(text);
+				}
+				else
+					isValid = (UINT32)stream->read(data, header.dataSize) == header.dataSize;
+
+				if (isValid && hashMetaData(data, header.dataSize) == header.dataHash)
+				{
+					MemorySerializer serializer;
+					SPtr<IReflectable> object = serializer.decode(data, header.dataSize);
+
+					if (object != nullptr && object->isDerivedFrom(ProjectFileMeta::getRTTIStatic()))
+						decoded = std::static_pointer_cast<ProjectFileMeta>(object);
+				}
+
+				// Import options written as text in the header are not part of the encoded meta-data
+				if (decoded != nullptr && !header.importOptionsTypeIds.empty())
+				{
+					decoded->mImportOptions = readImportOptions(header);
+					if (decoded->mImportOptions == nullptr)
+						decoded = nullptr;
+				}
+
+				bs_free(data);
+			}
+
+			stream->close();
+		}
+
+		if (decoded == nullptr)
+		{
+			// Resource UUIDs from the header remain valid, but everything else is lost and must be recreated by reimport
+			mDecodeFailed = true;
+
+			BS_LOG(Warning, Editor, "Unable to decode meta file \"{0}\". The file will be reimported.", path);
+			return;
+		}
+
+		// Resources listed in the header are kept, as they may already be referenced, and receive the decoded data
+		mImportOptions = decoded->mImportOptions;
+		mInactiveResourceMetaData = decoded->mInactiveResourceMetaData;
+
+		for (auto& decodedEntry : decoded->mResourceMetaData)
+		{
+			auto iterFind = std::find_if(mResourceMetaData.begin(), mResourceMetaData.end(), 
+				[&decodedEntry](const SPtr<ProjectResourceMeta>& entry) { return entry->mUUID == decodedEntry->mUUID; });
+
+			if (iterFind == mResourceMetaData.end())
+			{
+				mResourceMetaData.push_back(decodedEntry);
+				continue;
+			}
+
+			ProjectResourceMeta& entry = **iterFind;
+			entry.mResourceMeta = decodedEntry->mResourceMeta;
+			entry.mPreviewIcons = decodedEntry->mPreviewIcons;
+			entry.mUserData = decodedEntry->mUserData;
+		}
+	}
+
+	void ProjectFileMeta::save(const Path& path)
+	{
+		decode();
+
+		// Import options are written to the header as text when possible, and excluded from the encoded meta-data
+		StringStream importOptionsText;
+		const SPtr<ImportOptions> importOptions = mImportOptions;
+		if (importOptions != nullptr && writeImportOptions(*importOptions, importOptionsText))
+			mImportOptions = nullptr;
+
+		MemorySerializer serializer;
+		UINT32 dataSize = 0;
+		UINT8* data = serializer.encode(this, dataSize);
+
+		mImportOptions = importOptions;
+
+		// Entire file is plain text so source control treats it as such. Header lists the contained resources and import
+		// options a line each, so changes to them can be diffed and merged, while the rest of the meta-data is stored as
+		// a single base64 line.
+		StringStream header;
+		header << HEADER_MAGIC << " " << HEADER_VERSION << "\n";
+		header << "includeInBuild " << toString(mIncludeInBuild) << "\n";
+
+		for (auto& entry : mResourceMetaData)
+		{
+			header << "resource " << entry->getUUID().toString() << " " << entry->getTypeID() << " " 
+				<< entry->getUniqueName() << "\n";
+		}
+
+		header << importOptionsText.str();
+		header << "data " << dataSize << " " << hashMetaData(data, dataSize) << "\n";
+
+		const String headerText = header.str();
+		const String dataText = encodeBase64(data, dataSize) + "\n";
+
+		SPtr<DataStream> stream = FileSystem::createAndOpenFile(path);
+		stream->write(headerText.data(), headerText.size());
+		stream->write(dataText.data(), dataText.size());
+		stream->close();
+
+		bs_free(data);
+	}
+
+	SPtr<ProjectFileMeta> ProjectFileMeta::load(const Path& path)
+	{
+		if (!FileSystem::isFile(path))
+			return nullptr;
+
+		ProjectFileMetaHeader header;
+		bool hasHeader;
+		{
+			SPtr<DataStream> stream = FileSystem::openFile(path);
+			hasHeader = readMetaHeader(stream, HEADER_MAGIC, header);
+			stream->close();
+		}
+
+		// Meta files written before the header was introduced
+		if (!hasHeader)
+		{
+			FileDecoder fs(path);
+			SPtr<IReflectable> loadedMeta = fs.decode();
+
+			if (loadedMeta != nullptr && loadedMeta->isDerivedFrom(ProjectFileMeta::getRTTIStatic()))
+				return std::static_pointer_cast<ProjectFileMeta>(loadedMeta);
+
+			return nullptr;
+		}
+
+		if (header.version > HEADER_VERSION)
+		{
+			BS_LOG(Error, Editor, "Meta file \"{0}\" was saved by a newer version (format {1}, supported {2}) and cannot "
+				"be loaded.", path, header.version, HEADER_VERSION);
+			return nullptr;
+		}
+
+		SPtr<ProjectFileMeta> meta = createEmpty();
+		meta->mIncludeInBuild = header.includeInBuild;
+		meta->mUndecodedPath = path;
+
+		for (auto& entry : header.resources)
+		{
+			SPtr<ProjectResourceMeta> resourceMeta = ProjectResourceMeta::createEmpty();
+			resourceMeta->mName = UTF8::toWide(entry.name);
+			resourceMeta->mUUID = entry.uuid;
+			resourceMeta->mTypeId = entry.typeId;
+			resourceMeta->mUndecodedOwner = meta.get();
+
+			meta->mResourceMetaData.push_back(resourceMeta);
+		}
+
+		return meta;
+	}
+
+	void ProjectFileMeta::_notifyMoved(const Path& path)
+	{
+		if (!mUndecodedPath.isEmpty())
+			mUndecodedPath = path;
+	}
+
 	SPtr<ProjectFileMeta> ProjectFileMeta::createEmpty()
 	{
 		return bs_shared_ptr_new<ProjectFileMeta>(ConstructPrivately());
@@ -24,6 +24,8 @@ namespace bs
 		HTexture icon256;
 	};
 
+	class ProjectFileMeta;
+
 	/**	Contains meta-data for a resource stored in the ProjectLibrary. */
 	class BS_ED_EXPORT ProjectResourceMeta : public IReflectable
 	{
@@ -53,25 +55,29 @@ namespace bs
 		const UUID& getUUID() const { return mUUID; }
 
 		/**	Returns the non-project library specific meta-data. */
-		SPtr<ResourceMetaData> getResourceMetaData() const { return mResourceMeta; }
+		SPtr<ResourceMetaData> getResourceMetaData() const;
 
 		/**	Returns the RTTI type ID of the resource this object is referencing. */
 		UINT32 getTypeID() const { return mTypeId; }
 
 		/** @copydoc setPreviewIcons() */
-		const ProjectResourceIcons& getPreviewIcons() const { return mPreviewIcons; }
+		const ProjectResourceIcons& getPreviewIcons() const;
 
 		/* A set of icons used for displaying a preview of the resource's contents. */
-		void setPreviewIcons(const ProjectResourceIcons& icons) { mPreviewIcons = icons; }
+		void setPreviewIcons(const ProjectResourceIcons& icons);
 
 		/** 
 		 * Returns additional data attached to the resource meta by the user. This is non-specific data and can contain
 		 * anything the user requires. 
 		 */
-		SPtr<IReflectable> getUserData() const { return mUserData; }
+		SPtr<IReflectable> getUserData() const;
 
 	private:
 		friend class ProjectLibrary;
+		friend class ProjectFileMeta;
+
+		/** Decodes the parts of the meta-data that are only read from the meta file on first access. */
+		void decode() const;
 
 		WString mName;
 		UUID mUUID;
@@ -80,6 +86,9 @@ namespace bs
 		ProjectResourceIcons mPreviewIcons;
 		SPtr<IReflectable> mUserData;
 
+		/** File meta-data responsible for decoding this object's data, if it hasn't been decoded yet. */
+		ProjectFileMeta* mUndecodedOwner = nullptr;
+
 		/************************************************************************/
 		/* 								RTTI		                     		*/
 		/************************************************************************/
@@ -104,6 +113,7 @@ namespace bs
 
 	public:
 		explicit ProjectFileMeta(const ConstructPrivately&);
+		~ProjectFileMeta();
 
 		/**
 		 * Creates a new project library file meta-data entry.
@@ -122,14 +132,17 @@ namespace bs
 		 */
 		void addInactive(const SPtr<ProjectResourceMeta>& resourceMeta);
 
-		/** Returns meta-data for all active resources contained in the file represented by this meta-data object.  */
+		/** 
+		 * Returns meta-data for all active resources contained in the file represented by this meta-data object. Names,
+		 * UUIDs and type IDs of the returned resources never require the meta file to be decoded.
+		 */
 		const Vector<SPtr<ProjectResourceMeta>>& getResourceMetaData() const { return mResourceMetaData; }
 
 		/** 
 		 * Returns meta-data for all resources (both active and inactive) contained in the file represented by this
 		 * meta-data object.  
 		 */
-		Vector<SPtr<ProjectResourceMeta>> getAllResourceMetaData() const;
+		Vector<SPtr<ProjectResourceMeta>> getAllResourceMetaData();
 
 		/** 
 		 * Removes all resource meta-data stored by this object. This includes meta-data for both active and inactive
@@ -138,7 +151,7 @@ namespace bs
 		void clearResourceMetaData();
 
 		/**	Returns the import options used for importing the resource this object is referencing. */
-		const SPtr<ImportOptions>& getImportOptions() const { return mImportOptions; }
+		const SPtr<ImportOptions>& getImportOptions() { decode(); return mImportOptions; }
 
 		/** Checks should this resource always be included in the build, regardless if it's being referenced or not. */
 		bool getIncludeInBuild() const { return mIncludeInBuild; }
@@ -152,14 +165,66 @@ namespace bs
 		/** Checks does the file contain a resource with the specified UUID. */
 		bool hasUUID(const UUID& uuid) const;
 
+		/** 
+		 * Decodes all the meta-data that was skipped when the meta file was loaded. Called automatically when accessing
+		 * such data, but must be called before modifying the meta-data directly.
+		 */
+		void decode();
+
+		/** Checks has all the meta-data been decoded. */
+		bool isDecoded() const { return mUndecodedPath.isEmpty(); }
+
+		/** 
+		 * Checks did decoding of the meta-data fail, for example due to the meta file being corrupted. Such meta-data is
+		 * missing import options, resource meta-data and preview icons, and its file should be reimported.
+		 */
+		bool hasDecodeFailed() const { return mDecodeFailed; }
+
+		/**
+		 * Saves the meta-data to a meta file at the specified path. The file begins with a short text header listing
+		 * the UUIDs and type IDs of all contained resources and the import options, one field per line. It is followed by
+		 * a line containing the rest of the meta-data, base64 encoded.
+		 */
+		void save(const Path& path);
+
+		/**
+		 * Loads the meta-data from a meta file at the specified path. Only the header of the meta file is read, and the
+		 * rest is decoded on first access. Meta files from older versions without a header are decoded in full.
+		 *
+		 * @return	Loaded meta-data, or null if the file doesn't exist, isn't a valid meta file or was written by a
+		 *			newer version.
+		 */
+		static SPtr<ProjectFileMeta> load(const Path& path);
+
+		/** @name Internal
+		 *  @{
+		 */
+
+		/** Notifies the meta-data that its meta file moved, so it can be decoded from the new location. */
+		void _notifyMoved(const Path& path);
+
+		/** @} */
 	private:
 		friend class ProjectLibrary;
 
+		/** Magic string that starts the header of every meta file written by save(). */
+		static const char* HEADER_MAGIC;
+
+		/** 
+		 * Version of the meta file format. Version 1 stored the meta-data following the header as raw binary, version 2 
+		 * encodes it in base64 so the entire file is text, and version 3 writes import options to the header.
+		 */
+		static constexpr UINT32 HEADER_VERSION = 3;
+
 		Vector<SPtr<ProjectResourceMeta>> mResourceMetaData;
 		Vector<SPtr<ProjectResourceMeta>> mInactiveResourceMetaData;
 		SPtr<ImportOptions> mImportOptions;
 		bool mIncludeInBuild;
 
+		/** Path to the meta file the rest of the meta-data should be decoded from. Empty if already decoded. */
+		Path mUndecodedPath;
+		bool mDecodeFailed = false;
+
 		/************************************************************************/
 		/* 								RTTI		                     		*/
 		/************************************************************************/
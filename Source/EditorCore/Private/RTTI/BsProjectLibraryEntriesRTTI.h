@@ -68,12 +68,15 @@ namespace bs
 			memory = rttiWriteElem(data.path, memory, size);
 			memory = rttiWriteElem(elemName, memory, size);
 			memory = rttiWriteElem(data.lastUpdateTime, memory, size);
+			memory = rttiWriteElem(data.dependencies, memory, size);
 
 			memcpy(memoryStart, &size, sizeof(UINT32));
 		}
 
 		static UINT32 fromMemory(ProjectLibrary::FileEntry& data, char* memory)
 		{ 
+			char* memoryStart = memory;
+
 			UINT32 size = 0;
 			memcpy(&size, memory, sizeof(UINT32));
 			memory += sizeof(UINT32);
@@ -91,6 +94,13 @@ namespace bs
 
 			memory = rttiReadElem(data.lastUpdateTime, memory);
 
+			// Entries saved before dependencies were stored end here, and their dependencies must be found again
+			if ((UINT32)(memory - memoryStart) < size)
+			{
+				memory = rttiReadElem(data.dependencies, memory);
+				data.hasDependencies = true;
+			}
+
 			return size;
 		}
 
@@ -99,7 +109,7 @@ namespace bs
 			WString elemName = UTF8::toWide(data.elementName);
 
 			UINT64 dataSize = sizeof(UINT32) + rttiGetElemSize(data.type) + rttiGetElemSize(data.path) + 
-				rttiGetElemSize(elemName) + rttiGetElemSize(data.lastUpdateTime);
+				rttiGetElemSize(elemName) + rttiGetElemSize(data.lastUpdateTime) + rttiGetElemSize(data.dependencies);
 
 #if BS_DEBUG_MODE
 			if(dataSize > std::numeric_limits<UINT32>::max())
@@ -82,6 +82,13 @@ namespace bs
 				RTTIFieldInfo(RTTIFieldFlag::SkipInReferenceSearch));
 		}
 
+		void onSerializationStarted(IReflectable* obj, SerializationContext* context) override
+		{
+			// Data that wasn't decoded from the meta file yet must be decoded before it can be encoded again
+			ProjectResourceMeta* meta = static_cast<ProjectResourceMeta*>(obj);
+			meta->decode();
+		}
+
 		const String& getRTTIName() override
 		{
 			static String name = "ProjectResourceMeta";
@@ -110,6 +117,13 @@ namespace bs
 		BS_END_RTTI_MEMBERS
 
 	public:
+		void onSerializationStarted(IReflectable* obj, SerializationContext* context) override
+		{
+			// Data that wasn't decoded from the meta file yet must be decoded before it can be encoded again
+			ProjectFileMeta* meta = static_cast<ProjectFileMeta*>(obj);
+			meta->decode();
+		}
+
 		const String& getRTTIName() override
 		{
 			static String name = "ProjectFileMeta";
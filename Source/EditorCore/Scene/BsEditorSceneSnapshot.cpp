@@ -0,0 +1,98 @@
+//********************************** Banshee Engine (www.banshee3d.com) **************************************************//
+//**************** Copyright (c) 2019 Marko Pintera (marko.pintera@gmail.com). All rights reserved. **********************//
+#include "Scene/BsEditorSceneSnapshot.h"
+#include "Scene/BsSelection.h"
+#include "Scene/BsSceneObject.h"
+#include "Scene/BsSceneManager.h"
+#include "Components/BsCRenderable.h"
+#include "Renderer/BsRenderable.h"
+#include "Mesh/BsMesh.h"
+#include "Utility/BsTime.h"
+#include "Utility/BsEditorProfiler.h"
+
+namespace bs
+{
+	EditorSceneSnapshot::EditorSceneSnapshot()
+	{
+		mSelectionChangedConn = Selection::instance().onSelectionChanged.connect(
+			[this](const Vector<HSceneObject>&, const Vector<Path>&) { mDirty = true; });
+	}
+
+	EditorSceneSnapshot::~EditorSceneSnapshot()
+	{
+		mSelectionChangedConn.disconnect();
+	}
+
+	const Vector<EditorSnapshotRenderable>& EditorSceneSnapshot::getRenderables()
+	{
+		refresh();
+		return mRenderables;
+	}
+
+	const Vector<SPtr<ct::Renderable>>& EditorSceneSnapshot::getSelectedRenderables()
+	{
+		refresh();
+		return mSelectedRenderables;
+	}
+
+	const Vector<HSceneObject>& EditorSceneSnapshot::getSelection()
+	{
+		refresh();
+		return mSelection;
+	}
+
+	bool EditorSceneSnapshot::isSelected(const HSceneObject& sceneObject)
+	{
+		refresh();
+		return mSelectedIds.find(sceneObject.getInstanceId()) != mSelectedIds.end();
+	}
+
+	bool EditorSceneSnapshot::isDone(const void* id)
+	{
+		refresh();
+		return !mCompletedWork.insert(id).second;
+	}
+
+	void EditorSceneSnapshot::refresh()
+	{
+		const UINT64 frameIdx = gTime().getFrameIdx();
+		if (!mDirty && frameIdx == mFrameIdx)
+			return;
+
+		BS_EDITOR_PROFILE_SCOPE("Scene", "EditorSceneSnapshot::refresh");
+
+		mRenderables.clear();
+		mSelectedRenderables.clear();
+		mSelectedIds.clear();
+		mCompletedWork.clear();
+
+		mSelection = Selection::instance().getSceneObjects();
+		for (auto& so : mSelection)
+			mSelectedIds.insert(so.getInstanceId());
+
+		Vector<HRenderable> renderables = gSceneManager().findComponents<CRenderable>(true);
+		for (auto& renderable : renderables)
+		{
+			HMesh mesh = renderable->getMesh();
+			if (!mesh.isLoaded())
+				continue;
+
+			EditorSnapshotRenderable entry;
+			entry.renderable = renderable;
+			entry.sceneObject = renderable->SO();
+			entry.mesh = mesh;
+			entry.worldTransform = entry.sceneObject->getWorldMatrix();
+			entry.worldBounds = mesh->getProperties().getBounds();
+			entry.worldBounds.transformAffine(entry.worldTransform);
+			entry.isSelected = mSelectedIds.find(entry.sceneObject.getInstanceId()) != mSelectedIds.end();
+
+			if (entry.isSelected)
+				mSelectedRenderables.push_back(renderable->_getInternal()->getCore());
+
+			mRenderables.push_back(entry);
+		}
+
+		mFrameIdx = frameIdx;
+		mDirty = false;
+	}
+}
@@ -0,0 +1,82 @@
+//********************************** Banshee Engine (www.banshee3d.com) **************************************************//
+//**************** Copyright (c) 2019 Marko Pintera (marko.pintera@gmail.com). All rights reserved. **********************//
+#pragma once
+
+#include "BsEditorPrerequisites.h"
+#include "Utility/BsModule.h"
+#include "Math/BsBounds.h"
+#include "Math/BsMatrix4.h"
+
+namespace bs
+{
+	/** @addtogroup Scene-Editor
+	 *  @{
+	 */
+
+	/** Information about a single renderable in the scene, as captured by EditorSceneSnapshot. */
+	struct EditorSnapshotRenderable
+	{
+		HRenderable renderable;
+		HSceneObject sceneObject;
+		HMesh mesh; /**< Mesh of the renderable. Always loaded at the time the snapshot was taken. */
+		Matrix4 worldTransform;
+		Bounds worldBounds;
+		bool isSelected = false;
+	};
+
+	/**
+	 * Read-only view of the scene state shared by all scene views (and other editor cameras) during a single frame.
+	 * Everything that doesn't depend on the camera (the list of renderables and their world bounds, current selection) is
+	 * gathered once, on first access during a frame, and all the views then only perform view dependent work (culling,
+	 * sorting) on top of it. The snapshot is also rebuilt if the selection changes mid-frame, or if explicitly marked
+	 * dirty through markDirty().
+	 */
+	class BS_ED_EXPORT EditorSceneSnapshot : public Module<EditorSceneSnapshot>
+	{
+	public:
+		EditorSceneSnapshot();
+		~EditorSceneSnapshot();
+
+		/** Returns all renderables in the main scene that have a loaded mesh. */
+		const Vector<EditorSnapshotRenderable>& getRenderables();
+
+		/** Returns core thread versions of all the renderables in getRenderables() that are selected. */
+		const Vector<SPtr<ct::Renderable>>& getSelectedRenderables();
+
+		/** Returns the currently selected scene objects. */
+		const Vector<HSceneObject>& getSelection();
+
+		/** Checks is the provided scene object directly selected. Doesn't consider selection of its parents. */
+		bool isSelected(const HSceneObject& sceneObject);
+
+		/**
+		 * Checks has the caller already performed the work identified by @p id during the current snapshot. Returns false
+		 * (and records the work as done) on the first call in a frame, and true on any subsequent calls. Used for
+		 * ensuring view independent work triggered from multiple views (e.g. gizmo generation) only runs once per frame.
+		 */
+		bool isDone(const void* id);
+
+		/** Forces the snapshot to be rebuilt on next access. Should be called if the scene changes mid-frame. */
+		void markDirty() { mDirty = true; }
+
+		/** Returns the index of the frame the snapshot was last built on. */
+		UINT64 getFrameIdx() const { return mFrameIdx; }
+
+	private:
+		/** Rebuilds the snapshot if it is out of date. */
+		void refresh();
+
+		Vector<EditorSnapshotRenderable> mRenderables;
+		Vector<SPtr<ct::Renderable>> mSelectedRenderables;
+		Vector<HSceneObject> mSelection;
+		UnorderedSet<UINT64> mSelectedIds;
+		UnorderedSet<const void*> mCompletedWork;
+
+		UINT64 mFrameIdx = 0;
+		bool mDirty = true;
+
+		HEvent mSelectionChangedConn;
+	};
+
+	/** @} */
+}
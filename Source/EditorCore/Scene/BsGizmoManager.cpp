@@ -14,10 +14,11 @@
 #include "RenderAPI/BsGpuParams.h"
 #include "Material/BsGpuParamsSet.h"
 #include "RenderAPI/BsRenderAPI.h"
+#include "RenderAPI/BsGpuBuffer.h"
 #include "Renderer/BsRenderer.h"
 #include "Renderer/BsRendererUtility.h"
 #include "Renderer/BsRendererManager.h"
-#include "Utility/BsDrawHelper.h"
+#include "Utility/BsEditorProfiler.h"
 
 using namespace std::placeholders;
 
@@ -28,6 +29,12 @@ namespace bs
 	const UINT32 GizmoManager::OPTIMAL_ICON_SIZE = 64;
 	const float GizmoManager::ICON_TEXEL_WORLD_SIZE = 0.015f;
 
+	/** Checks can a primitive of the provided color be drawn using instancing, without needing to be depth sorted. */
+	static bool isOpaque(const Color& color)
+	{
+		return color.a >= 1.0f;
+	}
+
 	GizmoManager::GizmoManager()
 	{
 		mTransform = Matrix4::IDENTITY;
@@ -47,6 +54,9 @@ namespace bs
 		HMaterial textMaterial = BuiltinEditorResources::instance().createTextGizmoMat();
 		HMaterial pickingMaterial = BuiltinEditorResources::instance().createGizmoPickingMat();
 		HMaterial alphaPickingMaterial = BuiltinEditorResources::instance().createAlphaGizmoPickingMat();
+		HMaterial solidInstancedMaterial = BuiltinEditorResources::instance().createSolidGizmoInstancedMat();
+		HMaterial lineInstancedMaterial = BuiltinEditorResources::instance().createLineGizmoInstancedMat();
+		HMaterial pickingInstancedMaterial = BuiltinEditorResources::instance().createGizmoPickingInstancedMat();
 
 		CoreInitData initData;
 
@@ -57,6 +67,15 @@ namespace bs
 		initData.textMat = textMaterial->getCore();
 		initData.pickingMat = pickingMaterial->getCore();
 		initData.alphaPickingMat = alphaPickingMaterial->getCore();
+		initData.solidInstancedMat = solidInstancedMaterial->getCore();
+		initData.lineInstancedMat = lineInstancedMaterial->getCore();
+		initData.pickingInstancedMat = pickingInstancedMaterial->getCore();
+
+		for (UINT32 i = 0; i < (UINT32)InstancedGizmoType::Count; i++)
+		{
+			mInstancedMeshes[i] = createInstancedMesh((InstancedGizmoType)i);
+			initData.instancedMeshes[i] = mInstancedMeshes[i]->getCore();
+		}
 
 		mGizmoRenderer = RendererExtension::create<ct::GizmoRenderer>(initData);
 	}
@@ -64,6 +83,7 @@ namespace bs
 	GizmoManager::~GizmoManager()
 	{
 		mActiveMeshes.clear();
+		mMeshCache.clear();
 
 		bs_delete(mDrawHelper);
 		bs_delete(mPickingDrawHelper);
@@ -77,6 +97,7 @@ namespace bs
 		{
 			mTransform = Matrix4::IDENTITY;
 			mDrawHelper->setTransform(Matrix4::IDENTITY);
+			mMeshCache.record("setTransform", Matrix4::IDENTITY);
 			mTransformDirty = false;
 		}
 
@@ -95,6 +116,7 @@ namespace bs
 	void GizmoManager::setColor(const Color& color)
 	{
 		mDrawHelper->setColor(color);
+		mMeshCache.record("setColor", color);
 		mColor = color;
 
 		mColorDirty = true;
@@ -103,6 +125,7 @@ namespace bs
 	void GizmoManager::setTransform(const Matrix4& transform)
 	{
 		mDrawHelper->setTransform(transform);
+		mMeshCache.record("setTransform", transform);
 		mTransform = transform;
 
 		mTransformDirty = true;
@@ -121,8 +144,14 @@ namespace bs
 		cubeData.sceneObject = mActiveSO;
 		cubeData.pickable = mPickable;
 
-		mDrawHelper->cube(position, extents);
 		mIdxToSceneObjectMap[cubeData.idx] = mActiveSO;
+
+		// Instances are drawn before the sorted meshes, translucent primitives need to be sorted with the rest
+		if (!isOpaque(mColor))
+		{
+			mDrawHelper->cube(position, extents);
+			mMeshCache.record("cube", position, extents);
+		}
 	}
 
 	void GizmoManager::drawSphere(const Vector3& position, float radius)
@@ -138,8 +167,13 @@ namespace bs
 		sphereData.sceneObject = mActiveSO;
 		sphereData.pickable = mPickable;
 
-		mDrawHelper->sphere(position, radius);
 		mIdxToSceneObjectMap[sphereData.idx] = mActiveSO;
+
+		if (!isOpaque(mColor))
+		{
+			mDrawHelper->sphere(position, radius);
+			mMeshCache.record("sphere", position, radius);
+		}
 	}
 
 	void GizmoManager::drawCone(const Vector3& base, const Vector3& normal, float height, float radius, const Vector2& scale)
@@ -157,6 +191,7 @@ namespace bs
 		coneData.scale = scale;
 
 		mDrawHelper->cone(base, normal, height, radius, scale);
+		mMeshCache.record("cone", base, normal, height, radius, scale);
 		mIdxToSceneObjectMap[coneData.idx] = mActiveSO;
 	}
 
@@ -175,6 +210,7 @@ namespace bs
 		discData.pickable = mPickable;
 
 		mDrawHelper->disc(position, normal, radius);
+		mMeshCache.record("disc", position, normal, radius);
 		mIdxToSceneObjectMap[discData.idx] = mActiveSO;
 	}
 
@@ -191,8 +227,13 @@ namespace bs
 		cubeData.sceneObject = mActiveSO;
 		cubeData.pickable = mPickable;
 
-		mDrawHelper->wireCube(position, extents);
 		mIdxToSceneObjectMap[cubeData.idx] = mActiveSO;
+
+		if (!isOpaque(mColor))
+		{
+			mDrawHelper->wireCube(position, extents);
+			mMeshCache.record("wireCube", position, extents);
+		}
 	}
 
 	void GizmoManager::drawWireSphere(const Vector3& position, float radius)
@@ -208,8 +249,13 @@ namespace bs
 		sphereData.sceneObject = mActiveSO;
 		sphereData.pickable = mPickable;
 
-		mDrawHelper->wireSphere(position, radius);
 		mIdxToSceneObjectMap[sphereData.idx] = mActiveSO;
+
+		if (!isOpaque(mColor))
+		{
+			mDrawHelper->wireSphere(position, radius);
+			mMeshCache.record("wireSphere", position, radius);
+		}
 	}
 
 	void GizmoManager::drawWireHemisphere(const Vector3& position, float radius)
@@ -226,6 +272,7 @@ namespace bs
 		sphereData.pickable = mPickable;
 
 		mDrawHelper->wireHemisphere(position, radius);
+		mMeshCache.record("wireHemisphere", position, radius);
 		mIdxToSceneObjectMap[sphereData.idx] = mActiveSO;
 	}
 
@@ -280,6 +327,7 @@ namespace bs
 		coneData.scale = scale;
 
 		mDrawHelper->wireCone(base, normal, height, radius, scale);
+		mMeshCache.record("wireCone", base, normal, height, radius, scale);
 		mIdxToSceneObjectMap[coneData.idx] = mActiveSO;
 	}
 
@@ -297,6 +345,7 @@ namespace bs
 		lineData.pickable = mPickable;
 
 		mDrawHelper->line(start, end);
+		mMeshCache.record("line", start, end);
 		mIdxToSceneObjectMap[lineData.idx] = mActiveSO;
 	}
 
@@ -313,6 +362,7 @@ namespace bs
 		lineListData.pickable = mPickable;
 
 		mDrawHelper->lineList(linePoints);
+		mMeshCache.record("lineList", linePoints);
 		mIdxToSceneObjectMap[lineListData.idx] = mActiveSO;
 	}
 
@@ -331,6 +381,7 @@ namespace bs
 		wireDiscData.pickable = mPickable;
 
 		mDrawHelper->wireDisc(position, normal, radius);
+		mMeshCache.record("wireDisc", position, normal, radius);
 		mIdxToSceneObjectMap[wireDiscData.idx] = mActiveSO;
 	}
 
@@ -352,6 +403,7 @@ namespace bs
 		wireArcData.pickable = mPickable;
 
 		mDrawHelper->wireArc(position, normal, radius, startAngle, amountAngle);
+		mMeshCache.record("wireArc", position, normal, radius, startAngle, amountAngle);
 		mIdxToSceneObjectMap[wireArcData.idx] = mActiveSO;
 	}
 
@@ -368,6 +420,7 @@ namespace bs
 		wireMeshData.pickable = mPickable;
 
 		mDrawHelper->wireMesh(meshData);
+		mMeshCache.record("wireMesh", meshData);
 		mIdxToSceneObjectMap[wireMeshData.idx] = mActiveSO;
 	}
 
@@ -388,6 +441,7 @@ namespace bs
 		frustumData.pickable = mPickable;
 
 		mDrawHelper->frustum(position, aspect, FOV, near, far);
+		mMeshCache.record("frustum", position, aspect, FOV, near, far);
 		mIdxToSceneObjectMap[frustumData.idx] = mActiveSO;
 	}
 
@@ -405,6 +459,7 @@ namespace bs
 		iconData.sceneObject = mActiveSO;
 		iconData.pickable = mPickable;
 
+		mIconCommands.record("icon", position, image, fixedScale, mColor, mTransform);
 		mIdxToSceneObjectMap[iconData.idx] = mActiveSO;
 	}
 
@@ -428,6 +483,7 @@ namespace bs
 		textData.pickable = mPickable;
 
 		mDrawHelper->text(position, text, myFont, fontSize);
+		mMeshCache.record("text", position, text, myFont, fontSize);
 		mIdxToSceneObjectMap[textData.idx] = mActiveSO;
 	}
 
@@ -453,78 +509,155 @@ namespace bs
 		return proxyData;
 	}
 
-	void GizmoManager::update(const SPtr<Camera>& camera, const GizmoDrawSettings& drawSettings)
+	GizmoManager::InstanceRenderDataPtr GizmoManager::createInstanceData(
+		const std::function<Color(UINT32)>& idxToColorCallback) const
 	{
-		mActiveMeshes.clear();
-		mActiveMeshes = mDrawHelper->buildMeshes(DrawHelper::SortType::BackToFront, camera.get());
+		InstanceRenderDataPtr output = bs_shared_ptr_new<InstanceRenderData>();
 
-		Vector<MeshRenderData> proxyData = createMeshProxyData(mActiveMeshes);
-		IconRenderDataVecPtr iconRenderData;
-		mIconMesh = buildIconMesh(camera, drawSettings, mIconData, false, iconRenderData);
+		const auto addInstance = [&](InstancedGizmoType type, const CommonData& data, const Vector3& position,
+			const Vector3& scale)
+		{
+			if (idxToColorCallback ? !data.pickable : !isOpaque(data.color))
+				return;
 
-		SPtr<ct::MeshBase> iconMesh;
-		if(mIconMesh != nullptr)
-			iconMesh = mIconMesh->getCore();
+			const Matrix4 transform = data.transform * Matrix4::TRS(position, Quaternion::IDENTITY, scale);
 
-		ct::GizmoRenderer* renderer = mGizmoRenderer.get();
+			InstanceData instance;
+			for (UINT32 i = 0; i < 3; i++)
+				instance.transform[i] = Vector4(transform[i][0], transform[i][1], transform[i][2], transform[i][3]);
 
-		gCoreThread().queueCommand(std::bind(&ct::GizmoRenderer::updateData, renderer, camera->getCore(),
-			proxyData, iconMesh, iconRenderData));
+			// Picking colors only use 8 bits per channel, so they survive packing unchanged
+			const Color color = idxToColorCallback ? idxToColorCallback(data.idx) : data.color;
+			instance.color = color.getAsRGBA();
+			output->instances[(UINT32)type].push_back(instance);
+		};
+
+		output->instances[(UINT32)InstancedGizmoType::SolidCube].reserve(mSolidCubeData.size());
+		for (auto& entry : mSolidCubeData)
+			addInstance(InstancedGizmoType::SolidCube, entry, entry.position, entry.extents);
+
+		output->instances[(UINT32)InstancedGizmoType::WireCube].reserve(mWireCubeData.size());
+		for (auto& entry : mWireCubeData)
+			addInstance(InstancedGizmoType::WireCube, entry, entry.position, entry.extents);
+
+		output->instances[(UINT32)InstancedGizmoType::SolidSphere].reserve(mSolidSphereData.size());
+		for (auto& entry : mSolidSphereData)
+			addInstance(InstancedGizmoType::SolidSphere, entry, entry.position, Vector3(entry.radius, entry.radius, entry.radius));
+
+		output->instances[(UINT32)InstancedGizmoType::WireSphere].reserve(mWireSphereData.size());
+		for (auto& entry : mWireSphereData)
+			addInstance(InstancedGizmoType::WireSphere, entry, entry.position, Vector3(entry.radius, entry.radius, entry.radius));
+
+		return output;
 	}
 
-	void GizmoManager::renderForPicking(const SPtr<Camera>& camera, const GizmoDrawSettings& drawSettings, 
-		std::function<Color(UINT32)> idxToColorCallback)
+	SPtr<Mesh> GizmoManager::createInstancedMesh(InstancedGizmoType type)
 	{
-		Vector<IconData> iconData;
-		IconRenderDataVecPtr iconRenderData;
+		const bool solid = type == InstancedGizmoType::SolidCube || type == InstancedGizmoType::SolidSphere;
 
-		mPickingDrawHelper->clear();
+		SPtr<VertexDataDesc> vertexDesc = bs_shared_ptr_new<VertexDataDesc>();
+		vertexDesc->addVertElem(VET_FLOAT3, VES_POSITION);
 
-		for (auto& cubeDataEntry : mSolidCubeData)
+		if (solid)
+			vertexDesc->addVertElem(VET_FLOAT3, VES_NORMAL);
+
+		UINT32 numVertices = 0;
+		UINT32 numIndices = 0;
+		switch (type)
 		{
-			if (!cubeDataEntry.pickable)
-				continue;
+		case InstancedGizmoType::SolidCube:
+			ShapeMeshes3D::getNumElementsAABox(numVertices, numIndices);
+			break;
+		case InstancedGizmoType::WireCube:
+			ShapeMeshes3D::getNumElementsWireAABox(numVertices, numIndices);
+			break;
+		case InstancedGizmoType::SolidSphere:
+			ShapeMeshes3D::getNumElementsSphere(SPHERE_QUALITY, numVertices, numIndices);
+			break;
+		case InstancedGizmoType::WireSphere:
+			ShapeMeshes3D::getNumElementsWireSphere(WIRE_SPHERE_QUALITY, numVertices, numIndices);
+			break;
+		default:
+			break;
+		}
 
-			mPickingDrawHelper->setColor(idxToColorCallback(cubeDataEntry.idx));
-			mPickingDrawHelper->setTransform(cubeDataEntry.transform);
+		SPtr<MeshData> meshData = bs_shared_ptr_new<MeshData>(numVertices, numIndices, vertexDesc);
 
-			mPickingDrawHelper->cube(cubeDataEntry.position, cubeDataEntry.extents);
-		}
+		// Primitives are of unit size, instance transforms scale them to the requested extents or radius
+		const AABox unitBox(-Vector3::ONE, Vector3::ONE);
+		const Sphere unitSphere(Vector3::ZERO, 1.0f);
 
-		for (auto& cubeDataEntry : mWireCubeData)
+		switch (type)
 		{
-			if (!cubeDataEntry.pickable)
-				continue;
+		case InstancedGizmoType::SolidCube:
+			ShapeMeshes3D::solidAABox(unitBox, meshData, 0, 0);
+			break;
+		case InstancedGizmoType::WireCube:
+			ShapeMeshes3D::wireAABox(unitBox, meshData, 0, 0);
+			break;
+		case InstancedGizmoType::SolidSphere:
+			ShapeMeshes3D::solidSphere(unitSphere, meshData, 0, 0, SPHERE_QUALITY);
+			break;
+		case InstancedGizmoType::WireSphere:
+			ShapeMeshes3D::wireSphere(unitSphere, meshData, 0, 0, WIRE_SPHERE_QUALITY);
+			break;
+		default:
+			break;
+		}
 
-			mPickingDrawHelper->setColor(idxToColorCallback(cubeDataEntry.idx));
-			mPickingDrawHelper->setTransform(cubeDataEntry.transform);
+		MESH_DESC meshDesc;
+		meshDesc.numVertices = numVertices;
+		meshDesc.numIndices = numIndices;
+		meshDesc.vertexDesc = vertexDesc;
+		meshDesc.subMeshes.push_back(SubMesh(0, numIndices, solid ? DOT_TRIANGLE_LIST : DOT_LINE_LIST));
 
-			mPickingDrawHelper->wireCube(cubeDataEntry.position, cubeDataEntry.extents);
-		}
+		return Mesh::_createPtr(meshData, meshDesc);
+	}
 
-		for (auto& sphereDataEntry : mSolidSphereData)
-		{
-			if (!sphereDataEntry.pickable)
-				continue;
+	void GizmoManager::update(const SPtr<Camera>& camera, const GizmoDrawSettings& drawSettings)
+	{
+		BS_EDITOR_PROFILE_SCOPE("Gizmos", "GizmoManager::update");
 
-			mPickingDrawHelper->setColor(idxToColorCallback(sphereDataEntry.idx));
-			mPickingDrawHelper->setTransform(sphereDataEntry.transform);
+		// Meshes are only rebuilt if the gizmos, the camera or the draw settings changed since the last update
+		mActiveMeshes = mMeshCache.getMeshes(*mDrawHelper, DrawHelper::SortType::BackToFront, camera.get());
 
-			mPickingDrawHelper->sphere(sphereDataEntry.position, sphereDataEntry.radius);
-		}
+		const UINT64 iconMeshKey = DrawMeshCache::hash(mIconCommands.getCommandsHash(),
+			DrawMeshCache::hashCamera(*camera), drawSettings);
 
-		for (auto& sphereDataEntry : mWireSphereData)
+		if (mIconRenderData == nullptr || mIconMeshCamera != camera.get() || mIconMeshKey != iconMeshKey)
 		{
-			if (!sphereDataEntry.pickable)
-				continue;
+			mIconMesh = buildIconMesh(camera, drawSettings, mIconData, false, mIconRenderData);
+			mIconMeshCamera = camera.get();
+			mIconMeshKey = iconMeshKey;
 
-			mPickingDrawHelper->setColor(idxToColorCallback(sphereDataEntry.idx));
-			mPickingDrawHelper->setTransform(sphereDataEntry.transform);
-
-			mPickingDrawHelper->wireSphere(sphereDataEntry.position, sphereDataEntry.radius);
+			DrawMeshCache::_notifyMeshes(mIconMesh != nullptr ? 1 : 0, 0);
 		}
+		else if (mIconMesh != nullptr)
+			DrawMeshCache::_notifyMeshes(0, 1);
+
+		Vector<MeshRenderData> proxyData = createMeshProxyData(mActiveMeshes);
+		IconRenderDataVecPtr iconRenderData = mIconRenderData;
+		InstanceRenderDataPtr instanceData = createInstanceData(nullptr);
+
+		SPtr<ct::MeshBase> iconMesh;
+		if(mIconMesh != nullptr)
+			iconMesh = mIconMesh->getCore();
+
+		ct::GizmoRenderer* renderer = mGizmoRenderer.get();
+
+		gCoreThread().queueCommand(std::bind(&ct::GizmoRenderer::updateData, renderer, camera->getCore(),
+			proxyData, iconMesh, iconRenderData, instanceData));
+	}
+
+	void GizmoManager::renderForPicking(const SPtr<Camera>& camera, const GizmoDrawSettings& drawSettings, 
+		std::function<Color(UINT32)> idxToColorCallback)
+	{
+		Vector<IconData> iconData;
+		IconRenderDataVecPtr iconRenderData;
+
+		mPickingDrawHelper->clear();
 
-		for (auto& sphereDataEntry : mWireSphereData)
+		for (auto& sphereDataEntry : mWireHemisphereData)
 		{
 			if (!sphereDataEntry.pickable)
 				continue;
@@ -663,7 +796,8 @@ namespace bs
 			mPickingDrawHelper->buildMeshes(DrawHelper::SortType::BackToFront, camera.get());
 
 		SPtr<Mesh> iconMesh = buildIconMesh(camera, drawSettings, iconData, true, iconRenderData);
-		
+		InstanceRenderDataPtr instanceData = createInstanceData(idxToColorCallback);
+
 		SPtr<ct::Mesh> iconMeshCore;
 		if (iconMesh != nullptr)
 			iconMeshCore = iconMesh->getCore();
@@ -673,7 +807,7 @@ namespace bs
 
 		Vector<MeshRenderData> proxyData = createMeshProxyData(meshes);
 		gCoreThread().queueCommand(std::bind(&ct::GizmoRenderer::renderData, renderer, camera->getCore(),
-											 proxyData, iconMeshCore, iconRenderData, true));
+											 proxyData, iconMeshCore, iconRenderData, instanceData, true));
 	}
 
 	void GizmoManager::clearGizmos()
@@ -697,6 +831,8 @@ namespace bs
 		mIdxToSceneObjectMap.clear();
 
 		mDrawHelper->clear();
+		mMeshCache.clearCommands();
+		mIconCommands.clearCommands();
 
 		mCurrentIdx = 0;
 	}
@@ -704,13 +840,16 @@ namespace bs
 	void GizmoManager::clearRenderData()
 	{
 		mActiveMeshes.clear();
+		mMeshCache.clear();
 		mIconMesh = nullptr;
+		mIconRenderData = nullptr;
+		mIconMeshCamera = nullptr;
 
 		ct::GizmoRenderer* renderer = mGizmoRenderer.get();
 		IconRenderDataVecPtr iconRenderData = bs_shared_ptr_new<IconRenderDataVec>();
 		
 		gCoreThread().queueCommand(std::bind(&ct::GizmoRenderer::updateData, renderer,
-			nullptr, Vector<MeshRenderData>(), nullptr, iconRenderData));
+			nullptr, Vector<MeshRenderData>(), nullptr, iconRenderData, nullptr));
 	}
 
 	SPtr<Mesh> GizmoManager::buildIconMesh(const SPtr<Camera>& camera, const GizmoDrawSettings& drawSettings, 
@@ -974,16 +1113,39 @@ namespace bs
 		mIconGizmoBuffer = gGizmoParamBlockDef.createBuffer();
 		mMeshPickingParamBuffer = gGizmoPickingParamBlockDef.createBuffer();
 		mIconPickingParamBuffer = gGizmoPickingParamBlockDef.createBuffer();
+
+		const SPtr<Material> solidInstancedMat = getAndCompile(initData.solidInstancedMat);
+		const SPtr<Material> lineInstancedMat = getAndCompile(initData.lineInstancedMat);
+		mInstancedPickingMaterial = getAndCompile(initData.pickingInstancedMat);
+
+		mInstancedMaterials[(UINT32)InstancedGizmoType::SolidCube] = solidInstancedMat;
+		mInstancedMaterials[(UINT32)InstancedGizmoType::WireCube] = lineInstancedMat;
+		mInstancedMaterials[(UINT32)InstancedGizmoType::SolidSphere] = solidInstancedMat;
+		mInstancedMaterials[(UINT32)InstancedGizmoType::WireSphere] = lineInstancedMat;
+
+		for (UINT32 i = 0; i < (UINT32)InstancedGizmoType::Count; i++)
+		{
+			mInstancedMeshes[i] = initData.instancedMeshes[i];
+
+			mInstancedParamSets[0][i] = mInstancedMaterials[i]->createParamsSet();
+			mInstancedParamSets[0][i]->setParamBlockBuffer("Uniforms", mMeshGizmoBuffer, true);
+
+			mInstancedParamSets[1][i] = mInstancedPickingMaterial->createParamsSet();
+			mInstancedParamSets[1][i]->setParamBlockBuffer("Uniforms", mMeshPickingParamBuffer, true);
+		}
 	}
 
 	void GizmoRenderer::updateData(const SPtr<Camera>& camera, const Vector<GizmoManager::MeshRenderData>& meshes,
-		const SPtr<MeshBase>& iconMesh, const GizmoManager::IconRenderDataVecPtr& iconRenderData)
+		const SPtr<MeshBase>& iconMesh, const GizmoManager::IconRenderDataVecPtr& iconRenderData,
+		const GizmoManager::InstanceRenderDataPtr& instanceData)
 	{
 		mCamera = camera;
 		mMeshes = meshes;
 		mIconMesh = iconMesh;
 		mIconRenderData = iconRenderData;
 
+		updateInstances(instanceData, false);
+
 		// Allocate and assign GPU program parameter objects
 		UINT32 meshCounters[(UINT32)GizmoMeshType::Count];
 		bs_zero_out(meshCounters);
@@ -1052,6 +1214,59 @@ namespace bs
 		}
 	}
 
+	void GizmoRenderer::updateInstances(const GizmoManager::InstanceRenderDataPtr& instanceData, bool forPicking)
+	{
+		const UINT32 setIdx = forPicking ? 1 : 0;
+		for (UINT32 i = 0; i < (UINT32)InstancedGizmoType::Count; i++)
+		{
+			const UINT32 numInstances = instanceData != nullptr ? (UINT32)instanceData->instances[i].size() : 0;
+
+			mNumInstances[setIdx][i] = numInstances;
+			if (numInstances == 0)
+				continue;
+
+			// Grow the buffer geometrically so it only gets reallocated when the gizmo count increases significantly
+			SPtr<GpuBuffer>& buffer = mInstanceBuffers[setIdx][i];
+			if (buffer == nullptr || buffer->getProperties().getElementCount() < numInstances)
+			{
+				UINT32 capacity = buffer != nullptr ? buffer->getProperties().getElementCount() : 0;
+				capacity = std::max(std::max(capacity * 2, numInstances), 64U);
+
+				GPU_BUFFER_DESC bufferDesc;
+				bufferDesc.type = GBT_STRUCTURED;
+				bufferDesc.elementCount = capacity;
+				bufferDesc.elementSize = sizeof(GizmoManager::InstanceData);
+				bufferDesc.format = BF_UNKNOWN;
+				bufferDesc.usage = GBU_DYNAMIC;
+
+				buffer = GpuBuffer::create(bufferDesc);
+
+				SPtr<GpuParams> params = mInstancedParamSets[setIdx][i]->getGpuParams();
+				params->setBuffer(GPT_VERTEX_PROGRAM, "gInstances", buffer);
+			}
+
+			buffer->writeData(0, numInstances * sizeof(GizmoManager::InstanceData), instanceData->instances[i].data(),
+				BWT_DISCARD);
+		}
+	}
+
+	void GizmoRenderer::renderInstances(bool usePickingMaterial)
+	{
+		const UINT32 setIdx = usePickingMaterial ? 1 : 0;
+		for (UINT32 i = 0; i < (UINT32)InstancedGizmoType::Count; i++)
+		{
+			const UINT32 numInstances = mNumInstances[setIdx][i];
+			if (numInstances == 0)
+				continue;
+
+			const SPtr<Mesh>& mesh = mInstancedMeshes[i];
+
+			gRendererUtility().setPass(usePickingMaterial ? mInstancedPickingMaterial : mInstancedMaterials[i]);
+			gRendererUtility().setPassParams(mInstancedParamSets[setIdx][i]);
+			gRendererUtility().draw(mesh, mesh->getProperties().getSubMesh(0), numInstances);
+		}
+	}
+
 	bool GizmoRenderer::check(const Camera& camera)
 	{
 		return &camera == mCamera.get();
@@ -1059,12 +1274,15 @@ namespace bs
 
 	void GizmoRenderer::render(const Camera& camera)
 	{
-		renderData(mCamera, mMeshes, mIconMesh, mIconRenderData, false);
+		renderData(mCamera, mMeshes, mIconMesh, mIconRenderData, nullptr, false);
 	}
 
 	void GizmoRenderer::renderData(const SPtr<Camera>& camera, Vector<GizmoManager::MeshRenderData>& meshes,
-		const SPtr<MeshBase>& iconMesh, const GizmoManager::IconRenderDataVecPtr& iconRenderData, bool usePickingMaterial)
+		const SPtr<MeshBase>& iconMesh, const GizmoManager::IconRenderDataVecPtr& iconRenderData,
+		const GizmoManager::InstanceRenderDataPtr& instanceData, bool usePickingMaterial)
 	{
+		BS_EDITOR_PROFILE_SCOPE("Gizmos", "GizmoRenderer::renderData");
+
 		if (camera == nullptr)
 			return;
 
@@ -1089,6 +1307,8 @@ namespace bs
 			gGizmoParamBlockDef.gInvViewportHeight.set(mMeshGizmoBuffer, invViewportHeight);
 			gGizmoParamBlockDef.gViewportYFlip.set(mMeshGizmoBuffer, viewportYFlip);
 
+			renderInstances(false);
+
 			for (auto& entry : meshes)
 			{
 				UINT32 typeIdx = (UINT32)entry.type;
@@ -1141,6 +1361,9 @@ namespace bs
 			gGizmoPickingParamBlockDef.gMatViewProj.set(mMeshPickingParamBuffer, viewProjMat);
 			gGizmoPickingParamBlockDef.gAlphaCutoff.set(mMeshPickingParamBuffer, PICKING_ALPHA_CUTOFF);
 
+			updateInstances(instanceData, true);
+			renderInstances(true);
+
 			for (auto& entry : meshes)
 			{
 				UINT32 typeIdx = entry.type == GizmoMeshType::Text ? 1 : 0;
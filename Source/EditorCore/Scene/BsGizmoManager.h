@@ -9,6 +9,7 @@
 #include "Math/BsMatrix4.h"
 #include "RenderAPI/BsGpuParam.h"
 #include "Utility/BsDrawHelper.h"
+#include "Utility/BsDrawMeshCache.h"
 #include "Renderer/BsParamBlocks.h"
 #include "Renderer/BsRendererExtension.h"
 
@@ -26,6 +27,12 @@ namespace bs
 		Solid, Line, Wire, Text, Count
 	};
 
+	/** Type of gizmo primitive that is drawn by instancing a single shared mesh, rather than being built by DrawHelper. */
+	enum class InstancedGizmoType
+	{
+		SolidCube, WireCube, SolidSphere, WireSphere, Count
+	};
+
 	/** Settings that control gizmo drawing. */
 	struct BS_SCRIPT_EXPORT(api:bed,pl:true) GizmoDrawSettings
 	{
@@ -283,6 +290,24 @@ namespace bs
 		 *  @{
 		 */
 
+		/** 
+		 * Properties of a single instanced gizmo primitive, as laid out in the GPU instance buffer. The transform used for
+		 * normals is derived from @p transform in the shader.
+		 */
+		struct InstanceData
+		{
+			Vector4 transform[3]; /**< First three rows of the world transform of the unit primitive mesh. */
+			RGBA color; /**< Color packed as 8-bit RGBA, as returned by Color::getAsRGBA(). */
+		};
+
+		/** Instances of all instanced gizmo primitives, grouped by InstancedGizmoType. */
+		struct InstanceRenderData
+		{
+			Vector<InstanceData> instances[(UINT32)InstancedGizmoType::Count];
+		};
+
+		typedef SPtr<InstanceRenderData> InstanceRenderDataPtr;
+
 		/**
 		 * Updates all the gizmo meshes to reflect all draw calls submitted since clearGizmos().
 		 *
@@ -303,6 +328,18 @@ namespace bs
 		void renderForPicking(const SPtr<Camera>& camera, const GizmoDrawSettings& drawSettings, 
 			std::function<Color(UINT32)> idxToColorCallback);
 
+		/**
+		 * Gathers per-instance data of all the gizmo primitives that are rendered using instancing. Translucent
+		 * primitives are only instanced when rendering for picking, otherwise they are drawn by DrawHelper so they get
+		 * sorted together with the rest of the translucent gizmos.
+		 *
+		 * @param[in]	idxToColorCallback	If provided, only pickable gizmos are output and their colors are replaced
+		 *									with the colors returned by the callback, for use in picking.
+		 *
+		 * @note	Internal method.
+		 */
+		InstanceRenderDataPtr createInstanceData(const std::function<Color(UINT32)>& idxToColorCallback) const;
+
 		/** @} */
 
 	private:
@@ -445,6 +482,10 @@ namespace bs
 			SPtr<ct::Material> textMat;
 			SPtr<ct::Material> pickingMat;
 			SPtr<ct::Material> alphaPickingMat;
+			SPtr<ct::Material> solidInstancedMat;
+			SPtr<ct::Material> lineInstancedMat;
+			SPtr<ct::Material> pickingInstancedMat;
+			SPtr<ct::Mesh> instancedMeshes[(UINT32)InstancedGizmoType::Count];
 		};
 
 		typedef Vector<IconRenderData> IconRenderDataVec;
@@ -471,6 +512,9 @@ namespace bs
 		/** Converts mesh data from DrawHelper into mesh data usable by the gizmo renderer. */
 		Vector<MeshRenderData> createMeshProxyData(const Vector<DrawHelper::ShapeMeshData>& meshData);
 
+		/** Creates a unit sized mesh of the provided primitive type, that is instanced for every gizmo of that type. */
+		static SPtr<Mesh> createInstancedMesh(InstancedGizmoType type);
+
 		/**
 		 * Calculates colors for an icon based on its position in the camera. For example icons too close to too far might
 		 * be faded.
@@ -526,8 +570,14 @@ namespace bs
 		Map<UINT32, HSceneObject> mIdxToSceneObjectMap;
 
 		Vector<DrawHelper::ShapeMeshData> mActiveMeshes;
+		DrawMeshCache mMeshCache;
 
 		SPtr<Mesh> mIconMesh;
+		SPtr<Mesh> mInstancedMeshes[(UINT32)InstancedGizmoType::Count];
+		IconRenderDataVecPtr mIconRenderData;
+		DrawMeshCache mIconCommands; /**< Only used for hashing the icon draw commands. */
+		const Camera* mIconMeshCamera = nullptr;
+		UINT64 mIconMeshKey = 0;
 
 		SPtr<ct::GizmoRenderer> mGizmoRenderer;
 
@@ -595,12 +645,14 @@ namespace bs
 		 * @param[in]	meshes				Meshes to render.
 		 * @param[in]	iconMesh			Mesh containing icon meshes.
 		 * @param[in]	iconRenderData		Icon render data outlining which parts of the icon mesh use which textures.
+		 * @param[in]	instanceData		Instances of primitives to render using instancing. Only used when rendering
+		 *									for picking, otherwise the instances provided to updateData() are rendered.
 		 * @param[in]	usePickingMaterial	If true, meshes will be rendered using a special picking materials, otherwise
 		 *									they'll be rendered using normal drawing materials.
 		 */
 		void renderData(const SPtr<Camera>& camera, Vector<GizmoManager::MeshRenderData>& meshes, 
 			const SPtr<MeshBase>& iconMesh, const GizmoManager::IconRenderDataVecPtr& iconRenderData, 
-			bool usePickingMaterial);
+			const GizmoManager::InstanceRenderDataPtr& instanceData, bool usePickingMaterial);
 
 		/**
 		 * Renders the icon gizmo mesh using the provided parameters.
@@ -621,9 +673,23 @@ namespace bs
 		 * @param[in]	meshes			Meshes to render.
 		 * @param[in]	iconMesh		Mesh containing icon meshes.
 		 * @param[in]	iconRenderData	Icon render data outlining which parts of the icon mesh use which textures.
+		 * @param[in]	instanceData	Instances of primitives to render using instancing.
 		 */
 		void updateData(const SPtr<Camera>& camera, const Vector<GizmoManager::MeshRenderData>& meshes, 
-			const SPtr<MeshBase>& iconMesh,  const GizmoManager::IconRenderDataVecPtr& iconRenderData);
+			const SPtr<MeshBase>& iconMesh,  const GizmoManager::IconRenderDataVecPtr& iconRenderData,
+			const GizmoManager::InstanceRenderDataPtr& instanceData);
+
+		/**
+		 * Uploads the provided instances into the instance buffers, growing them if needed.
+		 *
+		 * @param[in]	instanceData	Instances to upload.
+		 * @param[in]	forPicking		Determines which set of buffers to upload to. Picking uses its own buffers so it
+		 *								doesn't overwrite the instances used for normal rendering.
+		 */
+		void updateInstances(const GizmoManager::InstanceRenderDataPtr& instanceData, bool forPicking);
+
+		/** Renders instanced gizmo primitives last uploaded through updateInstances(). */
+		void renderInstances(bool usePickingMaterial);
 
 		static const float PICKING_ALPHA_CUTOFF;
 
@@ -637,6 +703,10 @@ namespace bs
 		Vector<SPtr<GpuParamsSet>> mIconParamSets;
 		Vector<SPtr<GpuParamsSet>> mPickingParamSets[2];
 
+		SPtr<GpuParamsSet> mInstancedParamSets[2][(UINT32)InstancedGizmoType::Count];
+		SPtr<GpuBuffer> mInstanceBuffers[2][(UINT32)InstancedGizmoType::Count];
+		UINT32 mNumInstances[2][(UINT32)InstancedGizmoType::Count] = {};
+
 		SPtr<GpuParamBlockBuffer> mMeshGizmoBuffer;
 		SPtr<GpuParamBlockBuffer> mIconGizmoBuffer;
 		SPtr<GpuParamBlockBuffer> mMeshPickingParamBuffer;
@@ -646,6 +716,9 @@ namespace bs
 		SPtr<Material> mMeshMaterials[(UINT32)GizmoMeshType::Count];
 		SPtr<Material> mIconMaterial;
 		SPtr<Material> mPickingMaterials[2];
+		SPtr<Material> mInstancedMaterials[(UINT32)InstancedGizmoType::Count];
+		SPtr<Material> mInstancedPickingMaterial;
+		SPtr<Mesh> mInstancedMeshes[(UINT32)InstancedGizmoType::Count];
 	};
 
 	/** @} */
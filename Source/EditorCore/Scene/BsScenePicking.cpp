@@ -18,12 +18,15 @@
 #include "RenderAPI/BsRasterizerState.h"
 #include "RenderAPI/BsRenderTexture.h"
 #include "Image/BsPixelData.h"
+#include "Image/BsPixelUtil.h"
+#include "Image/BsTexture.h"
 #include "RenderAPI/BsGpuParams.h"
 #include "Material/BsGpuParamsSet.h"
 #include "Utility/BsBuiltinEditorResources.h"
 #include "Material/BsShader.h"
 #include "Renderer/BsRenderer.h"
 #include "Scene/BsGizmoManager.h"
+#include "Scene/BsEditorSceneSnapshot.h"
 #include "Renderer/BsRendererUtility.h"
 
 using namespace std::placeholders;
@@ -70,6 +73,130 @@ namespace bs
 
 	Vector<HSceneObject> ScenePicking::pickObjects(const SPtr<Camera>& cam, const GizmoDrawSettings& gizmoDrawSettings,
 		const Vector2I& position, const Vector2I& area, Vector<HSceneObject>& ignoreRenderables, SnapData* data)
+	{
+		SPtr<ScenePickingOp> op = pickObjectsAsync(cam, gizmoDrawSettings, position, area, ignoreRenderables,
+			data != nullptr);
+		gCoreThread().submit(true);
+
+		assert(op->hasCompleted());
+
+		if (data != nullptr)
+			*data = op->getSnapData();
+
+		return op->getObjects();
+	}
+
+	SPtr<ScenePickingOp> ScenePicking::pickObjectsAsync(const SPtr<Camera>& cam, 
+		const GizmoDrawSettings& gizmoDrawSettings, const Vector2I& position, const Vector2I& area, 
+		const Vector<HSceneObject>& ignoreRenderables, bool gatherSnapData, const void* owner)
+	{
+		SPtr<ScenePickingOp> op = bs_shared_ptr_new<ScenePickingOp>();
+		op->mOwner = owner;
+		op->mCamera = cam;
+		op->mGizmoDrawSettings = gizmoDrawSettings;
+		op->mPosition = position;
+		op->mArea = area;
+		op->mIgnoredObjects = ignoreRenderables;
+		op->mGatherSnapData = gatherSnapData;
+
+		if (owner == nullptr)
+		{
+			issue(*op);
+			return op;
+		}
+
+		update();
+
+		// A newer request from the same owner makes any deferred ones stale
+		for (auto iter = mDeferredOps.begin(); iter != mDeferredOps.end();)
+		{
+			if ((*iter)->mOwner == owner)
+			{
+				(*iter)->cancel();
+				iter = mDeferredOps.erase(iter);
+			}
+			else
+				++iter;
+		}
+
+		const bool ownerInFlight = std::any_of(mInFlightOps.begin(), mInFlightOps.end(),
+			[owner](const SPtr<ScenePickingOp>& entry) { return entry->mOwner == owner; });
+
+		if (ownerInFlight)
+			mDeferredOps.push_back(op);
+		else
+		{
+			issue(*op);
+			mInFlightOps.push_back(op);
+		}
+
+		return op;
+	}
+
+	void ScenePicking::cancel(const void* owner)
+	{
+		for (auto& op : mInFlightOps)
+		{
+			if (op->mOwner == owner)
+				op->cancel();
+		}
+
+		for (auto iter = mDeferredOps.begin(); iter != mDeferredOps.end();)
+		{
+			if ((*iter)->mOwner == owner)
+			{
+				(*iter)->cancel();
+				iter = mDeferredOps.erase(iter);
+			}
+			else
+				++iter;
+		}
+	}
+
+	void ScenePicking::update()
+	{
+		// Canceled operations still occupy the core thread until they finish, so they're only retired once complete
+		for (auto iter = mInFlightOps.begin(); iter != mInFlightOps.end();)
+		{
+			if ((*iter)->mAsyncOp.hasCompleted())
+				iter = mInFlightOps.erase(iter);
+			else
+				++iter;
+		}
+
+		for (auto iter = mDeferredOps.begin(); iter != mDeferredOps.end();)
+		{
+			SPtr<ScenePickingOp> op = *iter;
+			if (op->isCanceled())
+			{
+				iter = mDeferredOps.erase(iter);
+				continue;
+			}
+
+			const bool ownerInFlight = std::any_of(mInFlightOps.begin(), mInFlightOps.end(),
+				[&op](const SPtr<ScenePickingOp>& entry) { return entry->mOwner == op->mOwner; });
+
+			if (ownerInFlight)
+			{
+				++iter;
+				continue;
+			}
+
+			iter = mDeferredOps.erase(iter);
+
+			// Camera might have been destroyed while the request was waiting
+			if (op->mCamera->getViewport() == nullptr || op->mCamera->getViewport()->getTarget() == nullptr)
+			{
+				op->cancel();
+				continue;
+			}
+
+			issue(*op);
+			mInFlightOps.push_back(op);
+		}
+	}
+
+	void ScenePicking::issue(ScenePickingOp& op)
 	{
 		auto comparePickElement = [&] (const ScenePicking::RenderablePickData& a, const ScenePicking::RenderablePickData& b)
 		{
@@ -85,20 +212,24 @@ namespace bs
 				return (UINT32)a.alpha > (UINT32)b.alpha;
 		};
 
+		const SPtr<Camera>& cam = op.mCamera;
+		const Vector<HSceneObject>& ignoreRenderables = op.mIgnoredObjects;
 		Matrix4 viewProjMatrix = cam->getProjectionMatrixRS() * cam->getViewMatrix();
 
-		Vector<HRenderable> renderables = gSceneManager().findComponents<CRenderable>(true);
+		// Renderables and their world bounds are shared between all views, only culling is done per camera
+		const Vector<EditorSnapshotRenderable>& renderables = EditorSceneSnapshot::instance().getRenderables();
 		RenderableSet pickData(comparePickElement);
-		Map<UINT32, HSceneObject> idxToRenderable;
+		UnorderedMap<UINT32, HSceneObject>& idxToRenderable = op.mIdxToSceneObject;
 
-		for (auto& renderable : renderables)
+		for (auto& entry : renderables)
 		{
-			HSceneObject so = renderable->SO();
-
-			HMesh mesh = renderable->getMesh();
-			if (!mesh.isLoaded())
+			const HSceneObject& so = entry.sceneObject;
+			const HMesh& mesh = entry.mesh;
+			if (so.isDestroyed() || entry.renderable.isDestroyed() || !mesh.isLoaded())
 				continue;
 
+			const HRenderable& renderable = entry.renderable;
+
 			bool found = false;
 			for (UINT32 i = 0; i < (UINT32)ignoreRenderables.size(); i++)
 			{
@@ -112,9 +243,8 @@ namespace bs
 			if (found)
 				continue;
 
-			Bounds worldBounds = mesh->getProperties().getBounds();
-			Matrix4 worldTransform = so->getWorldMatrix();
-			worldBounds.transformAffine(worldTransform);
+			const Bounds& worldBounds = entry.worldBounds;
+			const Matrix4& worldTransform = entry.worldTransform;
 
 			const ConvexVolume& frustum = cam->getWorldFrustum();
 			if (frustum.intersects(worldBounds.getSphere()))
@@ -162,49 +292,68 @@ namespace bs
 
 		UINT32 firstGizmoIdx = (UINT32)pickData.size();
 
+		// Commands are executed by the core thread along with the rest of the frame, so the pick data is copied into them
 		SPtr<ct::RenderTarget> target = cam->getViewport()->getTarget()->getCore();
 		gCoreThread().queueCommand(std::bind(&ct::ScenePicking::corePickingBegin, mCore, target,
-			cam->getViewport()->getArea(), std::cref(pickData), position, area));
+			cam->getViewport()->getArea(), std::move(pickData), op.mPosition, op.mArea));
 
-		GizmoManager::instance().renderForPicking(cam, gizmoDrawSettings, 
-			[&](UINT32 inputIdx) { return encodeIndex(firstGizmoIdx + inputIdx); });
+		// Gizmos get redrawn every frame, so remember which object each one belonged to at the time of the request
+		GizmoManager& gizmoManager = GizmoManager::instance();
+		gizmoManager.renderForPicking(cam, op.mGizmoDrawSettings, [&](UINT32 inputIdx)
+		{
+			idxToRenderable[firstGizmoIdx + inputIdx] = gizmoManager.getSceneObject(inputIdx);
+			return encodeIndex(firstGizmoIdx + inputIdx);
+		});
 
-		AsyncOp op = gCoreThread().queueReturnCommand(std::bind(&ct::ScenePicking::corePickingEnd, mCore, target,
-			cam->getViewport()->getArea(), position, area, data != nullptr, _1));
-		gCoreThread().submit(true);
+		op.mAsyncOp = gCoreThread().queueReturnCommand(std::bind(&ct::ScenePicking::corePickingEnd, mCore, target,
+			cam->getViewport()->getArea(), op.mPosition, op.mArea, op.mGatherSnapData, _1));
+		op.mIssued = true;
+	}
 
-		assert(op.hasCompleted());
+	bool ScenePickingOp::hasCompleted() const
+	{
+		return mIssued && !mCanceled && mAsyncOp.hasCompleted();
+	}
 
-		PickResults pickResults = any_cast<PickResults>(op.getGenericReturnValue());
-		if (data != nullptr)
-		{
-			data->pickPosition = cam->screenToWorldPointDeviceDepth(position, pickResults.depth);
-			data->normal = pickResults.normal;
-		}
+	const Vector<HSceneObject>& ScenePickingOp::getObjects()
+	{
+		if (!mResolved && hasCompleted())
+			resolve();
 
-		Vector<UINT32> selectedObjects = pickResults.objects;
-		Vector<HSceneObject> results;
+		return mObjects;
+	}
+
+	const SnapData& ScenePickingOp::getSnapData()
+	{
+		if (!mResolved && hasCompleted())
+			resolve();
+
+		return mSnapData;
+	}
 
-		for (auto& selectedObjectIdx : selectedObjects)
+	void ScenePickingOp::resolve()
+	{
+		PickResults pickResults = any_cast<PickResults>(mAsyncOp.getGenericReturnValue());
+		if (mGatherSnapData)
 		{
-			if (selectedObjectIdx < firstGizmoIdx)
-			{
-				auto iterFind = idxToRenderable.find(selectedObjectIdx);
+			mSnapData.pickPosition = mCamera->screenToWorldPointDeviceDepth(mPosition, pickResults.depth);
+			mSnapData.normal = pickResults.normal;
+		}
 
-				if (iterFind != idxToRenderable.end())
-					results.push_back(iterFind->second);
-			}
-			else
-			{
-				UINT32 gizmoIdx = selectedObjectIdx - firstGizmoIdx;
+		for (auto& selectedObjectIdx : pickResults.objects)
+		{
+			auto iterFind = mIdxToSceneObject.find(selectedObjectIdx);
+			if (iterFind == mIdxToSceneObject.end())
+				continue;
 
-				HSceneObject so = GizmoManager::instance().getSceneObject(gizmoIdx);
-				if (so)
-					results.push_back(so);
-			}
+			// Objects might have been destroyed while the operation was in progress
+			const HSceneObject& so = iterFind->second;
+			if (so && !so.isDestroyed())
+				mObjects.push_back(so);
 		}
 
-		return results;
+		mIdxToSceneObject.clear();
+		mResolved = true;
 	}
 
 	Color ScenePicking::encodeIndex(UINT32 index)
@@ -230,6 +379,98 @@ namespace bs
 		return (r & 0xFF) | ((g & 0xFF) << 8) | ((b & 0xFF) << 16);
 	}
 
+	Vector<UINT32> ScenePicking::rankPickedPixels(const PixelData& pixelData, UINT32 width, UINT32 height)
+	{
+		const PixelFormat format = pixelData.getFormat();
+		PickedIndexCounter counter(width * height);
+
+		// Identifiers are stored in the low 24 bits of 8-bit-per-channel colors, so they can be read directly from the
+		// pixel bytes instead of going through floating point colors
+		if (format == PF_RGBA8 || format == PF_BGRA8)
+		{
+			// Rows might be padded, so the stride is taken from the pixel data instead of being derived from its width
+			const UINT32 rowPitch = pixelData.getRowPitch();
+			const UINT8* data = pixelData.getData();
+
+			for (UINT32 y = 0; y < height; y++)
+			{
+				const UINT8* row = data + y * rowPitch;
+				for (UINT32 x = 0; x < width; x++)
+				{
+					const UINT8* pixel = row + x * 4;
+
+					if (format == PF_RGBA8)
+						counter.add(pixel[0] | (pixel[1] << 8) | (pixel[2] << 16));
+					else
+						counter.add(pixel[2] | (pixel[1] << 8) | (pixel[0] << 16));
+				}
+			}
+		}
+		else
+		{
+			for (UINT32 y = 0; y < height; y++)
+			{
+				for (UINT32 x = 0; x < width; x++)
+					counter.add(decodeIndex(pixelData.getColorAt(x, y)));
+			}
+		}
+
+		return counter.rank();
+	}
+
+	Vector<UINT32> ScenePicking::rankPickedIndices(const UINT32* ids, UINT32 numIds)
+	{
+		PickedIndexCounter counter(numIds);
+		for (UINT32 i = 0; i < numIds; i++)
+			counter.add(ids[i]);
+
+		return counter.rank();
+	}
+
+	ScenePicking::PickedIndexCounter::PickedIndexCounter(UINT32 numPixels)
+		:mCounts(std::min(numPixels * 4 + 1024, MAX_DENSE_INDICES), 0)
+	{ }
+
+	Vector<UINT32> ScenePicking::PickedIndexCounter::rank()
+	{
+		struct SelectedObject { UINT32 index; UINT32 score; };
+		Vector<SelectedObject> selectedObjects;
+
+		for (UINT32 i = 0; i < (UINT32)mCounts.size(); i++)
+		{
+			if (mCounts[i] > 0)
+				selectedObjects.push_back({ i, mCounts[i] });
+		}
+
+		// Identifiers too large to be counted directly are all larger than the directly counted ones, so appending them
+		// after sorting keeps the objects ordered by index
+		std::sort(mSparseIndices.begin(), mSparseIndices.end());
+
+		const UINT32 numSparse = (UINT32)mSparseIndices.size();
+		for (UINT32 i = 0; i < numSparse;)
+		{
+			UINT32 end = i + 1;
+			while (end < numSparse && mSparseIndices[end] == mSparseIndices[i])
+				end++;
+
+			selectedObjects.push_back({ mSparseIndices[i], end - i });
+			i = end;
+		}
+
+		// Objects are already ordered by index, so a stable sort keeps it as the secondary order
+		std::stable_sort(selectedObjects.begin(), selectedObjects.end(),
+			[](const SelectedObject& a, const SelectedObject& b)
+		{
+			return b.score < a.score;
+		});
+
+		Vector<UINT32> output(selectedObjects.size());
+		for (UINT32 i = 0; i < (UINT32)selectedObjects.size(); i++)
+			output[i] = selectedObjects[i].index;
+
+		return output;
+	}
+
 	namespace ct
 	{
 	const float ScenePicking::ALPHA_CUTOFF = 0.5f;
@@ -257,14 +498,22 @@ namespace bs
 		SPtr<Texture> outputTexture = rtt->getColorTexture(0);
 		TextureProperties outputTextureProperties = outputTexture->getProperties();
 
-		TEXTURE_DESC normalTexDesc;
-		normalTexDesc.type = TEX_TYPE_2D;
-		normalTexDesc.width = outputTextureProperties.getWidth();
-		normalTexDesc.height = outputTextureProperties.getHeight();
-		normalTexDesc.format = PF_RG11B10F;
-		normalTexDesc.usage = TU_RENDERTARGET;
+		// Normals target is reused between picks, as long as the size doesn't change
+		if (mNormalsTexture == nullptr || 
+			mNormalsTexture->getProperties().getWidth() != outputTextureProperties.getWidth() ||
+			mNormalsTexture->getProperties().getHeight() != outputTextureProperties.getHeight())
+		{
+			TEXTURE_DESC normalTexDesc;
+			normalTexDesc.type = TEX_TYPE_2D;
+			normalTexDesc.width = outputTextureProperties.getWidth();
+			normalTexDesc.height = outputTextureProperties.getHeight();
+			normalTexDesc.format = PF_RG11B10F;
+			normalTexDesc.usage = TU_RENDERTARGET;
+
+			mNormalsTexture = Texture::create(normalTexDesc);
+		}
 
-		SPtr<Texture> normalsTexture = Texture::create(normalTexDesc);
+		SPtr<Texture> normalsTexture = mNormalsTexture;
 		SPtr<Texture> depthTexture = rtt->getDepthStencilTexture();
 
 		RENDER_TEXTURE_DESC pickingMRT;
@@ -385,85 +634,51 @@ namespace bs
 		SPtr<Texture> normalsTexture = mPickingTexture->getColorTexture(1);
 		SPtr<Texture> depthTexture = mPickingTexture->getDepthStencilTexture();
 
-		if (position.x < 0 || position.x >= (INT32)outputTexture->getProperties().getWidth() ||
-			position.y < 0 || position.y >= (INT32)outputTexture->getProperties().getHeight())
+		const UINT32 width = outputTexture->getProperties().getWidth();
+		const UINT32 height = outputTexture->getProperties().getHeight();
+
+		if (position.x < 0 || position.x >= (INT32)width || position.y < 0 || position.y >= (INT32)height)
 		{
 			mPickingTexture = nullptr;
 
-			asyncOp._completeOperation(Vector<UINT32>());
+			asyncOp._completeOperation(PickResults());
 			return;
 		}
 
-		SPtr<PixelData> outputPixelData = outputTexture->getProperties().allocBuffer(0, 0);
-		SPtr<PixelData> normalsPixelData;
-		SPtr<PixelData> depthPixelData;
-		if (gatherSnapData)
-		{
-			normalsPixelData = normalsTexture->getProperties().allocBuffer(0, 0);
-			depthPixelData = depthTexture->getProperties().allocBuffer(0, 0);
-		}
-
-		outputTexture->readData(*outputPixelData);
-
-
 		Vector2I pickPosition = position;
 		if(rtProps.requiresTextureFlipping)
 			pickPosition.y = rtProps.height - (position.y + area.y);
 
-		UINT32 maxWidth = std::min((UINT32)(pickPosition.x + area.x), outputPixelData->getWidth());
-		UINT32 maxHeight = std::min((UINT32)(pickPosition.y + area.y), outputPixelData->getHeight());
-
-		Map<UINT32, UINT32> selectionScores;
-		for (UINT32 y = (UINT32)pickPosition.y; y < maxHeight; y++)
-		{
-			for (UINT32 x = (UINT32)pickPosition.x; x < maxWidth; x++)
-			{
-				Color color = outputPixelData->getColorAt(x, y);
-				UINT32 index = bs::ScenePicking::decodeIndex(color);
-
-				if (index == 0x00FFFFFF) // Nothing selected
-					continue;
+		const UINT32 left = (UINT32)Math::clamp(pickPosition.x, 0, (INT32)width);
+		const UINT32 top = (UINT32)Math::clamp(pickPosition.y, 0, (INT32)height);
+		const UINT32 right = (UINT32)Math::clamp(pickPosition.x + area.x, (INT32)left + 1, (INT32)width);
+		const UINT32 bottom = (UINT32)Math::clamp(pickPosition.y + area.y, (INT32)top + 1, (INT32)height);
+		const PixelVolume pickVolume(left, top, right, bottom);
 
-				auto iterFind = selectionScores.find(index);
-				if (iterFind == selectionScores.end())
-					selectionScores[index] = 1;
-				else
-					iterFind->second++;
-			}
-		}
+		// Only the picked area is read back, rather than the entire render target
+		SPtr<PixelData> outputPixelData = readArea(outputTexture, pickVolume, mColorStaging);
 
-		// Sort by score
-		struct SelectedObject { UINT32 index; UINT32 score; };
+		Vector<UINT32> objects = bs::ScenePicking::rankPickedPixels(*outputPixelData, pickVolume.getWidth(),
+			pickVolume.getHeight());
 
-		Vector<SelectedObject> selectedObjects(selectionScores.size());
-		UINT32 idx = 0;
-		for (auto& selectionScore : selectionScores)
-		{
-			selectedObjects[idx++] = { selectionScore.first, selectionScore.second };
-		}
-
-		std::sort(selectedObjects.begin(), selectedObjects.end(),
-			[&](const SelectedObject& a, const SelectedObject& b)
-		{
-			return b.score < a.score;
-		});
-
-		Vector<UINT32> objects;
-		for (auto& selectedObject : selectedObjects)
-			objects.push_back(selectedObject.index);
-		
 		PickResults result;
 		if (gatherSnapData)
 		{
+			// Depth-stencil surfaces can't be partially copied on all render backends, so depth is read in full
+			SPtr<PixelData> depthPixelData = depthTexture->getProperties().allocBuffer(0, 0);
 			depthTexture->readData(*depthPixelData);
-			normalsTexture->readData(*normalsPixelData);
+
+			SPtr<PixelData> normalsPixelData = readArea(normalsTexture, pickVolume, mNormalsStaging);
 
 			Vector2I samplePixel = position;
 			if (rtProps.requiresTextureFlipping)
-				samplePixel.y = depthPixelData->getHeight() - samplePixel.y;
+				samplePixel.y = height - samplePixel.y;
+
+			samplePixel.x = Math::clamp(samplePixel.x, (INT32)left, (INT32)right - 1);
+			samplePixel.y = Math::clamp(samplePixel.y, (INT32)top, (INT32)bottom - 1);
 
 			float depth = depthPixelData->getDepthAt(samplePixel.x, samplePixel.y);
-			Color normal = normalsPixelData->getColorAt(samplePixel.x, samplePixel.y);
+			Color normal = normalsPixelData->getColorAt(samplePixel.x - left, samplePixel.y - top);
 
 			const RenderAPICapabilities& caps = gCaps();
 			float max = caps.maxDepth;
@@ -481,5 +696,39 @@ namespace bs
 		result.objects = objects;
 		asyncOp._completeOperation(result);
 	}
+
+	SPtr<PixelData> ScenePicking::readArea(const SPtr<Texture>& texture, const PixelVolume& area, 
+		StagingTextures& stagingTextures)
+	{
+		const TextureProperties& props = texture->getProperties();
+
+		// Staging texture always matches the picked area exactly, as the entire texture is read back. Clicks are
+		// single pixel and use their own texture, so they never need to reallocate it.
+		const bool isPixel = area.getWidth() == 1 && area.getHeight() == 1;
+		SPtr<Texture>& staging = isPixel ? stagingTextures.pixel : stagingTextures.area;
+
+		if (staging == nullptr || staging->getProperties().getFormat() != props.getFormat() ||
+			staging->getProperties().getWidth() != area.getWidth() || 
+			staging->getProperties().getHeight() != area.getHeight())
+		{
+			TEXTURE_DESC stagingDesc;
+			stagingDesc.type = TEX_TYPE_2D;
+			stagingDesc.format = props.getFormat();
+			stagingDesc.width = area.getWidth();
+			stagingDesc.height = area.getHeight();
+			stagingDesc.usage = TU_STATIC | TU_CPUREADABLE;
+
+			staging = Texture::create(stagingDesc);
+		}
+
+		TEXTURE_COPY_DESC copyDesc;
+		copyDesc.srcVolume = area;
+		texture->copy(staging, copyDesc);
+
+		SPtr<PixelData> pixelData = staging->getProperties().allocBuffer(0, 0);
+		staging->readData(*pixelData);
+
+		return pixelData;
+	}
 	}
 }
@@ -7,11 +7,11 @@
 #include "Math/BsMatrix4.h"
 #include "RenderAPI/BsGpuParam.h"
 #include "Renderer/BsParamBlocks.h"
+#include "Threading/BsAsyncOp.h"
+#include "Scene/BsGizmoManager.h"
 
 namespace bs
 {
-	struct GizmoDrawSettings;
-
 	/** @addtogroup Scene-Editor
 	 *  @{
 	 */
@@ -28,11 +28,66 @@ namespace bs
 	{
 		Vector<UINT32> objects;
 		Vector3 normal;
-		float depth;
+		float depth = 0.0f;
 	};
 
 	namespace ct { class ScenePicking; }
 
+	/**
+	 * Handle to a picking operation started through ScenePicking::pickObjectsAsync(). Results become available once the
+	 * core thread renders the picking pass and reads back the picked area, usually a frame or two after the request.
+	 */
+	class BS_ED_EXPORT ScenePickingOp
+	{
+	public:
+		/** Checks has the picking operation completed. Results can only be retrieved once this returns true. */
+		bool hasCompleted() const;
+
+		/** 
+		 * Checks has the operation been canceled, either explicitly or by a newer operation from the same owner. Canceled
+		 * operations never complete.
+		 */
+		bool isCanceled() const { return mCanceled; }
+
+		/** Cancels the operation. If the operation hasn't been sent to the core thread yet, it never will be. */
+		void cancel() { mCanceled = true; }
+
+		/** Returns all scene objects in the picked area, ordered by the number of pixels they cover. */
+		const Vector<HSceneObject>& getObjects();
+
+		/** 
+		 * Returns the position and normal of the surface at the picked position. Only valid if snap data was requested
+		 * when starting the operation. Normal is in world space.
+		 */
+		const SnapData& getSnapData();
+
+	private:
+		friend class ScenePicking;
+
+		/** Converts the core thread results into scene objects. */
+		void resolve();
+
+		// Request
+		const void* mOwner = nullptr;
+		SPtr<Camera> mCamera;
+		GizmoDrawSettings mGizmoDrawSettings;
+		Vector2I mPosition;
+		Vector2I mArea;
+		Vector<HSceneObject> mIgnoredObjects;
+		bool mGatherSnapData = false;
+
+		// State
+		bool mIssued = false;
+		bool mCanceled = false;
+		bool mResolved = false;
+		AsyncOp mAsyncOp;
+		UnorderedMap<UINT32, HSceneObject> mIdxToSceneObject;
+
+		// Results
+		Vector<HSceneObject> mObjects;
+		SnapData mSnapData;
+	};
+
 	/**	Handles picking of scene objects with a pointer in scene view. */
 	class BS_ED_EXPORT ScenePicking : public Module<ScenePicking>
 	{
@@ -84,18 +139,109 @@ namespace bs
 			const Vector2I& position, const Vector2I& area, Vector<HSceneObject>& ignoreRenderables, 
 			SnapData* data = nullptr);
 
-	private:
-		friend class ct::ScenePicking;
+		/**
+		 * Starts finding all scene objects under the provided position and area, without waiting for the results. The
+		 * picking pass is rendered and read back by the core thread alongside normal rendering, and the results are
+		 * available through the returned operation once it completes.
+		 *
+		 * Each owner has at most one operation in flight. Requesting a new operation while an earlier one from the same
+		 * owner is still in flight defers the new one until the earlier one completes, canceling any other deferred
+		 * operations from the same owner, so rapid repeated requests (e.g. on pointer hover) are coalesced into one.
+		 *
+		 * @param[in]	cam					Camera to perform the picking from.
+		 * @param[in]	gizmoDrawSettings	Settings used for drawing pickable gizmos.
+		 * @param[in]	position			Pointer position relative to the camera viewport, in pixels.
+		 * @param[in]	area				Width/height of the checked area in pixels. Use (1, 1) if you want the exact 
+		 *									position under the pointer.
+		 * @param[in]	ignoreRenderables	A list of objects that should be ignored during scene picking.
+		 * @param[in]	gatherSnapData		Determines should the operation also provide position and normal of the
+		 *									surface at @p position.
+		 * @param[in]	owner				Identifier of the requester, used for coalescing requests. Operations without
+		 *									an owner are never coalesced.
+		 * @return							Handle to the picking operation.
+		 */
+		SPtr<ScenePickingOp> pickObjectsAsync(const SPtr<Camera>& cam, const GizmoDrawSettings& gizmoDrawSettings,
+			const Vector2I& position, const Vector2I& area, const Vector<HSceneObject>& ignoreRenderables,
+			bool gatherSnapData = false, const void* owner = nullptr);
 
-		typedef Set<RenderablePickData, std::function<bool(const RenderablePickData&, const RenderablePickData&)>> RenderableSet;
+		/**
+		 * Determines which objects were picked, given the identifiers of all the pixels in the picked area. Pixels that
+		 * didn't contain an object are ignored.
+		 *
+		 * @param[in]	ids		Identifiers of picked pixels, as encoded by encodeIndex().
+		 * @param[in]	numIds	Number of entries in @p ids.
+		 * @return				Unique identifiers of all picked objects, ordered by the number of pixels they cover 
+		 *						(highest first), and by identifier for objects covering the same number of pixels.
+		 */
+		static Vector<UINT32> rankPickedIndices(const UINT32* ids, UINT32 numIds);
+
+		/**
+		 * Decodes the identifiers of all pixels in the provided pixel data and determines which objects were picked. Pixel
+		 * colors should have initially been encoded with encodeIndex(). 
+		 *
+		 * @param[in]	pixelData	Pixels of the picked area, starting at its top left corner.
+		 * @param[in]	width		Width of the picked area, in pixels.
+		 * @param[in]	height		Height of the picked area, in pixels.
+		 * @return					Unique identifiers of all picked objects, in the same order as rankPickedIndices().
+		 */
+		static Vector<UINT32> rankPickedPixels(const PixelData& pixelData, UINT32 width, UINT32 height);
 
 		/**	Encodes a pickable object identifier to a unique color. */
 		static Color encodeIndex(UINT32 index);
 
+		/** Cancels all in flight and deferred operations from the specified owner. */
+		void cancel(const void* owner);
+
+		/** Issues deferred operations whose owners no longer have an operation in flight. Should be called once per frame. */
+		void update();
+
+	private:
+		friend class ct::ScenePicking;
+		friend class ScenePickingOp;
+
+		typedef Set<RenderablePickData, std::function<bool(const RenderablePickData&, const RenderablePickData&)>> RenderableSet;
+
 		/** Decodes a color into a unique object identifier. Color should have initially been encoded with encodeIndex(). */
 		static UINT32 decodeIndex(Color color);
 
+		/** Identifier of pixels that don't contain any pickable object. */
+		static constexpr UINT32 EMPTY_INDEX = 0x00FFFFFF;
+
+		/** Largest number of identifiers counted in a flat array, identifiers past it are counted by sorting. */
+		static constexpr UINT32 MAX_DENSE_INDICES = 65536;
+
+		/** Counts the number of pixels covered by each picked object. */
+		class PickedIndexCounter
+		{
+		public:
+			/** @param[in]	numPixels	Number of pixels that will be counted. */
+			PickedIndexCounter(UINT32 numPixels);
+
+			/** Counts a single pixel with the provided identifier. Pixels that don't contain an object are ignored. */
+			void add(UINT32 index)
+			{
+				// Identifiers are allocated sequentially so they're usually small, and can be counted directly
+				if (index < (UINT32)mCounts.size())
+					mCounts[index]++;
+				else if (index != EMPTY_INDEX)
+					mSparseIndices.push_back(index);
+			}
+
+			/** Returns the unique identifiers of all counted objects, ordered as described by rankPickedIndices(). */
+			Vector<UINT32> rank();
+
+		private:
+			Vector<UINT32> mCounts;
+			Vector<UINT32> mSparseIndices;
+		};
+
+		/** Queues the picking pass of the provided operation on the core thread. */
+		void issue(ScenePickingOp& op);
+
 		ct::ScenePicking* mCore;
+
+		Vector<SPtr<ScenePickingOp>> mInFlightOps;
+		Vector<SPtr<ScenePickingOp>> mDeferredOps;
 	};
 
 	/** @} */
@@ -156,9 +302,28 @@ namespace bs
 	private:
 		friend class bs::ScenePicking;
 
+		/** 
+		 * Staging textures used for reading back a part of a picking texture. Single pixel picks are kept separate from
+		 * area picks, so a large area pick doesn't cause every following click to read back the large area.
+		 */
+		struct StagingTextures
+		{
+			SPtr<Texture> pixel;
+			SPtr<Texture> area;
+		};
+
+		/** 
+		 * Copies the provided area of the texture into a staging texture of matching size and format, and reads its
+		 * contents back. Avoids reading back the entire texture when only a small area is of interest.
+		 */
+		SPtr<PixelData> readArea(const SPtr<Texture>& texture, const PixelVolume& area, StagingTextures& staging);
+
 		static const float ALPHA_CUTOFF;
 
 		SPtr<RenderTexture> mPickingTexture;
+		SPtr<Texture> mNormalsTexture;
+		StagingTextures mColorStaging;
+		StagingTextures mNormalsStaging;
 
 		SPtr<Material> mMaterials[6];
 		Vector<SPtr<GpuParamsSet>> mParamSets[6];
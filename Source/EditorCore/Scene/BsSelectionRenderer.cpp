@@ -11,13 +11,12 @@
 #include "Material/BsGpuParamsSet.h"
 #include "RenderAPI/BsRenderAPI.h"
 #include "Renderer/BsRenderer.h"
-#include "Scene/BsSelection.h"
+#include "Scene/BsEditorSceneSnapshot.h"
 #include "Scene/BsSceneObject.h"
-#include "Components/BsCRenderable.h"
 #include "Renderer/BsRenderable.h"
-#include "Scene/BsSceneManager.h"
 #include "Renderer/BsRendererUtility.h"
 #include "RenderAPI/BsGpuBuffer.h"
+#include "Utility/BsEditorProfiler.h"
 
 using namespace std::placeholders;
 
@@ -35,23 +34,10 @@ namespace bs
 
 	void SelectionRenderer::update(const SPtr<Camera>& camera)
 	{
-		Vector<SPtr<ct::Renderable>> objects;
+		BS_EDITOR_PROFILE_SCOPE("Selection", "SelectionRenderer::update");
 
-		const Vector<HSceneObject>& sceneObjects = Selection::instance().getSceneObjects();
-		Vector<HRenderable> renderables = gSceneManager().findComponents<CRenderable>(true);
-
-		for (auto& renderable : renderables)
-		{
-			HSceneObject renderableSO = renderable->SO();
-			for (auto& so : sceneObjects)
-			{
-				if (renderableSO != so)
-					continue;
-
-				if (renderable->getMesh().isLoaded())
-					objects.push_back(renderable->_getInternal()->getCore());
-			}
-		}
+		// Selected renderables are shared between all views, only gathered once per frame
+		const Vector<SPtr<ct::Renderable>>& objects = EditorSceneSnapshot::instance().getSelectedRenderables();
 
 		ct::SelectionRendererCore* renderer = mRenderer.get();
 		gCoreThread().queueCommand(std::bind(&ct::SelectionRendererCore::updateData, renderer, camera->getCore(), objects));
@@ -135,6 +121,7 @@ namespace bs
 	void SelectionRendererCore::render(const Camera& camera)
 	{
 		THROW_IF_NOT_CORE_THREAD;
+		BS_EDITOR_PROFILE_SCOPE("Selection", "SelectionRendererCore::render");
 
 		Matrix4 viewProjMat = mCamera->getProjectionMatrixRS() * mCamera->getViewMatrix();
 
@@ -3,16 +3,220 @@
 #include "Scene/BsSerializedSceneObject.h"
 #include "Scene/BsSceneObject.h"
 #include "Serialization/BsMemorySerializer.h"
+#include "Serialization/BsBinaryDiff.h"
+#include "Reflection/BsRTTIType.h"
 #include "Utility/BsUtility.h"
 
 namespace bs
 {
+	/** 
+	 * Returns the scene object flags that are recorded and restored by SerializedSceneObject. Instantiation state is
+	 * handled separately by the full restore.
+	 */
+	static UINT32 getRestoredFlags(const HSceneObject& so)
+	{
+		UINT32 flags = 0;
+		for (auto flag : { SOF_DontSave, SOF_Persistent, SOF_Internal })
+		{
+			if (so->hasFlag(flag))
+				flags |= flag;
+		}
+
+		return flags;
+	}
+
+	SerializedSceneObjectStructure::~SerializedSceneObjectStructure()
+	{
+		if (data != nullptr)
+			bs_free(data);
+	}
+
+	SPtr<SerializedObject> SerializedSceneObjectCache::recordComponent(const HComponent& component)
+	{
+		// Encoding into a flat buffer is much cheaper than building a SerializedObject, and allows unchanged components
+		// to be detected with a simple comparison instead of a diff
+		UINT32 size = 0;
+		MemorySerializer serializer;
+		UINT8* data = serializer.encode(component.get(), size);
+
+		Lock lock(mMutex);
+
+		auto result = mComponentStates.insert(std::make_pair(component->getInstanceId(), ComponentEntry()));
+		ComponentEntry& entry = result.first->second;
+
+		SPtr<SerializedObject> state = entry.state.lock();
+		bool changed = state == nullptr || entry.data.size() != size ||
+			(size > 0 && memcmp(entry.data.data(), data, size) != 0);
+
+		if (changed)
+		{
+			state = SerializedObject::create(*component.get());
+
+			entry.data.assign(data, data + size);
+			entry.state = state;
+		}
+
+		bs_free(data);
+
+		if (result.second)
+			prune();
+
+		return state;
+	}
+
+	SPtr<SerializedSceneObjectStructure> SerializedSceneObjectCache::findStructure(UINT64 instanceId, bool hierarchy,
+		const Vector<UINT64>& layout)
+	{
+		Lock lock(mMutex);
+
+		const UnorderedMap<UINT64, StructureEntry>& structures = mStructures[hierarchy ? 1 : 0];
+
+		auto iterFind = structures.find(instanceId);
+		if (iterFind == structures.end() || iterFind->second.layout != layout)
+			return nullptr;
+
+		return iterFind->second.structure.lock();
+	}
+
+	void SerializedSceneObjectCache::registerStructure(UINT64 instanceId, bool hierarchy, const Vector<UINT64>& layout,
+		const SPtr<SerializedSceneObjectStructure>& structure)
+	{
+		Lock lock(mMutex);
+
+		StructureEntry& entry = mStructures[hierarchy ? 1 : 0][instanceId];
+		entry.layout = layout;
+		entry.structure = structure;
+
+		prune();
+	}
+
+	void SerializedSceneObjectCache::prune()
+	{
+		UINT32 numEntries = (UINT32)(mComponentStates.size() + mStructures[0].size() + mStructures[1].size());
+		if (numEntries < mPruneThreshold)
+			return;
+
+		for (auto iter = mComponentStates.begin(); iter != mComponentStates.end();)
+		{
+			if (iter->second.state.expired())
+				iter = mComponentStates.erase(iter);
+			else
+				++iter;
+		}
+
+		for (auto& structures : mStructures)
+		{
+			for (auto iter = structures.begin(); iter != structures.end();)
+			{
+				if (iter->second.structure.expired())
+					iter = structures.erase(iter);
+				else
+					++iter;
+			}
+		}
+
+		numEntries = (UINT32)(mComponentStates.size() + mStructures[0].size() + mStructures[1].size());
+		mPruneThreshold = std::max(numEntries * 2, MIN_PRUNE_THRESHOLD);
+	}
+
 	SerializedSceneObject::SerializedSceneObject(const HSceneObject& sceneObject, bool hierarchy)
 		:mSceneObject(sceneObject), mRecordHierarchy(hierarchy)
 	{
 		if(mSceneObject.isDestroyed())
 			return;
 
+		HSceneObject parent = sceneObject->getParent();
+		if (parent != nullptr)
+			mSerializedObjectParentId = parent->getInstanceId();
+
+		Vector<UINT64> layout;
+		recordState(mSceneObject, mRecordHierarchy, layout);
+
+		// Most snapshots are recorded for edits that don't change the structure, in which case the complete serialized
+		// object recorded by an earlier snapshot can be used, and then patched with this snapshot's per-object state
+		const UINT64 instanceId = mSceneObject->getInstanceId();
+		if (SerializedSceneObjectCache::isStarted())
+		{
+			SerializedSceneObjectCache& cache = SerializedSceneObjectCache::instance();
+			mStructure = cache.findStructure(instanceId, mRecordHierarchy, layout);
+
+			if (mStructure == nullptr)
+			{
+				mStructure = recordStructure();
+				cache.registerStructure(instanceId, mRecordHierarchy, layout, mStructure);
+			}
+		}
+		else
+			mStructure = recordStructure();
+	}
+
+	void SerializedSceneObject::recordState(const HSceneObject& sceneObject, bool hierarchy, Vector<UINT64>& layout)
+	{
+		SerializedSceneObjectCache* cache = nullptr;
+		if (SerializedSceneObjectCache::isStarted())
+			cache = SerializedSceneObjectCache::instancePtr();
+
+		mStates.push_back(SceneObjectState());
+		SceneObjectState& state = mStates.back();
+
+		state.sceneObject = sceneObject;
+		state.instanceId = sceneObject->getInstanceId();
+		state.name = sceneObject->getName();
+
+		const Transform& tfrm = sceneObject->getLocalTransform();
+		state.position = tfrm.getPosition();
+		state.rotation = tfrm.getRotation();
+		state.scale = tfrm.getScale();
+		state.active = sceneObject->getActive(true);
+		state.mobility = sceneObject->getMobility();
+
+		state.flags = getRestoredFlags(sceneObject);
+
+		state.prefabLink = sceneObject->getPrefabLink(true);
+		state.prefabDiff = sceneObject->_getPrefabDiff();
+		state.linkId = sceneObject->getLinkId();
+
+		layout.push_back(state.instanceId);
+
+		const Vector<HComponent>& components = sceneObject->getComponents();
+		state.components.reserve(components.size());
+		layout.push_back(components.size());
+
+		for (auto& component : components)
+		{
+			ComponentState componentState;
+			componentState.component = component;
+			componentState.instanceId = component->getInstanceId();
+
+			if (cache != nullptr)
+				componentState.data = cache->recordComponent(component);
+			else
+				componentState.data = SerializedObject::create(*component.get());
+
+			state.components.push_back(componentState);
+			layout.push_back(componentState.instanceId);
+		}
+
+		UINT32 numChildren = sceneObject->getNumChildren();
+		state.childIds.reserve(numChildren);
+
+		for (UINT32 i = 0; i < numChildren; i++)
+			state.childIds.push_back(sceneObject->getChild(i)->getInstanceId());
+
+		// Note: 'state' is invalidated past this point, as the recursive calls can reallocate the array
+		if (hierarchy)
+		{
+			layout.push_back(numChildren);
+
+			for (UINT32 i = 0; i < numChildren; i++)
+				recordState(sceneObject->getChild(i), true, layout);
+		}
+	}
+
+	SPtr<SerializedSceneObjectStructure> SerializedSceneObject::recordStructure() const
+	{
+		SPtr<SerializedSceneObjectStructure> structure = bs_shared_ptr_new<SerializedSceneObjectStructure>();
+
 		UINT32 numChildren = mSceneObject->getNumChildren();
 		HSceneObject* children = nullptr;
 
@@ -32,36 +236,108 @@ namespace bs
 		mSceneObject->_setFlags(SOF_DontInstantiate);
 
 		MemorySerializer serializer;
-		mSerializedObject = serializer.encode(mSceneObject.get(), mSerializedObjectSize);
+		structure->data = serializer.encode(mSceneObject.get(), structure->size);
 
 		if (isInstantiated)
 			mSceneObject->_unsetFlags(SOF_DontInstantiate);
 
-		mSceneObjectProxy = EditorUtility::createProxy(mSceneObject);
+		structure->proxy = EditorUtility::createProxy(mSceneObject);
 
-		HSceneObject parent = sceneObject->getParent();
-		if (parent != nullptr)
-			mSerializedObjectParentId = parent->getInstanceId();
+		for (auto& state : mStates)
+		{
+			for (auto& componentState : state.components)
+				structure->components.push_back(componentState.data);
+		}
 
 		if (!mRecordHierarchy)
 		{
 			for (UINT32 i = 0; i < numChildren; i++)
-				children[i]->setParent(sceneObject->getHandle());
+				children[i]->setParent(mSceneObject);
 
 			bs_stack_delete(children, numChildren);
 		}
+
+		return structure;
 	}
 
-	SerializedSceneObject::~SerializedSceneObject()
+	bool SerializedSceneObject::canRestoreInPlace() const
 	{
-		if (mSerializedObject != nullptr)
+		if (mStates.empty())
+			return false;
+
+		// Parent changes are handled by the full restore path
+		HSceneObject parent = mSceneObject->getParent();
+		UINT64 parentId = parent != nullptr ? parent->getInstanceId() : 0;
+		if (parentId != mSerializedObjectParentId)
+			return false;
+
+		for (auto& state : mStates)
 		{
-			bs_free(mSerializedObject);
-			mSerializedObject = nullptr;
+			if (state.sceneObject.isDestroyed())
+				return false;
+
+			const Vector<HComponent>& components = state.sceneObject->getComponents();
+			if (components.size() != state.components.size())
+				return false;
+
+			for (UINT32 i = 0; i < (UINT32)components.size(); i++)
+			{
+				if (components[i]->getInstanceId() != state.components[i].instanceId)
+					return false;
+			}
+
+			// When not recording the hierarchy children are left untouched by restore, so only their presence matters
+			// for the hierarchy case
+			if (mRecordHierarchy)
+			{
+				UINT32 numChildren = state.sceneObject->getNumChildren();
+				if (numChildren != (UINT32)state.childIds.size())
+					return false;
+
+				for (UINT32 i = 0; i < numChildren; i++)
+				{
+					if (state.sceneObject->getChild(i)->getInstanceId() != state.childIds[i])
+						return false;
+				}
+			}
 		}
+
+		return true;
 	}
 
-	void SerializedSceneObject::restore()
+	void SerializedSceneObject::restoreInPlace()
+	{
+		SerializedSceneObjectCache* cache = nullptr;
+		if (SerializedSceneObjectCache::isStarted())
+			cache = SerializedSceneObjectCache::instancePtr();
+
+		BinaryDiff diffHandler;
+		for (auto& state : mStates)
+		{
+			restoreSceneObject(state);
+
+			for (auto& componentState : state.components)
+			{
+				const HComponent& component = componentState.component;
+
+				SPtr<SerializedObject> current;
+				if (cache != nullptr)
+					current = cache->recordComponent(component);
+				else
+					current = SerializedObject::create(*component.get());
+
+				// Unchanged components are left untouched
+				if (current == componentState.data)
+					continue;
+
+				SPtr<SerializedObject> diff = diffHandler.generateDiff(current, componentState.data);
+				if (diff != nullptr)
+					applyComponentDiff(component, diff);
+			}
+		}
+	}
+
+	void SerializedSceneObject::restoreFull()
 	{
 		HSceneObject parent;
 		if (mSerializedObjectParentId != 0)
@@ -92,9 +368,9 @@ namespace bs
 
 		MemorySerializer serializer;
 		SPtr<SceneObject> restored = std::static_pointer_cast<SceneObject>(
-			serializer.decode(mSerializedObject, mSerializedObjectSize, &serzContext));
+			serializer.decode(mStructure->data, mStructure->size, &serzContext));
 
-		EditorUtility::restoreIds(restored->getHandle(), mSceneObjectProxy);
+		EditorUtility::restoreIds(restored->getHandle(), mStructure->proxy);
 		restored->setParent(parent);
 
 		if (children)
@@ -106,5 +382,89 @@ namespace bs
 		}
 
 		restored->_instantiate();
+
+		// The structure might have been recorded by an earlier snapshot, bring it up to date with this one. Components
+		// are patched from the states recorded along with the structure, so the restored objects aren't re-serialized.
+		BinaryDiff diffHandler;
+		UINT32 componentIdx = 0;
+		for (auto& state : mStates)
+		{
+			restoreSceneObject(state);
+
+			for (auto& componentState : state.components)
+			{
+				const SPtr<SerializedObject>& restoredState = mStructure->components[componentIdx++];
+				if (restoredState == componentState.data)
+					continue;
+
+				SPtr<SerializedObject> diff = diffHandler.generateDiff(restoredState, componentState.data);
+				if (diff != nullptr)
+					applyComponentDiff(componentState.component, diff);
+			}
+		}
+	}
+
+	void SerializedSceneObject::restoreSceneObject(const SceneObjectState& state)
+	{
+		const HSceneObject& so = state.sceneObject;
+
+		if (so->getName() != state.name)
+			so->setName(state.name);
+
+		const Transform& tfrm = so->getLocalTransform();
+		if (tfrm.getPosition() != state.position)
+			so->setPosition(state.position);
+
+		if (tfrm.getRotation() != state.rotation)
+			so->setRotation(state.rotation);
+
+		if (tfrm.getScale() != state.scale)
+			so->setScale(state.scale);
+
+		if (so->getActive(true) != state.active)
+			so->setActive(state.active);
+
+		if (so->getMobility() != state.mobility)
+			so->setMobility(state.mobility);
+
+		// Flags propagate to children, so only touch them if they actually differ
+		UINT32 flags = getRestoredFlags(so);
+		if (flags != state.flags)
+		{
+			so->_unsetFlags(flags & ~state.flags);
+			so->_setFlags(state.flags & ~flags);
+		}
+
+		if (so->getPrefabLink(true) != state.prefabLink)
+			so->_setPrefabLinkUUID(state.prefabLink);
+
+		if (so->_getPrefabDiff() != state.prefabDiff)
+			so->_setPrefabDiff(state.prefabDiff);
+
+		if (so->getLinkId() != state.linkId)
+			so->_setLinkId(state.linkId);
+	}
+
+	void SerializedSceneObject::applyComponentDiff(const HComponent& component, const SPtr<SerializedObject>& diff)
+	{
+		CoreSerializationContext serzContext;
+		serzContext.goState = bs_shared_ptr_new<GameObjectDeserializationState>(GODM_RestoreExternal);
+
+		SPtr<IReflectable> componentPtr = component.getInternalPtr();
+		IDiff& componentDiffHandler = component->getRTTI()->getDiffHandler();
+		componentDiffHandler.applyDiff(componentPtr, diff, &serzContext);
+
+		serzContext.goState->resolve();
+	}
+
+	void SerializedSceneObject::restore()
+	{
+		if (mStructure == nullptr)
+			return;
+
+		if (!mSceneObject.isDestroyed() && canRestoreInPlace())
+			restoreInPlace();
+		else
+			restoreFull();
 	}
 }
@@ -4,6 +4,11 @@
 
 #include "BsEditorPrerequisites.h"
 #include "Utility/BsEditorUtility.h"
+#include "Utility/BsModule.h"
+#include "Math/BsVector3.h"
+#include "Math/BsQuaternion.h"
+#include "Scene/BsSceneObject.h"
+#include "Serialization/BsSerializedObject.h"
 
 namespace bs
 {
@@ -11,13 +16,122 @@ namespace bs
 	*  @{
 	*/
 
+	/** Complete serialized data of a scene object, used for restoring it when its structure changes. */
+	struct SerializedSceneObjectStructure
+	{
+		~SerializedSceneObjectStructure();
+
+		UINT8* data = nullptr;
+		UINT32 size = 0;
+		EditorUtility::SceneObjProxy proxy;
+
+		/** 
+		 * States of all components contained in the serialized data, at the time the data was serialized. In the same
+		 * order as the components were recorded by SerializedSceneObject.
+		 */
+		Vector<SPtr<SerializedObject>> components;
+	};
+
+	/**
+	 * Keeps track of the most recently recorded state of scene objects and their components, so that SerializedSceneObject
+	 * snapshots of an unchanged component or scene object structure can share the recorded data instead of each keeping
+	 * its own copy. Started and shut down together with UndoRedo.
+	 */
+	class BS_ED_EXPORT SerializedSceneObjectCache : public Module<SerializedSceneObjectCache>
+	{
+	public:
+		/**
+		 * Returns the current state of the component. If the component didn't change since its most recently recorded
+		 * state, that state is returned. Otherwise a new state is recorded and registered as the most recent one.
+		 */
+		SPtr<SerializedObject> recordComponent(const HComponent& component);
+
+		/**
+		 * Returns previously recorded serialized data of a scene object, if the object still has the same structure as
+		 * when the data was recorded. Returns null otherwise.
+		 *
+		 * @param[in]	instanceId	Instance ID of the root scene object.
+		 * @param[in]	hierarchy	True if the data should include the children of the root scene object.
+		 * @param[in]	layout		Instance IDs of all scene objects and components in the structure, as well as their
+		 *							counts, as recorded by SerializedSceneObject.
+		 */
+		SPtr<SerializedSceneObjectStructure> findStructure(UINT64 instanceId, bool hierarchy, 
+			const Vector<UINT64>& layout);
+
+		/** Registers serialized data of a scene object so it can be shared with later snapshots. See findStructure(). */
+		void registerStructure(UINT64 instanceId, bool hierarchy, const Vector<UINT64>& layout, 
+			const SPtr<SerializedSceneObjectStructure>& structure);
+
+	private:
+		/** Most recently recorded state of a component. */
+		struct ComponentEntry
+		{
+			Vector<UINT8> data;
+			std::weak_ptr<SerializedObject> state;
+		};
+
+		/** Structure registered through registerStructure(). */
+		struct StructureEntry
+		{
+			Vector<UINT64> layout;
+			std::weak_ptr<SerializedSceneObjectStructure> structure;
+		};
+
+		/** Removes entries that are no longer referenced by any snapshot, if enough entries were added since last time. */
+		void prune();
+
+		static constexpr UINT32 MIN_PRUNE_THRESHOLD = 1024;
+
+		UnorderedMap<UINT64, ComponentEntry> mComponentStates;
+		UnorderedMap<UINT64, StructureEntry> mStructures[2];
+		UINT32 mPruneThreshold = MIN_PRUNE_THRESHOLD;
+		Mutex mMutex;
+	};
+
 	/**
-	 * Serializes the current state of a scene object and allows that state to be restored. The advantage of using this 
+	 * Serializes the current state of a scene object and allows that state to be restored. The advantage of using this
 	 * class versus normal serialization is that the deserialization happens into the original scene object, instead of
 	 * creating a new scene object.
+	 *
+	 * The state of each scene object and each of its components is recorded separately. Only components that changed
+	 * since a previous snapshot get a new state recorded, while unchanged components share the state of the previous
+	 * snapshot. The complete serialized object, required for restoring deleted objects or objects whose structure
+	 * changed, is only re-encoded when the structure (components and children) differs from the one recorded by a
+	 * previous snapshot, and is otherwise shared. When restoring, if the hierarchy structure hasn't changed only the
+	 * components whose state differs are patched, without re-creating the scene objects.
 	 */
 	class BS_ED_EXPORT BS_SCRIPT_EXPORT(m:Utility-Editor,api:bed) SerializedSceneObject final
 	{
+		/** Recorded state of a single component. */
+		struct ComponentState
+		{
+			HComponent component;
+			UINT64 instanceId;
+			SPtr<SerializedObject> data;
+		};
+
+		/** Recorded state of a single scene object, excluding its children. */
+		struct SceneObjectState
+		{
+			HSceneObject sceneObject;
+			UINT64 instanceId;
+
+			String name;
+			Vector3 position;
+			Quaternion rotation;
+			Vector3 scale;
+			bool active;
+			ObjectMobility mobility;
+			UINT32 flags;
+
+			UUID prefabLink;
+			SPtr<PrefabDiff> prefabDiff;
+			UINT32 linkId;
+
+			Vector<ComponentState> components;
+			Vector<UINT64> childIds;
+		};
+
 	public:
 		/**
 		 * Serializes the current state of the provided scene object.
@@ -28,7 +142,6 @@ namespace bs
 		 */
 		BS_SCRIPT_EXPORT()
 		SerializedSceneObject(const HSceneObject& sceneObject, bool hierarchy = false);
-		~SerializedSceneObject();
 
 		/**
 		 * Restores the scene object to the state as it was when this object was created. If the scene object was deleted
@@ -40,14 +153,52 @@ namespace bs
 	private:
 		friend class UndoRedo;
 
+		/**
+		 * Records the per-component state of the provided scene object, and optionally its children, appending it to
+		 * @p mStates. Instance IDs of the recorded objects and their counts are appended to @p layout, uniquely
+		 * identifying the recorded structure.
+		 */
+		void recordState(const HSceneObject& sceneObject, bool hierarchy, Vector<UINT64>& layout);
+
+		/** 
+		 * Serializes the complete scene object, including the components and optionally its children. Must be called
+		 * after recordState().
+		 */
+		SPtr<SerializedSceneObjectStructure> recordStructure() const;
+
+		/**
+		 * Checks if the components and children of the live scene objects still match the ones that were recorded,
+		 * meaning the state can be restored by patching the objects in place.
+		 */
+		bool canRestoreInPlace() const;
+
+		/**
+		 * Restores the recorded state into the existing scene objects, only modifying components whose state differs
+		 * from the recorded one. Caller must ensure canRestoreInPlace() returns true.
+		 */
+		void restoreInPlace();
+
+		/** 
+		 * Restores the state by destroying the existing scene object and deserializing the complete recorded state. The 
+		 * recorded structure might have been shared with an earlier snapshot, in which case the components whose state
+		 * changed since are patched to the state recorded by this snapshot.
+		 */
+		void restoreFull();
+
+		/** Restores the recorded name, transform, flags and prefab data of a single scene object. */
+		static void restoreSceneObject(const SceneObjectState& state);
+
+		/** Applies a diff generated by BinaryDiff to the component. */
+		static void applyComponentDiff(const HComponent& component, const SPtr<SerializedObject>& diff);
+
 		HSceneObject mSceneObject;
-		EditorUtility::SceneObjProxy mSceneObjectProxy;
 		bool mRecordHierarchy;
 
-		UINT8* mSerializedObject = nullptr;
-		UINT32 mSerializedObjectSize = 0;
+		SPtr<SerializedSceneObjectStructure> mStructure;
 		UINT64 mSerializedObjectParentId = 0;
+
+		Vector<SceneObjectState> mStates;
 	};
 
 	/** @} */
-}
\ No newline at end of file
+}
@@ -0,0 +1,527 @@
+//********************************** Banshee Engine (www.banshee3d.com) **************************************************//
+//**************** Copyright (c) 2019 Marko Pintera (marko.pintera@gmail.com). All rights reserved. **********************//
+#include "Testing/BsEditorBenchmarkSuite.h"
+#include "Testing/BsEditorTestSuite.h"
+#include "Testing/BsTestOutput.h"
+#include "BsEditorApplication.h"
+#include "Library/BsProjectLibrary.h"
+#include "Scene/BsSceneObject.h"
+#include "Scene/BsSerializedSceneObject.h"
+#include "Scene/BsPrefab.h"
+#include "Scene/BsPrefabDiff.h"
+#include "Scene/BsGizmoManager.h"
+#include "GUI/BsGUISceneTreeView.h"
+#include "GUI/BsCGUIWidget.h"
+#include "GUI/BsGUIPanel.h"
+#include "Components/BsCCamera.h"
+#include "Renderer/BsCamera.h"
+#include "RenderAPI/BsViewport.h"
+#include "Utility/BsBuiltinEditorResources.h"
+#include "Utility/BsEditorUtility.h"
+#include "Utility/BsTimer.h"
+#include "Math/BsRandom.h"
+#include "FileSystem/BsFileSystem.h"
+#include "FileSystem/BsDataStream.h"
+#include "Debug/BsLog.h"
+
+namespace bs
+{
+	/** Number of children each scene object in the synthetic scene has, apart from the leaves. */
+	static constexpr UINT32 SCENE_FAN_OUT = 8;
+
+	/** Reads an unsigned integer from an environment variable, or returns the default value if it isn't set. */
+	static UINT32 readEnvironmentValue(const char* name, UINT32 defaultValue)
+	{
+		const char* value = std::getenv(name);
+		if (value == nullptr)
+			return defaultValue;
+
+		return parseUINT32(value, defaultValue);
+	}
+
+	EditorBenchmarkSuite::EditorBenchmarkSuite(const EditorBenchmarkDesc& desc)
+		:mDesc(desc)
+	{
+		if (mDesc.projectFolder.isEmpty())
+		{
+			const String folderName = "EditorBenchmarkProject-" + UUIDGenerator::generateRandom().toString();
+			mDesc.projectFolder = Path::combine(FileSystem::getTempDirectoryPath(), folderName);
+		}
+
+		mDesc.numIterations = std::max(mDesc.numIterations, 1U);
+
+		BS_ADD_TEST(EditorBenchmarkSuite::BenchmarkProjectLibrary);
+		BS_ADD_TEST(EditorBenchmarkSuite::BenchmarkUndoRecord);
+		BS_ADD_TEST(EditorBenchmarkSuite::BenchmarkPrefabDiff);
+		BS_ADD_TEST(EditorBenchmarkSuite::BenchmarkSceneOperations);
+		BS_ADD_TEST(EditorBenchmarkSuite::BenchmarkSceneTree);
+		BS_ADD_TEST(EditorBenchmarkSuite::BenchmarkGizmos);
+		BS_ADD_TEST(EditorBenchmarkSuite::BenchmarkHandleSliders);
+	}
+
+	bool EditorBenchmarkSuite::runAndReport(const Path& outputPath)
+	{
+		if (!gEditorApplication().isHeadless() || gEditorApplication().isProjectLoaded())
+		{
+			BS_LOG(Error, Editor, "Editor benchmarks can only run in a headless editor with no project loaded.");
+			return false;
+		}
+
+		EditorBenchmarkDesc desc;
+		desc.numDirectories = readEnvironmentValue("BS_EDITOR_BENCHMARK_DIRECTORIES", desc.numDirectories);
+		desc.numFiles = readEnvironmentValue("BS_EDITOR_BENCHMARK_FILES", desc.numFiles);
+		desc.numSceneObjects = readEnvironmentValue("BS_EDITOR_BENCHMARK_OBJECTS", desc.numSceneObjects);
+		desc.numComponentsPerObject = readEnvironmentValue("BS_EDITOR_BENCHMARK_COMPONENTS", desc.numComponentsPerObject);
+		desc.numIterations = readEnvironmentValue("BS_EDITOR_BENCHMARK_ITERATIONS", desc.numIterations);
+
+		SPtr<EditorBenchmarkSuite> benchmarkSuite = bs_shared_ptr_new<EditorBenchmarkSuite>(desc);
+		ExceptionTestOutput testOutput;
+		benchmarkSuite->run(testOutput);
+
+		const String report = benchmarkSuite->getReport();
+
+		SPtr<DataStream> stream = FileSystem::createAndOpenFile(outputPath);
+		stream->write(report.c_str(), report.size() * sizeof(String::value_type));
+		stream->close();
+
+		BS_LOG(Info, Editor, "Editor benchmark results written to {0}", outputPath);
+		return true;
+	}
+
+	String EditorBenchmarkSuite::getReport() const
+	{
+		StringStream output;
+		output << "{\n";
+		output << "\t\"config\": {\n";
+		output << "\t\t\"directories\": " << mDesc.numDirectories << ",\n";
+		output << "\t\t\"files\": " << mDesc.numFiles << ",\n";
+		output << "\t\t\"sceneObjects\": " << mDesc.numSceneObjects << ",\n";
+		output << "\t\t\"componentsPerObject\": " << mDesc.numComponentsPerObject << ",\n";
+		output << "\t\t\"iterations\": " << mDesc.numIterations << "\n";
+		output << "\t},\n";
+		output << "\t\"results\": [";
+
+		for (UINT32 i = 0; i < (UINT32)mResults.size(); i++)
+		{
+			const Result& result = mResults[i];
+
+			Vector<UINT64> sorted = result.samples;
+			std::sort(sorted.begin(), sorted.end());
+
+			UINT64 total = 0;
+			for (auto& sample : sorted)
+				total += sample;
+
+			const UINT64 numSamples = (UINT64)sorted.size();
+
+			output << (i > 0 ? ",\n" : "\n");
+			output << "\t\t{ \"name\": \"" << result.name << "\", ";
+			output << "\"iterations\": " << numSamples << ", ";
+			output << "\"minUs\": " << sorted.front() << ", ";
+			output << "\"medianUs\": " << sorted[sorted.size() / 2] << ", ";
+			output << "\"meanUs\": " << total / numSamples << ", ";
+			output << "\"maxUs\": " << sorted.back() << " }";
+		}
+
+		output << "\n\t]\n";
+		output << "}\n";
+
+		return output.str();
+	}
+
+	void EditorBenchmarkSuite::measure(const String& name, const std::function<void()>& prepare,
+		const std::function<void()>& func)
+	{
+		Result result;
+		result.name = name;
+		result.samples.reserve(mDesc.numIterations);
+
+		for (UINT32 i = 0; i < mDesc.numIterations; i++)
+		{
+			if (prepare)
+				prepare();
+
+			Timer timer;
+			func();
+			result.samples.push_back(timer.getMicroseconds());
+		}
+
+		mResults.push_back(result);
+	}
+
+	HSceneObject EditorBenchmarkSuite::createSyntheticScene(Vector<HSceneObject>* objects) const
+	{
+		Vector<HSceneObject> createdObjects;
+		createdObjects.reserve(mDesc.numSceneObjects + 1);
+
+		HSceneObject root = SceneObject::create("BenchmarkRoot");
+		createdObjects.push_back(root);
+
+		for (UINT32 i = 0; i < mDesc.numSceneObjects; i++)
+		{
+			HSceneObject parent = createdObjects[i / SCENE_FAN_OUT];
+
+			HSceneObject so = SceneObject::create("Object" + toString(i));
+			so->setParent(parent);
+			so->setPosition(Vector3((float)(i % 100), (float)(i / 100), 0.0f));
+
+			for (UINT32 j = 0; j < mDesc.numComponentsPerObject; j++)
+			{
+				GameObjectHandle<TestComponentB> component = so->addComponent<TestComponentB>();
+				component->ref1 = parent;
+				component->val1 = "Value" + toString(j);
+			}
+
+			createdObjects.push_back(so);
+		}
+
+		if (objects != nullptr)
+			*objects = std::move(createdObjects);
+
+		return root;
+	}
+
+	bool EditorBenchmarkSuite::createSyntheticProject() const
+	{
+		// Never delete an existing folder, it could be a real project
+		const Path& projectFolder = mDesc.projectFolder;
+		if (FileSystem::exists(projectFolder))
+		{
+			BS_LOG(Error, Editor, "Benchmark project folder {0} already exists.", projectFolder);
+			return false;
+		}
+
+		gEditorApplication().createProject(projectFolder);
+
+		const Path resourcesFolder = Path::combine(projectFolder, ProjectLibrary::RESOURCES_DIR);
+		const UINT32 numDirectories = std::max(mDesc.numDirectories, 1U);
+
+		Vector<Path> directories(numDirectories);
+		for (UINT32 i = 0; i < numDirectories; i++)
+		{
+			// Nest every other folder to get some depth in the hierarchy
+			if (i % 2 == 1)
+				directories[i] = Path::combine(directories[i - 1], "Folder" + toString(i));
+			else
+				directories[i] = Path::combine(resourcesFolder, "Folder" + toString(i));
+
+			FileSystem::createDir(directories[i]);
+		}
+
+		for (UINT32 i = 0; i < mDesc.numFiles; i++)
+		{
+			const Path filePath = Path::combine(directories[i % numDirectories], "File" + toString(i) + ".txt");
+			const String contents = "Synthetic benchmark file " + toString(i);
+
+			SPtr<DataStream> stream = FileSystem::createAndOpenFile(filePath);
+			stream->write(contents.c_str(), contents.size() * sizeof(String::value_type));
+			stream->close();
+		}
+
+		return true;
+	}
+
+	void EditorBenchmarkSuite::BenchmarkProjectLibrary()
+	{
+		// Loading the synthetic project would otherwise unload the project the user is working on
+		if (gEditorApplication().isProjectLoaded())
+		{
+			BS_LOG(Error, Editor, "Skipping the project library benchmark, a project is already loaded.");
+			return;
+		}
+
+		if (!createSyntheticProject())
+			return;
+
+		gEditorApplication().loadProject(mDesc.projectFolder);
+
+		ProjectLibrary& projectLibrary = gProjectLibrary();
+		const Path& resourcesFolder = projectLibrary.getResourcesFolder();
+
+		// First refresh imports all of the files, which only happens once
+		{
+			Result result;
+			result.name = "ProjectLibrary.checkForModifications.Import";
+
+			Timer timer;
+			projectLibrary.checkForModifications(resourcesFolder);
+			projectLibrary._finishQueuedImports(true);
+			result.samples.push_back(timer.getMicroseconds());
+
+			mResults.push_back(result);
+		}
+
+		measure("ProjectLibrary.checkForModifications.Unchanged", nullptr, [&]()
+		{
+			projectLibrary.checkForModifications(resourcesFolder);
+			projectLibrary._finishQueuedImports(true);
+		});
+
+		measure("ProjectLibrary.saveLibrary", nullptr, [&]()
+		{
+			projectLibrary.saveLibrary();
+		});
+
+		measure("ProjectLibrary.loadLibrary", nullptr, [&]()
+		{
+			projectLibrary.loadLibrary();
+		});
+
+		measure("ProjectLibrary.search", nullptr, [&]()
+		{
+			projectLibrary.search("*File1*");
+		});
+
+		gEditorApplication().unloadProject();
+		FileSystem::remove(mDesc.projectFolder, true);
+	}
+
+	void EditorBenchmarkSuite::BenchmarkUndoRecord()
+	{
+		Vector<HSceneObject> objects;
+		HSceneObject root = createSyntheticScene(&objects);
+
+		SPtr<SerializedSceneObject> serializedSO;
+		measure("Undo.Record", nullptr, [&]()
+		{
+			serializedSO = bs_shared_ptr_new<SerializedSceneObject>(root, true);
+		});
+
+		// Modify a single component, the common case when undoing an inspector edit
+		const HSceneObject& modifiedSO = objects.back();
+		const auto modify = [&]()
+		{
+			if (mDesc.numComponentsPerObject > 0)
+				modifiedSO->getComponent<TestComponentB>()->val1 = "Modified";
+			else
+				modifiedSO->setName("Modified");
+		};
+
+		measure("Undo.Restore", modify, [&]()
+		{
+			serializedSO->restore();
+		});
+
+		serializedSO = nullptr;
+		root->destroy();
+	}
+
+	void EditorBenchmarkSuite::BenchmarkPrefabDiff()
+	{
+		Vector<HSceneObject> objects;
+		HSceneObject root = createSyntheticScene(&objects);
+
+		HPrefab prefab = Prefab::create(root);
+
+		// Modify roughly one percent of the objects
+		for (UINT32 i = 1; i < (UINT32)objects.size(); i += 100)
+		{
+			objects[i]->setName("Modified" + toString(i));
+			objects[i]->setPosition(Vector3(0.0f, 1.0f, 2.0f));
+		}
+
+		SPtr<PrefabDiff> prefabDiff;
+		measure("PrefabDiff.create", nullptr, [&]()
+		{
+			prefabDiff = PrefabDiff::create(prefab->_getRoot(), root);
+		});
+
+		root->destroy();
+	}
+
+	void EditorBenchmarkSuite::BenchmarkSceneOperations()
+	{
+		Vector<HSceneObject> objects;
+		HSceneObject root = createSyntheticScene(&objects);
+
+		measure("Scene.removeDescendants", nullptr, [&]()
+		{
+			Vector<HSceneObject> selection = objects;
+			EditorUtility::removeDescendants(selection);
+		});
+
+		Vector<HSceneObject> clones;
+		measure("Scene.clone",
+			[&]()
+			{
+				for (auto& clone : clones)
+					clone->destroy();
+
+				clones.clear();
+			},
+			[&]()
+			{
+				clones = EditorUtility::cloneSceneObjects({ root });
+			});
+
+		for (auto& clone : clones)
+			clone->destroy();
+
+		root->destroy();
+	}
+
+	void EditorBenchmarkSuite::BenchmarkSceneTree()
+	{
+		Vector<HSceneObject> objects;
+		HSceneObject root = createSyntheticScene(&objects);
+
+		// Host the tree view the same way editor windows do, so its elements get styled and laid out
+		HSceneObject guiSO = SceneObject::create("BenchmarkGUI", SOF_Internal);
+		HCamera guiCamera = guiSO->addComponent<CCamera>();
+		guiCamera->getViewport()->setTarget(gCoreApplication().getPrimaryWindow());
+
+		HGUIWidget guiWidget = guiSO->addComponent<CGUIWidget>(guiCamera);
+		guiWidget->setSkin(BuiltinEditorResources::instance().getSkin());
+
+		GUISceneTreeView* treeView = nullptr;
+		measure("SceneTree.build",
+			[&]()
+			{
+				if (treeView != nullptr)
+					GUIElement::destroy(treeView);
+
+				treeView = GUISceneTreeView::create();
+				guiWidget->getPanel()->addElement(treeView);
+			},
+			[&]()
+			{
+				treeView->_update();
+			});
+
+		measure("SceneTree.update.Unchanged", nullptr, [&]()
+		{
+			treeView->_update();
+		});
+
+		// Rename roughly one percent of the objects, forcing their elements to be refreshed and re-sorted
+		UINT32 renameIdx = 0;
+		const auto rename = [&]()
+		{
+			for (UINT32 i = 1; i < (UINT32)objects.size(); i += 100)
+				objects[i]->setName("Renamed" + toString(renameIdx) + "_" + toString(i));
+
+			renameIdx++;
+		};
+
+		measure("SceneTree.update.Renamed", rename, [&]()
+		{
+			treeView->_update();
+		});
+
+		GUIElement::destroy(treeView);
+		guiSO->destroy();
+		root->destroy();
+	}
+
+	void EditorBenchmarkSuite::BenchmarkGizmos()
+	{
+		Vector<HSceneObject> objects;
+		HSceneObject root = createSyntheticScene(&objects);
+
+		SPtr<Camera> camera = Camera::create();
+		camera->getViewport()->setTarget(gCoreApplication().getPrimaryWindow());
+
+		GizmoManager& gizmoManager = GizmoManager::instance();
+		const GizmoDrawSettings drawSettings;
+
+		// Mimics the draw calls made by the most common component gizmos
+		measure("Gizmos.draw", nullptr, [&]()
+		{
+			gizmoManager.clearGizmos();
+
+			for (UINT32 i = 1; i < (UINT32)objects.size(); i++)
+			{
+				const HSceneObject& so = objects[i];
+
+				gizmoManager.startGizmo(so);
+				gizmoManager.setColor(Color::Green);
+				gizmoManager.setTransform(so->getWorldMatrix());
+				gizmoManager.drawWireCube(Vector3::ZERO, Vector3(0.5f, 0.5f, 0.5f));
+				gizmoManager.drawSphere(Vector3::ZERO, 0.25f);
+				gizmoManager.drawLine(Vector3::ZERO, Vector3::UNIT_Y);
+				gizmoManager.endGizmo();
+			}
+		});
+
+		measure("Gizmos.update", nullptr, [&]()
+		{
+			gizmoManager.update(camera, drawSettings);
+		});
+
+		gizmoManager.clearGizmos();
+		gizmoManager.clearRenderData();
+
+		camera->destroy();
+		root->destroy();
+	}
+
+	void EditorBenchmarkSuite::BenchmarkHandleSliders()
+	{
+		constexpr UINT32 NUM_QUERIES = 512;
+
+		SPtr<Camera> camera = Camera::create();
+		camera->getViewport()->setTarget(gCoreApplication().getPrimaryWindow());
+
+		Rect2I viewportArea = camera->getViewport()->getPixelArea();
+		if (viewportArea.width == 0 || viewportArea.height == 0)
+		{
+			camera->destroy();
+			return;
+		}
+
+		HandleSliderManager sliderManager;
+		Vector<TestHandleSlider*> sliders;
+
+		// Scatter the sliders in front of the camera
+		Random random(1234);
+		const UINT32 numSliders = std::max(mDesc.numSceneObjects, 1U);
+		for (UINT32 i = 0; i < numSliders; i++)
+		{
+			float depth = 20.0f + random.getUNorm() * 80.0f;
+
+			TestHandleSlider* slider = bs_new<TestHandleSlider>(sliderManager, 0.5f);
+			slider->setPosition(Vector3(random.getSNorm() * depth * 0.5f, random.getSNorm() * depth * 0.5f, -depth));
+
+			sliders.push_back(slider);
+		}
+
+		Vector<Vector2I> queries(NUM_QUERIES);
+		for (auto& entry : queries)
+		{
+			entry.x = viewportArea.x + (INT32)(random.getUNorm() * (viewportArea.width - 1));
+			entry.y = viewportArea.y + (INT32)(random.getUNorm() * (viewportArea.height - 1));
+		}
+
+		measure("HandleSliders.movingPointer", nullptr, [&]()
+		{
+			for (auto& inputPos : queries)
+				sliderManager.update(camera, inputPos, Vector2I::ZERO);
+		});
+
+		measure("HandleSliders.staticPointer", nullptr, [&]()
+		{
+			for (UINT32 i = 0; i < NUM_QUERIES; i++)
+			{
+				sliderManager.update(camera, queries[0], Vector2I::ZERO);
+				sliderManager.trySelect(camera, queries[0]);
+				sliderManager.clearSelection(camera);
+			}
+		});
+
+		measure("HandleSliders.movingSliders", nullptr, [&]()
+		{
+			for (UINT32 i = 0; i < NUM_QUERIES; i++)
+			{
+				TestHandleSlider* slider = sliders[i % sliders.size()];
+				slider->setPosition(slider->getPosition());
+
+				sliderManager.update(camera, queries[i], Vector2I::ZERO);
+			}
+		});
+
+		for (auto& slider : sliders)
+			bs_delete(slider);
+
+		camera->destroy();
+	}
+}
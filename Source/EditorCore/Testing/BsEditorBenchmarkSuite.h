@@ -0,0 +1,120 @@
+//********************************** Banshee Engine (www.banshee3d.com) **************************************************//
+//**************** Copyright (c) 2019 Marko Pintera (marko.pintera@gmail.com). All rights reserved. **********************//
+#pragma once
+
+#include "BsEditorPrerequisites.h"
+#include "Testing/BsTestSuite.h"
+
+namespace bs
+{
+	/** @addtogroup Testing-Editor
+	 *  @{
+	 */
+
+	/** Determines the size of the synthetic data the editor benchmarks are run on. */
+	struct EditorBenchmarkDesc
+	{
+		/**
+		 * Folder in which to generate the synthetic project. The folder must not exist, and is deleted once the benchmark
+		 * completes. If not provided a uniquely named folder in the temporary directory is used.
+		 */
+		Path projectFolder;
+
+		/** Number of folders to generate in the synthetic project. */
+		UINT32 numDirectories = 50;
+
+		/** Number of files to generate in the synthetic project, spread evenly between the folders. */
+		UINT32 numFiles = 2000;
+
+		/** Number of scene objects in the synthetic scene. */
+		UINT32 numSceneObjects = 5000;
+
+		/** Number of components to add to each of the scene objects in the synthetic scene. */
+		UINT32 numComponentsPerObject = 2;
+
+		/** Number of times to repeat each measurement. */
+		UINT32 numIterations = 5;
+	};
+
+	/**
+	 * Measures the performance of editor operations that are known to be expensive on large projects and scenes. Each
+	 * benchmark generates its own synthetic data, sized according to the provided EditorBenchmarkDesc, and records how
+	 * long the operations took. Results can be output in JSON format so they can be compared between runs.
+	 *
+	 * The benchmarks load and unload their own project, and must only be ran by an editor started through
+	 * EditorApplication::startUpHeadless() with no project loaded.
+	 */
+	class BS_ED_EXPORT EditorBenchmarkSuite : public TestSuite
+	{
+		/** Timings of a single measured operation. */
+		struct Result
+		{
+			String name;
+			Vector<UINT64> samples; /**< Duration of each iteration, in microseconds. */
+		};
+
+	public:
+		EditorBenchmarkSuite(const EditorBenchmarkDesc& desc = EditorBenchmarkDesc());
+
+		/** Returns the results of all the benchmarks ran so far, as a JSON document. */
+		String getReport() const;
+
+		/**
+		 * Runs all the benchmarks and writes the report to the provided path. Size of the synthetic data can be customized
+		 * through the BS_EDITOR_BENCHMARK_DIRECTORIES, BS_EDITOR_BENCHMARK_FILES, BS_EDITOR_BENCHMARK_OBJECTS,
+		 * BS_EDITOR_BENCHMARK_COMPONENTS and BS_EDITOR_BENCHMARK_ITERATIONS environment variables.
+		 *
+		 * @return	True if the benchmarks ran and the report was written, false otherwise.
+		 */
+		static bool runAndReport(const Path& outputPath);
+
+	private:
+		/** Measures the project library refresh, save/load and search operations. */
+		void BenchmarkProjectLibrary();
+
+		/** Measures recording and restoring scene object state used by undo/redo. */
+		void BenchmarkUndoRecord();
+
+		/** Measures generation of prefab diffs. */
+		void BenchmarkPrefabDiff();
+
+		/** Measures cloning and selection filtering of scene object hierarchies. */
+		void BenchmarkSceneOperations();
+
+		/** Measures building and refreshing the scene tree view of the scene hierarchy. */
+		void BenchmarkSceneTree();
+
+		/** Measures submitting gizmos for every object in the scene and building their render data. */
+		void BenchmarkGizmos();
+
+		/** Measures finding the handle slider under the pointer, with a slider for every object in the scene. */
+		void BenchmarkHandleSliders();
+
+		/**
+		 * Creates a scene object hierarchy according to the benchmark description. Returns the root object, and
+		 * optionally all the created objects.
+		 */
+		HSceneObject createSyntheticScene(Vector<HSceneObject>* objects = nullptr) const;
+
+		/**
+		 * Generates a project with folders and files according to the benchmark description. Returns false if the
+		 * project folder already exists, in which case nothing is generated.
+		 */
+		bool createSyntheticProject() const;
+
+		/**
+		 * Runs the provided function the number of times specified by the benchmark description and records the time
+		 * each run took.
+		 *
+		 * @param[in]	name		Unique name of the measured operation.
+		 * @param[in]	prepare		Optional function that is executed before every run, not included in the timings.
+		 * @param[in]	func		Function to measure.
+		 */
+		void measure(const String& name, const std::function<void()>& prepare, const std::function<void()>& func);
+
+		EditorBenchmarkDesc mDesc;
+		Vector<Result> mResults;
+	};
+
+	/** @} */
+}
@@ -3,6 +3,7 @@
 #include "Testing/BsEditorTestSuite.h"
 #include "Scene/BsSceneObject.h"
 #include "UndoRedo/BsCmdDeleteSO.h"
+#include "UndoRedo/BsCmdCloneSO.h"
 #include "UndoRedo/BsUndoRedo.h"
 #include "Reflection/BsRTTIType.h"
 #include "Private/RTTI/BsGameObjectRTTI.h"
@@ -15,6 +16,36 @@
 #include "FileSystem/BsFileSystem.h"
 #include "Scene/BsSceneManager.h"
 #include "Scene/BsSerializedSceneObject.h"
+#include "Handles/BsHandleSlider.h"
+#include "Handles/BsHandleSliderManager.h"
+#include "Handles/BsHandleSliderPointSet.h"
+#include "Handles/BsHandleManager.h"
+#include "Scene/BsEditorSceneSnapshot.h"
+#include "Scene/BsSelection.h"
+#include "Scene/BsScenePicking.h"
+#include "Library/BsProjectResourceMeta.h"
+#include "Renderer/BsCamera.h"
+#include "RenderAPI/BsViewport.h"
+#include "Math/BsRandom.h"
+#include "Math/BsRay.h"
+#include "Math/BsSphere.h"
+#include "BsCoreApplication.h"
+#include "GUI/BsGradientTextureCache.h"
+#include "Utility/BsEditorUtility.h"
+#include "Utility/BsEditorProfiler.h"
+#include "Library/BsImportGovernor.h"
+#include "Library/BsImportDependencyGraph.h"
+#include "Library/BsLibraryChangeBatch.h"
+#include "Utility/BsDrawMeshCache.h"
+#include "CodeEditor/BsCodeEditor.h"
+#include "FileSystem/BsDataStream.h"
+#include "Threading/BsTaskScheduler.h"
+#include "Scene/BsGizmoManager.h"
+#include "Serialization/BsFileSerializer.h"
+#include "Importer/BsTextureImportOptions.h"
+#include "Material/BsShader.h"
+#include "Image/BsTexture.h"
+#include "Image/BsPixelData.h"
 
 namespace bs
 {
@@ -409,10 +440,28 @@ namespace bs
 	{
 		BS_ADD_TEST(EditorTestSuite::SceneObjectRecord_UndoRedo);
 		BS_ADD_TEST(EditorTestSuite::SceneObjectDelete_UndoRedo);
+		BS_ADD_TEST(EditorTestSuite::SceneObjectRecord_InPlace);
+		BS_ADD_TEST(EditorTestSuite::SceneObjectClone_UndoRedo);
+		BS_ADD_TEST(EditorTestSuite::SceneObjectRemoveDescendants);
 		BS_ADD_TEST(EditorTestSuite::BinaryDiff);
 		BS_ADD_TEST(EditorTestSuite::TestPrefabComplex);
 		BS_ADD_TEST(EditorTestSuite::TestPrefabDiff);
 		BS_ADD_TEST(EditorTestSuite::TestFrameAlloc);
+		BS_ADD_TEST(EditorTestSuite::TestHandleSliderPicking);
+		BS_ADD_TEST(EditorTestSuite::TestGradientTextureCache);
+		BS_ADD_TEST(EditorTestSuite::TestEditorProfiler);
+		BS_ADD_TEST(EditorTestSuite::TestImportGovernor);
+		BS_ADD_TEST(EditorTestSuite::TestImportDependencyGraph);
+		BS_ADD_TEST(EditorTestSuite::TestLibraryChangeBatch);
+		BS_ADD_TEST(EditorTestSuite::TestDrawMeshCache);
+		BS_ADD_TEST(EditorTestSuite::TestHandleSliderPointSet);
+		BS_ADD_TEST(EditorTestSuite::TestEditorSceneSnapshot);
+		BS_ADD_TEST(EditorTestSuite::TestSolutionWriteIfChanged);
+		BS_ADD_TEST(EditorTestSuite::TestPickedIndexRanking);
+		BS_ADD_TEST(EditorTestSuite::TestProjectFileMetaLazyDecode);
+		BS_ADD_TEST(EditorTestSuite::TestProjectFileMetaFallbacks);
+		BS_ADD_TEST(EditorTestSuite::TestGizmoInstanceData);
+		BS_ADD_TEST(EditorTestSuite::TestPickedPixelRanking);
 	}
 
 	void EditorTestSuite::SceneObjectRecord_UndoRedo()
@@ -462,6 +511,157 @@ namespace bs
 		soExternal->destroy();
 	}
 
+	void EditorTestSuite::SceneObjectRecord_InPlace()
+	{
+		HSceneObject so0_0 = SceneObject::create("so0_0");
+		HSceneObject so1_0 = SceneObject::create("so1_0");
+		so1_0->setParent(so0_0);
+
+		GameObjectHandle<TestComponentA> cmpA1_0 = so1_0->addComponent<TestComponentA>();
+		GameObjectHandle<TestComponentB> cmpB0_0 = so0_0->addComponent<TestComponentB>();
+
+		cmpA1_0->ref1 = so0_0;
+		cmpA1_0->ref2 = static_object_cast<Component>(cmpB0_0);
+		cmpB0_0->val1 = "InitialValue";
+
+		SceneObject* orgSO0_0 = so0_0.get();
+		SceneObject* orgSO1_0 = so1_0.get();
+		TestComponentA* orgCmpA1_0 = cmpA1_0.get();
+		TestComponentB* orgCmpB0_0 = cmpB0_0.get();
+
+		// Only component data changes, objects are expected to be patched in place
+		auto serializedSO = bs_shared_ptr_new<SerializedSceneObject>(so0_0, true);
+		cmpB0_0->val1 = "ModifiedValue";
+		cmpA1_0->ref1 = so1_0;
+		so1_0->setPosition(Vector3(1.0f, 2.0f, 3.0f));
+		serializedSO->restore();
+
+		BS_TEST_ASSERT(so0_0.get() == orgSO0_0);
+		BS_TEST_ASSERT(so1_0.get() == orgSO1_0);
+		BS_TEST_ASSERT(cmpA1_0.get() == orgCmpA1_0);
+		BS_TEST_ASSERT(cmpB0_0.get() == orgCmpB0_0);
+		BS_TEST_ASSERT(cmpB0_0->val1 == "InitialValue");
+		BS_TEST_ASSERT(cmpA1_0->ref1 == so0_0);
+		BS_TEST_ASSERT(so1_0->getLocalTransform().getPosition() == Vector3::ZERO);
+
+		// Structural changes fall back to a full restore
+		auto serializedSO2 = bs_shared_ptr_new<SerializedSceneObject>(so0_0, true);
+		so1_0->addComponent<TestComponentB>();
+		cmpB0_0->val1 = "ModifiedValue";
+		serializedSO2->restore();
+
+		BS_TEST_ASSERT(!so1_0.isDestroyed());
+		BS_TEST_ASSERT(!cmpA1_0.isDestroyed());
+		BS_TEST_ASSERT(!cmpB0_0.isDestroyed());
+		BS_TEST_ASSERT(so1_0->getComponents().size() == 1);
+		BS_TEST_ASSERT(cmpB0_0->val1 == "InitialValue");
+		BS_TEST_ASSERT(cmpA1_0->ref2 == static_object_cast<Component>(cmpB0_0));
+
+		// Snapshots with an unchanged structure share the serialized object with an earlier snapshot, but must still
+		// restore their own state
+		auto serializedSO3 = bs_shared_ptr_new<SerializedSceneObject>(so0_0, true);
+		cmpB0_0->val1 = "SecondValue";
+		so1_0->setMobility(ObjectMobility::Static);
+		so1_0->setName("renamed");
+
+		auto serializedSO4 = bs_shared_ptr_new<SerializedSceneObject>(so0_0, true);
+		so1_0->addComponent<TestComponentB>();
+		cmpB0_0->val1 = "ModifiedValue";
+		so1_0->setMobility(ObjectMobility::Movable);
+		serializedSO4->restore();
+
+		BS_TEST_ASSERT(!cmpB0_0.isDestroyed());
+		BS_TEST_ASSERT(so1_0->getComponents().size() == 1);
+		BS_TEST_ASSERT(cmpB0_0->val1 == "SecondValue");
+		BS_TEST_ASSERT(so1_0->getMobility() == ObjectMobility::Static);
+		BS_TEST_ASSERT(so1_0->getName() == "renamed");
+
+		serializedSO3->restore();
+		BS_TEST_ASSERT(cmpB0_0->val1 == "InitialValue");
+		BS_TEST_ASSERT(so1_0->getMobility() == ObjectMobility::Movable);
+		BS_TEST_ASSERT(so1_0->getName() == "so1_0");
+
+		so0_0->destroy();
+	}
+
+	void EditorTestSuite::SceneObjectClone_UndoRedo()
+	{
+		HSceneObject parent = SceneObject::create("parent");
+		HSceneObject so0_0 = SceneObject::create("so0_0");
+		HSceneObject so1_0 = SceneObject::create("so1_0");
+		HSceneObject so0_1 = SceneObject::create("so0_1");
+		so1_0->setParent(so0_0);
+
+		GameObjectHandle<TestComponentA> cmpA1_0 = so1_0->addComponent<TestComponentA>();
+		cmpA1_0->ref1 = so0_0;
+
+		GameObjectHandle<TestComponentA> cmpA0_1 = so0_1->addComponent<TestComponentA>();
+		cmpA0_1->ref1 = so0_0;
+
+		so0_1->setPosition(Vector3(1.0f, 2.0f, 3.0f));
+
+		Vector<HSceneObject> clones = CmdCloneSO::execute({ so0_0, so0_1 }, "", parent, false);
+
+		BS_TEST_ASSERT(clones.size() == 2);
+		BS_TEST_ASSERT(clones[0]->getInstanceId() != so0_0->getInstanceId());
+		BS_TEST_ASSERT(clones[1]->getInstanceId() != so0_1->getInstanceId());
+		BS_TEST_ASSERT(clones[0]->getName() == "so0_0");
+		BS_TEST_ASSERT(clones[1]->getName() == "so0_1");
+		BS_TEST_ASSERT(clones[0]->getParent() == parent);
+		BS_TEST_ASSERT(clones[1]->getParent() == parent);
+		BS_TEST_ASSERT(clones[1]->getLocalTransform().getPosition() == Vector3(1.0f, 2.0f, 3.0f));
+		BS_TEST_ASSERT(clones[0]->getNumChildren() == 1);
+
+		// References within the cloned hierarchy point to the clones
+		HSceneObject clone1_0 = clones[0]->getChild(0);
+		GameObjectHandle<TestComponentA> cloneCmpA1_0 = clone1_0->getComponent<TestComponentA>();
+		BS_TEST_ASSERT(cloneCmpA1_0 != nullptr);
+		BS_TEST_ASSERT(cloneCmpA1_0->ref1 == clones[0]);
+
+		// References to other cloned roots keep pointing to the originals, same as when cloning the roots one by one
+		GameObjectHandle<TestComponentA> cloneCmpA0_1 = clones[1]->getComponent<TestComponentA>();
+		BS_TEST_ASSERT(cloneCmpA0_1 != nullptr);
+		BS_TEST_ASSERT(cloneCmpA0_1->ref1 == so0_0);
+
+		UndoRedo::instance().undo();
+
+		BS_TEST_ASSERT(clones[0].isDestroyed());
+		BS_TEST_ASSERT(clones[1].isDestroyed());
+		BS_TEST_ASSERT(parent->getNumChildren() == 0);
+		BS_TEST_ASSERT(!so0_0.isDestroyed() && !so0_1.isDestroyed());
+
+		UndoRedo::instance().redo();
+
+		BS_TEST_ASSERT(parent->getNumChildren() == 2);
+
+		parent->destroy();
+		so0_0->destroy();
+		so0_1->destroy();
+	}
+
+	void EditorTestSuite::SceneObjectRemoveDescendants()
+	{
+		HSceneObject so0_0 = SceneObject::create("so0_0");
+		HSceneObject so1_0 = SceneObject::create("so1_0");
+		HSceneObject so2_0 = SceneObject::create("so2_0");
+		HSceneObject so0_1 = SceneObject::create("so0_1");
+		HSceneObject so1_1 = SceneObject::create("so1_1");
+
+		so1_0->setParent(so0_0);
+		so2_0->setParent(so1_0);
+		so1_1->setParent(so0_1);
+
+		Vector<HSceneObject> objects = { so2_0, so1_1, so0_0, so2_0, so1_0, so1_1 };
+		EditorUtility::removeDescendants(objects);
+
+		BS_TEST_ASSERT(objects.size() == 2);
+		BS_TEST_ASSERT(objects[0] == so1_1);
+		BS_TEST_ASSERT(objects[1] == so0_0);
+
+		so0_0->destroy();
+		so0_1->destroy();
+	}
+
 	void EditorTestSuite::SceneObjectDelete_UndoRedo()
 	{
 		HSceneObject so0_0 = SceneObject::create("so0_0");
@@ -806,4 +1006,826 @@ namespace bs
 		alloc.free(a13);
 		alloc.clear();
 	}
+
+	void EditorTestSuite::TestHandleSliderPicking()
+	{
+		constexpr UINT32 NUM_SLIDERS = 4096;
+		constexpr UINT32 NUM_QUERIES = 64;
+
+		SPtr<Camera> camera = Camera::create();
+		camera->getViewport()->setTarget(gCoreApplication().getPrimaryWindow());
+
+		Rect2I viewportArea = camera->getViewport()->getPixelArea();
+		if (viewportArea.width == 0 || viewportArea.height == 0)
+		{
+			camera->destroy();
+			return;
+		}
+
+		HandleSliderManager sliderManager;
+		Vector<TestHandleSlider*> sliders;
+
+		// Scatter the sliders in front of the camera
+		Random random(1234);
+		for (UINT32 i = 0; i < NUM_SLIDERS; i++)
+		{
+			float depth = 20.0f + random.getUNorm() * 80.0f;
+
+			TestHandleSlider* slider = bs_new<TestHandleSlider>(sliderManager, 0.5f);
+			slider->setPosition(Vector3(random.getSNorm() * depth * 0.5f, random.getSNorm() * depth * 0.5f, -depth));
+
+			sliders.push_back(slider);
+		}
+
+		Vector<Vector2I> queries(NUM_QUERIES);
+		for (auto& entry : queries)
+		{
+			entry.x = viewportArea.x + (INT32)(random.getUNorm() * (viewportArea.width - 1));
+			entry.y = viewportArea.y + (INT32)(random.getUNorm() * (viewportArea.height - 1));
+		}
+
+		// Ensure the broad phase finds the same slider as the exhaustive test
+		for (auto& inputPos : queries)
+		{
+			sliderManager.update(camera, inputPos, Vector2I::ZERO);
+
+			Ray inputRay = camera->screenPointToRay(inputPos);
+			float nearestT = std::numeric_limits<float>::max();
+			TestHandleSlider* expected = nullptr;
+			for (auto& slider : sliders)
+			{
+				float t;
+				if (slider->intersects(inputPos, inputRay, t) && t < nearestT)
+				{
+					nearestT = t;
+					expected = slider;
+				}
+			}
+
+			for (auto& slider : sliders)
+			{
+				bool isHovered = slider->getState() == HandleSlider::State::Hover;
+				BS_TEST_ASSERT(isHovered == (slider == expected));
+			}
+		}
+
+		for (auto& slider : sliders)
+			bs_delete(slider);
+
+		camera->destroy();
+	}
+
+	void EditorTestSuite::TestGradientTextureCache()
+	{
+		ColorGradient gradient({ 
+			ColorGradientKey(Color(1.0f, 0.0f, 0.0f, 0.0f), 0.0f), 
+			ColorGradientKey(Color(0.0f, 1.0f, 0.0f, 0.5f), 0.4f), 
+			ColorGradientKey(Color(0.0f, 0.0f, 1.0f, 1.0f), 1.0f)
+		});
+
+		// Row evaluation must match per-pixel evaluation
+		constexpr UINT32 WIDTH = 97;
+		UINT32 row[WIDTH];
+		UINT32 alphaRow[WIDTH];
+		GradientTextureCache::evaluateRow(gradient, WIDTH, false, row);
+		GradientTextureCache::evaluateRow(gradient, WIDTH, true, alphaRow);
+
+		for (UINT32 i = 0; i < WIDTH; i++)
+		{
+			const RGBA expected = gradient.evaluate(i / (float)WIDTH + 0.5f / WIDTH);
+			const UINT32 alpha = expected >> 24;
+
+			BS_TEST_ASSERT((row[i] & 0x00FFFFFF) == (expected & 0x00FFFFFF));
+			BS_TEST_ASSERT((row[i] >> 24) == 0xFF);
+			BS_TEST_ASSERT(alphaRow[i] == (alpha | (alpha << 8) | (alpha << 16) | 0xFF000000));
+		}
+
+		// Identical keys share a texture, different keys don't
+		GradientTextureCache cache(0);
+
+		GradientTextureCache::Key colorKey(gradient, WIDTH, false);
+		GradientTextureCache::Key alphaKey(gradient, WIDTH, true);
+		GradientTextureCache::Key widerKey(gradient, WIDTH * 2, false);
+
+		HSpriteTexture colorTex0 = cache.acquire(colorKey);
+		HSpriteTexture colorTex1 = cache.acquire(GradientTextureCache::Key(gradient, WIDTH, false));
+		HSpriteTexture alphaTex = cache.acquire(alphaKey);
+		HSpriteTexture widerTex = cache.acquire(widerKey);
+
+		BS_TEST_ASSERT(colorTex0 == colorTex1);
+		BS_TEST_ASSERT(colorTex0 != alphaTex);
+		BS_TEST_ASSERT(colorTex0 != widerTex);
+
+		// Texture remains cached while referenced, and is evicted once unreferenced, as the budget is zero
+		cache.release(colorKey);
+		BS_TEST_ASSERT(cache.acquire(colorKey) == colorTex0);
+
+		cache.release(colorKey);
+		cache.release(colorKey);
+		BS_TEST_ASSERT(cache.acquire(colorKey) != colorTex0);
+
+		cache.release(colorKey);
+		cache.release(alphaKey);
+		cache.release(widerKey);
+	}
+
+	void EditorTestSuite::TestEditorProfiler()
+	{
+		EditorProfiler& profiler = EditorProfiler::instance();
+		const bool wasEnabled = EditorProfiler::isEnabled();
+
+		// Disabled profiler records nothing
+		profiler.setEnabled(false);
+		profiler.clear();
+		profiler.beginFrame();
+		{
+			BS_EDITOR_PROFILE_SCOPE("Test", "Disabled");
+		}
+
+		for (auto& sample : profiler.getSamples(profiler.getFrameIdx(), profiler.getFrameIdx()))
+			BS_TEST_ASSERT(strcmp(sample.category, "Test") != 0);
+
+		profiler.setEnabled(true);
+		profiler.beginFrame();
+		for (UINT32 i = 0; i < 2; i++)
+		{
+			BS_EDITOR_PROFILE_SCOPE("Test", "Outer");
+			{
+				BS_EDITOR_PROFILE_SCOPE("Test", "Inner");
+			}
+		}
+
+		const UINT64 frameIdx = profiler.getFrameIdx();
+		profiler.beginFrame();
+		profiler.setEnabled(wasEnabled);
+
+		// Other threads might have recorded samples during the same frame, so only look at the ones recorded above
+		UINT32 numSamples = 0;
+		for (auto& sample : profiler.getSamples(frameIdx, frameIdx))
+		{
+			if (strcmp(sample.category, "Test") != 0)
+				continue;
+
+			if (strcmp(sample.name, "Inner") == 0)
+				BS_TEST_ASSERT(sample.depth == 1);
+			else
+				BS_TEST_ASSERT(sample.depth == 0);
+
+			BS_TEST_ASSERT(sample.start >= profiler.getFrameStart(frameIdx));
+			numSamples++;
+		}
+
+		BS_TEST_ASSERT(numSamples == 4);
+
+		UINT32 numAggregates = 0;
+		for (auto& aggregate : profiler.getAggregates(2))
+		{
+			if (aggregate.category != "Test")
+				continue;
+
+			BS_TEST_ASSERT(aggregate.numSamples == 2);
+			BS_TEST_ASSERT(aggregate.maxTime <= aggregate.totalTime);
+			numAggregates++;
+		}
+
+		BS_TEST_ASSERT(numAggregates == 2);
+
+		const String trace = profiler.exportChromeTrace();
+		BS_TEST_ASSERT(trace.find("\"name\":\"Outer\"") != String::npos);
+		BS_TEST_ASSERT(trace.find("\"ph\":\"X\"") != String::npos);
+
+		profiler.clear();
+		BS_TEST_ASSERT(profiler.getSamples(frameIdx, frameIdx).empty());
+	}
+
+	void EditorTestSuite::TestImportGovernor()
+	{
+		ImportGovernor governor;
+		governor.setMemoryBudget(10);
+
+		SPtr<Task> taskA = Task::create("TestImportA", []() { });
+		SPtr<Task> taskB = Task::create("TestImportB", []() { });
+		SPtr<Task> taskC = Task::create("TestImportC", []() { });
+
+		// Tasks that don't fit in the budget are held back while others are running
+		governor.submit(taskA, 6);
+		governor.submit(taskB, 6);
+		BS_TEST_ASSERT(governor.getNumPending() == 1);
+
+		governor.release(6);
+		BS_TEST_ASSERT(governor.getNumPending() == 0);
+
+		// Expedited tasks are submitted regardless of the budget
+		governor.submit(taskC, 6);
+		BS_TEST_ASSERT(governor.getNumPending() == 1);
+
+		governor.expedite(taskC);
+		BS_TEST_ASSERT(governor.getNumPending() == 0);
+
+		taskA->wait();
+		taskB->wait();
+		taskC->wait();
+
+		governor.release(6);
+		governor.release(6);
+
+		// Tasks exceeding the budget on their own still run if nothing else is running
+		SPtr<Task> taskD = Task::create("TestImportD", []() { });
+		governor.submit(taskD, 100);
+		BS_TEST_ASSERT(governor.getNumPending() == 0);
+
+		taskD->wait();
+		governor.release(100);
+
+		BS_TEST_ASSERT(ImportGovernor::estimateMemory("NonExistent.png") > 0);
+	}
+
+	void EditorTestSuite::TestImportDependencyGraph()
+	{
+		const Path includeA = "/Project/A.bslinc";
+		const Path includeB = "/Project/B.bslinc";
+		const Path shaderS = "/Project/S.bsl";
+		const Path shaderT = "/Project/T.bsl";
+
+		// S includes B, which includes A. T includes both directly.
+		ImportDependencyGraph graph;
+		graph.setDependencies(shaderS, { includeB });
+		graph.setDependencies(includeB, { includeA });
+		graph.setDependencies(shaderT, { includeA, includeB, includeA });
+
+		const auto indexOf = [](const Vector<Path>& paths, const Path& path)
+		{
+			return (UINT32)(std::find(paths.begin(), paths.end(), path) - paths.begin());
+		};
+
+		Vector<Path> dependants = graph.getDependants(includeA);
+		BS_TEST_ASSERT(dependants.size() == 3);
+		BS_TEST_ASSERT(indexOf(dependants, includeB) < indexOf(dependants, shaderS));
+		BS_TEST_ASSERT(indexOf(dependants, includeB) < indexOf(dependants, shaderT));
+		BS_TEST_ASSERT(graph.getDirectDependants(includeA).size() == 2);
+
+		// Replacing dependencies removes the old edges
+		graph.setDependencies(shaderT, { includeB });
+		BS_TEST_ASSERT(graph.getDirectDependants(includeA).size() == 1);
+		BS_TEST_ASSERT(graph.getDependants(includeA).size() == 3);
+
+		graph.removeDependencies(includeB);
+		BS_TEST_ASSERT(graph.getDependants(includeA).empty());
+		BS_TEST_ASSERT(graph.getDependants(includeB).size() == 2);
+
+		// Cycles still report all the dependants
+		graph.setDependencies(includeA, { includeB });
+		graph.setDependencies(includeB, { includeA });
+		dependants = graph.getDependants(includeA);
+		BS_TEST_ASSERT(dependants.size() == 3);
+		BS_TEST_ASSERT(indexOf(dependants, includeB) < dependants.size());
+
+		// Removed files release their nodes, along with any nodes only they referenced
+		ImportDependencyGraph removalGraph;
+		removalGraph.setDependencies(shaderS, { includeA });
+		removalGraph.removeFile(shaderS);
+		BS_TEST_ASSERT(removalGraph.findNode(shaderS) == ImportDependencyGraph::INVALID_NODE);
+		BS_TEST_ASSERT(removalGraph.findNode(includeA) == ImportDependencyGraph::INVALID_NODE);
+
+		// Files other files still depend on keep their nodes, so the dependency applies again once they are re-created
+		removalGraph.setDependencies(shaderS, { includeA });
+		removalGraph.setDependencies(includeA, { });
+		removalGraph.removeFile(includeA);
+		BS_TEST_ASSERT(removalGraph.findNode(includeA) != ImportDependencyGraph::INVALID_NODE);
+		BS_TEST_ASSERT(removalGraph.getDependants(includeA).size() == 1);
+
+		// Released identifiers are reused
+		removalGraph.removeFile(shaderS);
+		removalGraph.setDependencies(shaderT, { includeB });
+		BS_TEST_ASSERT(removalGraph.findNode(shaderT) < 2);
+		BS_TEST_ASSERT(removalGraph.findNode(includeB) < 2);
+	}
+
+	void EditorTestSuite::TestLibraryChangeBatch()
+	{
+		const Path root = "/Project/Resources/";
+		const Path folderA = "/Project/Resources/A/";
+		const Path folderB = "/Project/Resources/B/";
+
+		LibraryChangeBatch batch;
+		BS_TEST_ASSERT(batch.isEmpty());
+
+		// Repeated changes to the same file are merged, and a few changes in a folder are refreshed individually
+		batch.addChange(Path::combine(folderA, "File0.png"));
+		batch.addChange(Path::combine(folderA, "File0.png"));
+		batch.addChange(Path::combine(folderA, "File1.png"));
+
+		Vector<Path> refreshPaths = batch.collapse(root);
+		BS_TEST_ASSERT(refreshPaths.size() == 2);
+		BS_TEST_ASSERT(batch.isEmpty());
+
+		// Many changes in a folder are collapsed into a refresh of the folder
+		for (UINT32 i = 0; i < LibraryChangeBatch::FOLDER_REFRESH_THRESHOLD; i++)
+			batch.addChange(Path::combine(folderA, "File" + toString(i) + ".png"));
+
+		batch.addChange(Path::combine(folderB, "File0.png"));
+
+		refreshPaths = batch.collapse(root);
+		BS_TEST_ASSERT(refreshPaths.size() == 2);
+		BS_TEST_ASSERT(std::find(refreshPaths.begin(), refreshPaths.end(), folderA) != refreshPaths.end());
+
+		// Unless the folder has many more entries than changes
+		for (UINT32 i = 0; i < LibraryChangeBatch::FOLDER_REFRESH_THRESHOLD; i++)
+			batch.addChange(Path::combine(folderA, "File" + toString(i) + ".png"));
+
+		refreshPaths = batch.collapse(root, [](const Path&) { return 1000U; });
+		BS_TEST_ASSERT(refreshPaths.size() == LibraryChangeBatch::FOLDER_REFRESH_THRESHOLD);
+
+		// Changes within a changed folder are dropped, and nothing outside the root is refreshed
+		batch.addChange(folderB);
+		batch.addChange(Path::combine(folderB, "File0.png"));
+		for (UINT32 i = 0; i < LibraryChangeBatch::FOLDER_REFRESH_THRESHOLD; i++)
+			batch.addChange(Path::combine(root, "File" + toString(i) + ".png"));
+
+		refreshPaths = batch.collapse(root);
+		BS_TEST_ASSERT(refreshPaths.size() == 1);
+		BS_TEST_ASSERT(refreshPaths[0] == root);
+
+		// A sibling folder whose name starts with the root's name is outside of the root
+		const Path siblingFolder = "/Project/ResourcesX/";
+		for (UINT32 i = 0; i < LibraryChangeBatch::FOLDER_REFRESH_THRESHOLD; i++)
+			batch.addChange(Path::combine(siblingFolder, "File" + toString(i) + ".png"));
+
+		refreshPaths = batch.collapse(root);
+		BS_TEST_ASSERT(refreshPaths.size() == LibraryChangeBatch::FOLDER_REFRESH_THRESHOLD);
+		BS_TEST_ASSERT(std::find(refreshPaths.begin(), refreshPaths.end(), siblingFolder) == refreshPaths.end());
+
+		// Renames of .meta files turn into regular changes
+		batch.addRename(Path::combine(folderA, "File0.png"), Path::combine(folderB, "File0.png"));
+		batch.addRename(Path::combine(folderA, "File0.png.meta"), Path::combine(folderB, "File0.png.meta"));
+
+		const Vector<LibraryChangeBatch::Rename> renames = batch.takeRenames();
+		BS_TEST_ASSERT(renames.size() == 1);
+		BS_TEST_ASSERT(renames[0].to == Path::combine(folderB, "File0.png"));
+		BS_TEST_ASSERT(batch.collapse(root).size() == 2);
+	}
+
+	void EditorTestSuite::TestDrawMeshCache()
+	{
+		// Identical commands hash identically, regardless of how many times they were recorded before
+		DrawMeshCache cache;
+		cache.record("cube", Vector3(1.0f, 2.0f, 3.0f), Vector3::ONE);
+		cache.record("text", String("Label"), Vector<Vector3>{ Vector3::ZERO, Vector3::UNIT_X });
+		const UINT64 hash = cache.getCommandsHash();
+
+		cache.clearCommands();
+		cache.record("cube", Vector3(1.0f, 2.0f, 3.0f), Vector3::ONE);
+		cache.record("text", String("Label"), Vector<Vector3>{ Vector3::ZERO, Vector3::UNIT_X });
+		BS_TEST_ASSERT(cache.getCommandsHash() == hash);
+
+		cache.clearCommands();
+		cache.record("cube", Vector3(1.0f, 2.0f, 3.0f), Vector3::ONE);
+		cache.record("text", String("Label2"), Vector<Vector3>{ Vector3::ZERO, Vector3::UNIT_X });
+		BS_TEST_ASSERT(cache.getCommandsHash() != hash);
+
+		// Meshes are reused while the commands stay the same
+		DrawHelper drawHelper;
+		const auto buildCube = [&](const Vector3& extents)
+		{
+			drawHelper.clear();
+			cache.clearCommands();
+
+			drawHelper.cube(Vector3::ZERO, extents);
+			cache.record("cube", Vector3::ZERO, extents);
+
+			const Vector<DrawHelper::ShapeMeshData>& meshes = cache.getMeshes(drawHelper, DrawHelper::SortType::None,
+				nullptr);
+
+			BS_TEST_ASSERT(meshes.size() == 1);
+			return meshes.empty() ? nullptr : meshes[0].mesh;
+		};
+
+		SPtr<Mesh> firstMesh = buildCube(Vector3::ONE);
+		BS_TEST_ASSERT(buildCube(Vector3::ONE) == firstMesh);
+		BS_TEST_ASSERT(buildCube(Vector3(2.0f, 2.0f, 2.0f)) != firstMesh);
+
+		cache.clear();
+		drawHelper.clear();
+	}
+
+	void EditorTestSuite::TestHandleSliderPointSet()
+	{
+		constexpr UINT32 NUM_POINTS = 5000;
+		constexpr UINT32 NUM_QUERIES = 1000;
+		constexpr float RADIUS = 0.5f;
+		constexpr float SCALE = 2.0f;
+
+		// Point set sliders register with the global slider manager
+		if (!HandleManager::isStarted())
+			return;
+
+		HandleSliderPointSet slider(RADIUS, false, 1);
+		slider.setPosition(Vector3(10.0f, 0.0f, -5.0f));
+		slider.setScale(Vector3(SCALE, SCALE, SCALE));
+
+		Random random(4321);
+		Vector<Vector3> points(NUM_POINTS);
+		for (auto& point : points)
+			point = Vector3(random.getSNorm() * 40.0f, random.getSNorm() * 40.0f, random.getSNorm() * 10.0f);
+
+		slider.setPoints(points.data(), (UINT32)points.size());
+		BS_TEST_ASSERT(slider.getNumPoints() == NUM_POINTS);
+
+		const Matrix4 transform = Matrix4::TRS(slider.getPosition(), slider.getRotation(), slider.getScale());
+		for (UINT32 i = 0; i < NUM_QUERIES; i++)
+		{
+			const Vector3 origin(random.getSNorm() * 100.0f, random.getSNorm() * 100.0f, 100.0f);
+			const Vector3 target = transform.multiplyAffine(points[random.get() % NUM_POINTS]) +
+				Vector3(random.getSNorm(), random.getSNorm(), random.getSNorm()) * 2.0f;
+
+			Vector3 direction = target - origin;
+			direction.normalize();
+			const Ray ray(origin, direction);
+
+			float expectedT = std::numeric_limits<float>::max();
+			UINT32 expectedPoint = HandleSliderPointSet::NO_POINT;
+			for (UINT32 j = 0; j < NUM_POINTS; j++)
+			{
+				Sphere sphere(transform.multiplyAffine(points[j]), RADIUS * SCALE);
+				auto intersect = sphere.intersects(ray);
+				if (intersect.first && intersect.second < expectedT)
+				{
+					expectedT = intersect.second;
+					expectedPoint = j;
+				}
+			}
+
+			float t;
+			const UINT32 point = slider.findPoint(ray, t);
+
+			BS_TEST_ASSERT((point == HandleSliderPointSet::NO_POINT) == (expectedPoint == HandleSliderPointSet::NO_POINT));
+			if (point != HandleSliderPointSet::NO_POINT && expectedPoint != HandleSliderPointSet::NO_POINT)
+				BS_TEST_ASSERT(Math::approxEquals(t, expectedT, 0.01f));
+		}
+
+		// A ray missing all the points
+		float t;
+		BS_TEST_ASSERT(slider.findPoint(Ray(Vector3(0.0f, 1000.0f, 0.0f), Vector3::UNIT_Y), t) ==
+			HandleSliderPointSet::NO_POINT);
+
+		slider.setPoints(nullptr, 0);
+		BS_TEST_ASSERT(slider.findPoint(Ray(Vector3(10.0f, 0.0f, 100.0f), -Vector3::UNIT_Z), t) ==
+			HandleSliderPointSet::NO_POINT);
+	}
+
+	void EditorTestSuite::TestEditorSceneSnapshot()
+	{
+		if (!EditorSceneSnapshot::isStarted())
+			return;
+
+		EditorSceneSnapshot& snapshot = EditorSceneSnapshot::instance();
+		Selection& selection = Selection::instance();
+		const Vector<HSceneObject> originalSelection = selection.getSceneObjects();
+
+		HSceneObject selectedSO = SceneObject::create("selected");
+		HSceneObject otherSO = SceneObject::create("other");
+
+		// Selection changes must be visible immediately, even within the same frame
+		selection.setSceneObjects({ selectedSO });
+		BS_TEST_ASSERT(snapshot.isSelected(selectedSO));
+		BS_TEST_ASSERT(!snapshot.isSelected(otherSO));
+		BS_TEST_ASSERT(snapshot.getSelection().size() == 1);
+
+		// Work is only performed once per snapshot
+		int workId = 0;
+		BS_TEST_ASSERT(!snapshot.isDone(&workId));
+		BS_TEST_ASSERT(snapshot.isDone(&workId));
+
+		snapshot.markDirty();
+		BS_TEST_ASSERT(!snapshot.isDone(&workId));
+
+		selection.setSceneObjects({ otherSO });
+		BS_TEST_ASSERT(!snapshot.isSelected(selectedSO));
+		BS_TEST_ASSERT(snapshot.isSelected(otherSO));
+
+		selection.setSceneObjects(originalSelection);
+		selectedSO->destroy();
+		otherSO->destroy();
+	}
+
+	void EditorTestSuite::TestSolutionWriteIfChanged()
+	{
+		Path path = Path::combine(FileSystem::getTempDirectoryPath(), "testsolution.sln");
+		if (FileSystem::exists(path))
+			FileSystem::remove(path);
+
+		const String contents = "Microsoft Visual Studio Solution File\r\n";
+		BS_TEST_ASSERT(CSProject::writeFile(path, contents));
+		BS_TEST_ASSERT(!CSProject::writeFile(path, contents));
+
+		const String newContents = contents + "EndGlobal\r\n";
+		BS_TEST_ASSERT(CSProject::writeFile(path, newContents));
+		BS_TEST_ASSERT(!CSProject::writeFile(path, newContents));
+
+		SPtr<DataStream> stream = FileSystem::openFile(path);
+		BS_TEST_ASSERT(stream->getAsString() == newContents);
+		stream->close();
+
+		BS_TEST_ASSERT(!FileSystem::exists(Path::combine(FileSystem::getTempDirectoryPath(), "testsolution.sln.tmp")));
+		FileSystem::remove(path);
+	}
+
+	void EditorTestSuite::TestPickedIndexRanking()
+	{
+		const UINT32 EMPTY = 0x00FFFFFF;
+
+		// Dense identifiers
+		Vector<UINT32> ids = { 3, EMPTY, 1, 3, 2, EMPTY, 3, 1, 2, EMPTY };
+		Vector<UINT32> ranked = ScenePicking::rankPickedIndices(ids.data(), (UINT32)ids.size());
+		BS_TEST_ASSERT(ranked.size() == 3);
+		BS_TEST_ASSERT(ranked[0] == 3 && ranked[1] == 1 && ranked[2] == 2);
+
+		// Sparse identifiers must produce the same ordering
+		Vector<UINT32> sparseIds = { 0x00FF0000, 7, 0x00FF0000, EMPTY, 0x00100000, 7, 0x00100000 };
+		ranked = ScenePicking::rankPickedIndices(sparseIds.data(), (UINT32)sparseIds.size());
+		BS_TEST_ASSERT(ranked.size() == 3);
+		BS_TEST_ASSERT(ranked[0] == 7 && ranked[1] == 0x00100000 && ranked[2] == 0x00FF0000);
+
+		Vector<UINT32> emptyIds = { EMPTY, EMPTY };
+		BS_TEST_ASSERT(ScenePicking::rankPickedIndices(emptyIds.data(), (UINT32)emptyIds.size()).empty());
+	}
+
+	void EditorTestSuite::TestProjectFileMetaLazyDecode()
+	{
+		Path path = Path::combine(FileSystem::getTempDirectoryPath(), "testresource.meta");
+		if (FileSystem::exists(path))
+			FileSystem::remove(path);
+
+		SPtr<TextureImportOptions> importOptions = TextureImportOptions::create();
+		importOptions->generateMips = true;
+		importOptions->maxMip = 3;
+
+		SPtr<ShaderMetaData> shaderMetaData = bs_shared_ptr_new<ShaderMetaData>();
+		shaderMetaData->includes.push_back("Includes/Common.bslinc");
+
+		SPtr<PixelData> iconPixels = PixelData::create(4, 4, 1, PF_RGBA8);
+		iconPixels->setColors(Color::Red);
+
+		ProjectResourceIcons icons;
+		icons.icon16 = Texture::create(iconPixels, TU_STATIC | TU_CPUREADABLE);
+
+		const UUID uuid = UUIDGenerator::generateRandom();
+		SPtr<ProjectFileMeta> meta = ProjectFileMeta::create(importOptions);
+		meta->add(ProjectResourceMeta::create("resource", uuid, 7, icons, shaderMetaData));
+		meta->setIncludeInBuild(true);
+		meta->save(path);
+
+		// Meta-data is encoded as text, so source control doesn't treat meta files as binary
+		{
+			SPtr<DataStream> stream = FileSystem::openFile(path);
+			Vector<char> bytes(stream->size());
+			stream->read(bytes.data(), bytes.size());
+			stream->close();
+
+			BS_TEST_ASSERT(std::find(bytes.begin(), bytes.end(), '\0') == bytes.end());
+
+			// Import options are written as text, a line per field
+			const String text(bytes.begin(), bytes.end());
+			BS_TEST_ASSERT(text.find("\nimportOptions ") != String::npos);
+			BS_TEST_ASSERT(text.find("\noption ") != String::npos);
+		}
+
+		SPtr<ProjectFileMeta> loadedMeta = ProjectFileMeta::load(path);
+		BS_TEST_ASSERT(loadedMeta != nullptr);
+		BS_TEST_ASSERT(!loadedMeta->isDecoded());
+		BS_TEST_ASSERT(loadedMeta->getIncludeInBuild());
+		BS_TEST_ASSERT(loadedMeta->hasUUID(uuid));
+		BS_TEST_ASSERT(loadedMeta->hasTypeId(7));
+
+		// Header alone is enough to list the contained resources
+		Vector<SPtr<ProjectResourceMeta>> resourceMetas = loadedMeta->getResourceMetaData();
+		BS_TEST_ASSERT(resourceMetas.size() == 1);
+		BS_TEST_ASSERT(resourceMetas[0]->getUniqueName() == "resource");
+		BS_TEST_ASSERT(!loadedMeta->isDecoded());
+
+		loadedMeta->decode();
+		BS_TEST_ASSERT(loadedMeta->isDecoded());
+		BS_TEST_ASSERT(!loadedMeta->hasDecodeFailed());
+		BS_TEST_ASSERT(loadedMeta->getResourceMetaData().size() == 1);
+
+		// Everything not in the header is restored by decoding
+		SPtr<TextureImportOptions> loadedImportOptions = 
+			std::dynamic_pointer_cast<TextureImportOptions>(loadedMeta->getImportOptions());
+		BS_TEST_ASSERT(loadedImportOptions != nullptr);
+		BS_TEST_ASSERT(loadedImportOptions->generateMips);
+		BS_TEST_ASSERT(loadedImportOptions->maxMip == 3);
+
+		SPtr<ShaderMetaData> loadedShaderMetaData = 
+			std::dynamic_pointer_cast<ShaderMetaData>(resourceMetas[0]->getResourceMetaData());
+		BS_TEST_ASSERT(loadedShaderMetaData != nullptr);
+		BS_TEST_ASSERT(loadedShaderMetaData->includes.size() == 1);
+		BS_TEST_ASSERT(loadedShaderMetaData->includes[0] == "Includes/Common.bslinc");
+
+		const HTexture& loadedIcon = resourceMetas[0]->getPreviewIcons().icon16;
+		BS_TEST_ASSERT(loadedIcon.isLoaded());
+		BS_TEST_ASSERT(loadedIcon->getProperties().getWidth() == 4);
+		BS_TEST_ASSERT(loadedIcon->getProperties().getHeight() == 4);
+
+		FileSystem::remove(path);
+	}
+
+	void EditorTestSuite::TestProjectFileMetaFallbacks()
+	{
+		Path path = Path::combine(FileSystem::getTempDirectoryPath(), "testresource.meta");
+		if (FileSystem::exists(path))
+			FileSystem::remove(path);
+
+		SPtr<TextureImportOptions> importOptions = TextureImportOptions::create();
+		importOptions->maxMip = 2;
+
+		const UUID uuid = UUIDGenerator::generateRandom();
+		SPtr<ProjectFileMeta> meta = ProjectFileMeta::create(importOptions);
+		meta->add(ProjectResourceMeta::create("resource", uuid, 7, ProjectResourceIcons(), nullptr));
+
+		// Meta files from older versions have no header, and are decoded in full on load
+		{
+			FileEncoder fs(path);
+			fs.encode(meta.get());
+		}
+
+		SPtr<ProjectFileMeta> legacyMeta = ProjectFileMeta::load(path);
+		BS_TEST_ASSERT(legacyMeta != nullptr);
+		BS_TEST_ASSERT(legacyMeta->isDecoded());
+		BS_TEST_ASSERT(legacyMeta->hasUUID(uuid));
+
+		SPtr<TextureImportOptions> legacyImportOptions = 
+			std::dynamic_pointer_cast<TextureImportOptions>(legacyMeta->getImportOptions());
+		BS_TEST_ASSERT(legacyImportOptions != nullptr);
+		BS_TEST_ASSERT(legacyImportOptions->maxMip == 2);
+
+		// Meta-data not matching the hash in the header fails to decode, but the resources listed in the header remain
+		meta->save(path);
+
+		String text;
+		{
+			SPtr<DataStream> stream = FileSystem::openFile(path);
+			text = stream->getAsString();
+			stream->close();
+		}
+
+		const size_t dataStart = text.find('\n', text.find("\ndata ") + 1) + 1;
+		BS_TEST_ASSERT(dataStart < text.size());
+		text[dataStart] = text[dataStart] == 'A' ? 'B' : 'A';
+
+		{
+			SPtr<DataStream> stream = FileSystem::createAndOpenFile(path);
+			stream->write(text.data(), text.size());
+			stream->close();
+		}
+
+		SPtr<ProjectFileMeta> corruptedMeta = ProjectFileMeta::load(path);
+		BS_TEST_ASSERT(corruptedMeta != nullptr);
+		BS_TEST_ASSERT(!corruptedMeta->hasDecodeFailed());
+
+		corruptedMeta->decode();
+		BS_TEST_ASSERT(corruptedMeta->hasDecodeFailed());
+		BS_TEST_ASSERT(corruptedMeta->hasUUID(uuid));
+		BS_TEST_ASSERT(corruptedMeta->getImportOptions() == nullptr);
+
+		// Line endings converted by source control don't affect loading
+		meta->save(path);
+		{
+			SPtr<DataStream> stream = FileSystem::openFile(path);
+			text = stream->getAsString();
+			stream->close();
+		}
+
+		text = StringUtil::replaceAll(text, "\n", "\r\n");
+		{
+			SPtr<DataStream> stream = FileSystem::createAndOpenFile(path);
+			stream->write(text.data(), text.size());
+			stream->close();
+		}
+
+		SPtr<ProjectFileMeta> convertedMeta = ProjectFileMeta::load(path);
+		BS_TEST_ASSERT(convertedMeta != nullptr);
+		BS_TEST_ASSERT(convertedMeta->hasUUID(uuid));
+		BS_TEST_ASSERT(convertedMeta->getResourceMetaData()[0]->getUniqueName() == "resource");
+
+		convertedMeta->decode();
+		BS_TEST_ASSERT(!convertedMeta->hasDecodeFailed());
+
+		SPtr<TextureImportOptions> convertedImportOptions = 
+			std::dynamic_pointer_cast<TextureImportOptions>(convertedMeta->getImportOptions());
+		BS_TEST_ASSERT(convertedImportOptions != nullptr);
+		BS_TEST_ASSERT(convertedImportOptions->maxMip == 2);
+
+		// Files written by a newer version aren't loaded at all
+		{
+			const String newerText = "BansheeMeta 99\nincludeInBuild false\ndata 0 0\n";
+
+			SPtr<DataStream> stream = FileSystem::createAndOpenFile(path);
+			stream->write(newerText.data(), newerText.size());
+			stream->close();
+		}
+
+		BS_TEST_ASSERT(ProjectFileMeta::load(path) == nullptr);
+
+		FileSystem::remove(path);
+	}
+
+	void EditorTestSuite::TestGizmoInstanceData()
+	{
+		GizmoManager& gizmoManager = GizmoManager::instance();
+		gizmoManager.clearGizmos();
+
+		const Matrix4 transform = Matrix4::TRS(Vector3(1.0f, 2.0f, 3.0f),
+			Quaternion(Degree(0.0f), Degree(0.0f), Degree(45.0f)), Vector3(2.0f, 1.0f, 1.0f));
+
+		HSceneObject so = SceneObject::create("GizmoInstanceData");
+		gizmoManager.startGizmo(so);
+		gizmoManager.setTransform(transform);
+		gizmoManager.setColor(Color::Red);
+		gizmoManager.drawCube(Vector3(0.0f, 1.0f, 0.0f), Vector3(0.5f, 0.5f, 0.5f));
+		gizmoManager.setPickable(false);
+		gizmoManager.drawWireSphere(Vector3::ZERO, 2.0f);
+		gizmoManager.setPickable(true);
+		gizmoManager.setColor(Color(1.0f, 1.0f, 1.0f, 0.5f));
+		gizmoManager.drawSphere(Vector3::ZERO, 1.0f);
+		gizmoManager.endGizmo();
+
+		// Translucent primitives aren't instanced, so they can be sorted with the rest of the translucent gizmos
+		GizmoManager::InstanceRenderDataPtr instanceData = gizmoManager.createInstanceData(nullptr);
+		BS_TEST_ASSERT(instanceData->instances[(UINT32)InstancedGizmoType::SolidCube].size() == 1);
+		BS_TEST_ASSERT(instanceData->instances[(UINT32)InstancedGizmoType::WireSphere].size() == 1);
+		BS_TEST_ASSERT(instanceData->instances[(UINT32)InstancedGizmoType::SolidSphere].empty());
+
+		// The unit mesh ends up where the gizmo transform would place the primitive
+		const GizmoManager::InstanceData& cube = instanceData->instances[(UINT32)InstancedGizmoType::SolidCube][0];
+		BS_TEST_ASSERT(cube.color == Color::Red.getAsRGBA());
+		BS_TEST_ASSERT(sizeof(GizmoManager::InstanceData) == 52);
+
+		const Vector4 unitCorner(1.0f, 1.0f, 1.0f, 1.0f);
+		const Vector3 instancedCorner(cube.transform[0].dot(unitCorner), cube.transform[1].dot(unitCorner),
+			cube.transform[2].dot(unitCorner));
+		const Vector3 expectedCorner = transform.multiplyAffine(Vector3(0.5f, 1.5f, 0.5f));
+		BS_TEST_ASSERT(Math::approxEquals(instancedCorner, expectedCorner, 0.001f));
+
+		// Normals transformed the same way as the shader does stay perpendicular to the surface under non-uniform scale
+		const Vector3 normal(1.0f, 1.0f, 0.0f);
+		const Vector4 tangent(1.0f, -1.0f, 0.0f, 0.0f);
+
+		const Vector3 row0(cube.transform[0].x, cube.transform[0].y, cube.transform[0].z);
+		const Vector3 row1(cube.transform[1].x, cube.transform[1].y, cube.transform[1].z);
+		const Vector3 row2(cube.transform[2].x, cube.transform[2].y, cube.transform[2].z);
+
+		const Vector3 transformedNormal(row1.cross(row2).dot(normal), row2.cross(row0).dot(normal),
+			row0.cross(row1).dot(normal));
+		const Vector3 transformedTangent(cube.transform[0].dot(tangent), cube.transform[1].dot(tangent),
+			cube.transform[2].dot(tangent));
+		BS_TEST_ASSERT(Math::approxEquals(transformedNormal.dot(transformedTangent), 0.0f, 0.001f));
+
+		// Picking outputs all pickable primitives, including translucent ones, with their picking colors
+		const Color pickingColor(0.0f, 0.5f, 0.0f, 1.0f);
+		instanceData = gizmoManager.createInstanceData([&](UINT32) { return pickingColor; });
+		BS_TEST_ASSERT(instanceData->instances[(UINT32)InstancedGizmoType::SolidCube].size() == 1);
+		BS_TEST_ASSERT(instanceData->instances[(UINT32)InstancedGizmoType::WireSphere].empty());
+		BS_TEST_ASSERT(instanceData->instances[(UINT32)InstancedGizmoType::SolidSphere].size() == 1);
+		BS_TEST_ASSERT(instanceData->instances[(UINT32)InstancedGizmoType::SolidSphere][0].color == 
+			pickingColor.getAsRGBA());
+
+		gizmoManager.clearGizmos();
+		so->destroy();
+	}
+
+	void EditorTestSuite::TestPickedPixelRanking()
+	{
+		const UINT32 EMPTY = 0x00FFFFFF;
+		const UINT32 WIDTH = 4;
+		const UINT32 HEIGHT = 3;
+
+		// Includes an identifier too large to be counted directly
+		const Vector<UINT32> ids = {
+			5, 2, 5, 0x00ABCDEF,
+			EMPTY, 5, 2, 0x00ABCDEF,
+			5, 0x00ABCDEF, 2, 5
+		};
+
+		const Vector<UINT32> expected = ScenePicking::rankPickedIndices(ids.data(), (UINT32)ids.size());
+		BS_TEST_ASSERT(expected.size() == 3);
+		BS_TEST_ASSERT(expected[0] == 5 && expected[1] == 2 && expected[2] == 0x00ABCDEF);
+
+		// Byte order differs between formats, and non 8-bit formats are decoded through colors
+		for (auto format : { PF_RGBA8, PF_BGRA8, PF_RGBA32F })
+		{
+			SPtr<PixelData> pixelData = PixelData::create(WIDTH, HEIGHT, 1, format);
+			for (UINT32 y = 0; y < HEIGHT; y++)
+			{
+				for (UINT32 x = 0; x < WIDTH; x++)
+					pixelData->setColorAt(ScenePicking::encodeIndex(ids[y * WIDTH + x]), x, y);
+			}
+
+			BS_TEST_ASSERT(ScenePicking::rankPickedPixels(*pixelData, WIDTH, HEIGHT) == expected);
+
+			// Only the requested area is decoded
+			const Vector<UINT32> firstRow = ScenePicking::rankPickedPixels(*pixelData, WIDTH, 1);
+			BS_TEST_ASSERT(firstRow.size() == 3);
+			BS_TEST_ASSERT(firstRow[0] == 5 && firstRow[1] == 2 && firstRow[2] == 0x00ABCDEF);
+		}
+	}
 }
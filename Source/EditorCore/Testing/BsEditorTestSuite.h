@@ -5,6 +5,10 @@
 #include "BsEditorPrerequisites.h"
 #include "Testing/BsTestSuite.h"
 #include "Scene/BsComponent.h"
+#include "Handles/BsHandleSlider.h"
+#include "Handles/BsHandleSliderManager.h"
+#include "Math/BsSphere.h"
+#include "Math/BsRay.h"
 
 namespace bs
 {
@@ -67,6 +71,49 @@ namespace bs
 		TestComponentB() {} // Serialization only
 	};
 
+	/** Sphere slider that registers with a provided slider manager, instead of the global one. */
+	class TestHandleSlider : public HandleSlider
+	{
+	public:
+		TestHandleSlider(HandleSliderManager& manager, float radius)
+			:HandleSlider(false, 1), mSliderManager(manager), mCollider(Vector3::ZERO, radius)
+		{
+			mSliderManager._registerSlider(this);
+		}
+
+		~TestHandleSlider()
+		{
+			mSliderManager._unregisterSlider(this);
+		}
+
+		bool intersects(const Vector2I& screenPos, const Ray& ray, float& t) const override
+		{
+			Ray localRay = ray;
+			localRay.transformAffine(getTransformInv());
+
+			auto intersect = mCollider.intersects(localRay);
+			if (!intersect.first)
+				return false;
+
+			Vector3 intrPoint = getTransform().multiplyAffine(localRay.getPoint(intersect.second));
+			t = (intrPoint - ray.getOrigin()).length();
+
+			return true;
+		}
+
+		void handleInput(const SPtr<Camera>& camera, const Vector2I& inputDelta) override { }
+
+	protected:
+		bool getLocalBounds(Sphere& bounds) const override
+		{
+			bounds = mCollider;
+			return true;
+		}
+
+		HandleSliderManager& mSliderManager;
+		Sphere mCollider;
+	};
+
 	/** @endcond */
 
 	/**	Contains a set of unit tests for the editor. */
@@ -79,6 +126,15 @@ namespace bs
 		/**	Tests SceneObject record undo/redo operation. */
 		void SceneObjectRecord_UndoRedo();
 
+		/** Tests SceneObject record/restore when the hierarchy structure is unchanged and objects can be patched in place. */
+		void SceneObjectRecord_InPlace();
+
+		/** Tests bulk cloning of scene objects, and the clone undo/redo operation. */
+		void SceneObjectClone_UndoRedo();
+
+		/** Tests filtering of nested and duplicate objects out of a scene object list. */
+		void SceneObjectRemoveDescendants();
+
 		/**	Tests SceneObject delete undo/redo operation. */
 		void SceneObjectDelete_UndoRedo();
 
@@ -93,6 +149,54 @@ namespace bs
 
 		/**	Tests the frame allocator. */
 		void TestFrameAlloc();
+
+		/** Tests that handle slider picking finds the same slider as an exhaustive search, with a large number of sliders. */
+		void TestHandleSliderPicking();
+
+		/** Tests sharing, evaluation and eviction of textures in the gradient texture cache. */
+		void TestGradientTextureCache();
+
+		/** Tests recording, aggregation and export of editor profiler samples. */
+		void TestEditorProfiler();
+
+		/** Tests admission of import tasks against the import memory budget. */
+		void TestImportGovernor();
+
+		/** Tests ordering of transitive dependants in the import dependency graph. */
+		void TestImportDependencyGraph();
+
+		/** Tests collapsing of folder monitor changes into a minimal set of refreshes. */
+		void TestLibraryChangeBatch();
+
+		/** Tests reuse of handle and gizmo meshes between frames. */
+		void TestDrawMeshCache();
+
+		/** Tests point set slider picking against brute force sphere intersection. */
+		void TestHandleSliderPointSet();
+
+		/** Tests that the shared scene snapshot tracks selection and runs per-frame work once. */
+		void TestEditorSceneSnapshot();
+
+		/** Tests that solution files are only rewritten when their contents change. */
+		void TestSolutionWriteIfChanged();
+
+		/** Tests ranking of picked objects by the number of pixels they cover. */
+		void TestPickedIndexRanking();
+
+		/** Tests that meta files load only their header, and decode the rest on first access. */
+		void TestProjectFileMetaLazyDecode();
+
+		/** 
+		 * Tests loading of meta files without a header, with corrupted meta-data, with converted line endings or from a
+		 * newer version.
+		 */
+		void TestProjectFileMetaFallbacks();
+
+		/** Tests per-instance data generated for instanced gizmo primitives. */
+		void TestGizmoInstanceData();
+
+		/** Tests ranking of picked objects decoded directly from picking render target pixels. */
+		void TestPickedPixelRanking();
 	};
 
 	/** @} */
@@ -2,59 +2,80 @@
 //**************** Copyright (c) 2016 Marko Pintera (marko.pintera@gmail.com). All rights reserved. **********************//
 #include "UndoRedo/BsCmdCloneSO.h"
 #include "Scene/BsSceneObject.h"
+#include "Scene/BsGameObjectManager.h"
+#include "Utility/BsEditorUtility.h"
 
 namespace bs
 {
-	CmdCloneSO::CmdCloneSO(const String& description, const Vector<HSceneObject>& originals)
-		:EditorCommand(description), mOriginals(originals)
+	CmdCloneSO::CmdCloneSO(const String& description, const Vector<HSceneObject>& originals, const HSceneObject& parent,
+		bool keepWorldTransform)
+		:EditorCommand(description), mOriginals(originals), mParent(parent), mKeepWorldTransform(keepWorldTransform)
 	{ }
 
 	HSceneObject CmdCloneSO::execute(const HSceneObject& sceneObject, const String& description)
 	{
 		// Register command and commit it
-		CmdCloneSO* command = new (bs_alloc<CmdCloneSO>()) CmdCloneSO(description, { sceneObject });
+		CmdCloneSO* command = new (bs_alloc<CmdCloneSO>()) CmdCloneSO(description, { sceneObject }, HSceneObject(), false);
 		SPtr<CmdCloneSO> commandPtr = bs_shared_ptr(command);
 
 		UndoRedo::instance().registerCommand(commandPtr);
 		commandPtr->commit();
 
-		if (!commandPtr->mClones.empty())
-			return commandPtr->mClones[0];
+		Vector<HSceneObject> clones = commandPtr->getClones();
+		if (!clones.empty())
+			return clones[0];
 
 		return HSceneObject();
 	}
 
-	Vector<HSceneObject> CmdCloneSO::execute(const Vector<HSceneObject>& sceneObjects, const String& description)
+	Vector<HSceneObject> CmdCloneSO::execute(const Vector<HSceneObject>& sceneObjects, const String& description,
+		const HSceneObject& parent, bool keepWorldTransform)
 	{
 		// Register command and commit it
-		CmdCloneSO* command = new (bs_alloc<CmdCloneSO>()) CmdCloneSO(description, sceneObjects);
+		CmdCloneSO* command = new (bs_alloc<CmdCloneSO>()) CmdCloneSO(description, sceneObjects, parent,
+			keepWorldTransform);
 		SPtr<CmdCloneSO> commandPtr = bs_shared_ptr(command);
 
 		UndoRedo::instance().registerCommand(commandPtr);
 		commandPtr->commit();
 
-		return commandPtr->mClones;
+		return commandPtr->getClones();
 	}
 
 	void CmdCloneSO::commit()
 	{
-		mClones.clear();
+		HSceneObject parent;
+		if (!mParent.isDestroyed())
+			parent = mParent;
 
-		for (auto& original : mOriginals)
-		{
-			if (!original.isDestroyed())
-				mClones.push_back(original->clone());
-		}
+		Vector<HSceneObject> clones = EditorUtility::cloneSceneObjects(mOriginals, parent, mKeepWorldTransform);
+
+		mCloneIds.clear();
+		mCloneIds.reserve(clones.size());
+
+		for (auto& clone : clones)
+			mCloneIds.push_back(clone->getInstanceId());
 	}
 
 	void CmdCloneSO::revert()
 	{
-		for (auto& clone : mClones)
+		for (auto& clone : getClones())
 		{
 			if (!clone.isDestroyed())
 				clone->destroy(true);
 		}
 
-		mClones.clear();
+		mCloneIds.clear();
+	}
+
+	Vector<HSceneObject> CmdCloneSO::getClones() const
+	{
+		Vector<HSceneObject> clones;
+		clones.reserve(mCloneIds.size());
+
+		for (auto& id : mCloneIds)
+			clones.push_back(static_object_cast<SceneObject>(GameObjectManager::instance().getObject(id)));
+
+		return clones;
 	}
 }
\ No newline at end of file
@@ -30,11 +30,16 @@ namespace bs
 		 * Creates new scene object(s) by cloning existing objects. Automatically registers the command with undo/redo 
 		 * system.
 		 *
-		 * @param[in]	sceneObjects	Scene object(s) to clone.
-		 * @param[in]	description		Optional description of what exactly the command does.
-		 * @return						Cloned objects.
+		 * @param[in]	sceneObjects		Scene object(s) to clone.
+		 * @param[in]	description			Optional description of what exactly the command does.
+		 * @param[in]	parent				Optional parent to attach the clones to. If null the clones are attached to
+		 *									the scene root.
+		 * @param[in]	keepWorldTransform	If true the clones will have the same world transform as their originals,
+		 *									otherwise they keep the local transform of their originals.
+		 * @return							Cloned objects.
 		 */
-		static Vector<HSceneObject> execute(const Vector<HSceneObject>& sceneObjects, const String& description = StringUtil::BLANK);
+		static Vector<HSceneObject> execute(const Vector<HSceneObject>& sceneObjects, const String& description = StringUtil::BLANK,
+			const HSceneObject& parent = HSceneObject(), bool keepWorldTransform = false);
 
 		/** @copydoc EditorCommand::commit */
 		void commit() override;
@@ -45,10 +50,17 @@ namespace bs
 	private:
 		friend class UndoRedo;
 
-		CmdCloneSO(const String& description, const Vector<HSceneObject>& originals);
+		CmdCloneSO(const String& description, const Vector<HSceneObject>& originals, const HSceneObject& parent,
+			bool keepWorldTransform);
+
+		/** Returns the clones created by the last commit(). */
+		Vector<HSceneObject> getClones() const;
 
 		Vector<HSceneObject> mOriginals;
-		Vector<HSceneObject> mClones;
+		HSceneObject mParent;
+		bool mKeepWorldTransform;
+
+		Vector<UINT64> mCloneIds;
 	};
 
 	/** @} */
@@ -2,6 +2,7 @@
 //**************** Copyright (c) 2016 Marko Pintera (marko.pintera@gmail.com). All rights reserved. **********************//
 #include "UndoRedo/BsUndoRedo.h"
 #include "UndoRedo/BsEditorCommand.h"
+#include "Scene/BsSerializedSceneObject.h"
 
 namespace bs
 {
@@ -23,6 +24,16 @@ namespace bs
 		bs_deleteN(mRedoStack, MAX_STACK_ELEMENTS);
 	}
 
+	void UndoRedo::onStartUp()
+	{
+		SerializedSceneObjectCache::startUp();
+	}
+
+	void UndoRedo::onShutDown()
+	{
+		SerializedSceneObjectCache::shutDown();
+	}
+
 	void UndoRedo::undo()
 	{
 		if(mUndoNumElements == 0)
@@ -69,6 +69,12 @@ namespace bs
 		void clear();
 
 	private:
+		/** @copydoc Module::onStartUp */
+		void onStartUp() override;
+
+		/** @copydoc Module::onShutDown */
+		void onShutDown() override;
+
 		/**	Removes the last undo command from the undo stack, and returns it. */
 		SPtr<EditorCommand> removeLastFromUndoStack();
 
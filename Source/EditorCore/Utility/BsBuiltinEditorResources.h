@@ -132,6 +132,15 @@ namespace bs
 		/**	Creates a material used for picking transparent gizmos. */
 		HMaterial createAlphaGizmoPickingMat() const;
 
+		/**	Creates a material used for rendering solid gizmos using instancing. */
+		HMaterial createSolidGizmoInstancedMat() const;
+
+		/**	Creates a material used for rendering line gizmos using instancing. */
+		HMaterial createLineGizmoInstancedMat() const;
+
+		/**	Creates a material used for picking gizmos rendered using instancing. */
+		HMaterial createGizmoPickingInstancedMat() const;
+
 		/**	Creates a material used for rendering line handles. */
 		HMaterial createLineHandleMat() const;
 
@@ -242,6 +251,9 @@ namespace bs
 		HShader mShaderGizmoPicking;
 		HShader mShaderGizmoAlphaPicking;
 		HShader mShaderGizmoText;
+		HShader mShaderGizmoSolidInstanced;
+		HShader mShaderGizmoLineInstanced;
+		HShader mShaderGizmoPickingInstanced;
 		HShader mShaderHandleSolid;
 		HShader mShaderHandleLine;
 		HShader mShaderHandleClearAlpha;
@@ -326,6 +338,9 @@ namespace bs
 		static const String ShaderGizmoPickingFile;
 		static const String ShaderGizmoPickingAlphaFile;
 		static const String ShaderTextGizmoFile;
+		static const String ShaderSolidGizmoInstancedFile;
+		static const String ShaderLineGizmoInstancedFile;
+		static const String ShaderGizmoPickingInstancedFile;
 		static const String ShaderSelectionFile;
 
 		static const String EmptyShaderCodeFile;
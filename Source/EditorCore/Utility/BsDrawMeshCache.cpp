@@ -0,0 +1,132 @@
+//********************************** Banshee Engine (www.banshee3d.com) **************************************************//
+//**************** Copyright (c) 2019 Marko Pintera (marko.pintera@gmail.com). All rights reserved. **********************//
+#include "Utility/BsDrawMeshCache.h"
+#include "Renderer/BsCamera.h"
+#include "RenderAPI/BsViewport.h"
+#include "Mesh/BsMeshData.h"
+#include "Utility/BsTime.h"
+
+namespace bs
+{
+	/** Mesh counts of the frame currently in progress, and of the last completed frame. */
+	static DrawMeshStats sCurrentFrameStats;
+	static DrawMeshStats sLastFrameStats;
+	static UINT64 sStatsFrameIdx = 0;
+
+	/** Starts counting a new frame, if the frame changed since the last call. */
+	static DrawMeshStats& getCurrentFrameStats()
+	{
+		const UINT64 frameIdx = gTime().getFrameIdx();
+		if (frameIdx != sStatsFrameIdx)
+		{
+			sLastFrameStats = frameIdx == sStatsFrameIdx + 1 ? sCurrentFrameStats : DrawMeshStats();
+			sCurrentFrameStats = DrawMeshStats();
+			sStatsFrameIdx = frameIdx;
+		}
+
+		return sCurrentFrameStats;
+	}
+
+	const Vector<DrawHelper::ShapeMeshData>& DrawMeshCache::getMeshes(DrawHelper& drawHelper,
+		DrawHelper::SortType sortType, const Camera* camera, UINT64 layers)
+	{
+		const UINT64 frameIdx = gTime().getFrameIdx();
+
+		// Drop meshes of cameras that are no longer being drawn to
+		if (frameIdx != mLastFrameIdx)
+		{
+			for (auto iter = mEntries.begin(); iter != mEntries.end();)
+			{
+				if (iter->second.lastUsedFrame + 1 < frameIdx)
+					iter = mEntries.erase(iter);
+				else
+					++iter;
+			}
+
+			mLastFrameIdx = frameIdx;
+		}
+
+		UINT64 key = mCommandsHash;
+		key = key * 31 + (UINT64)sortType;
+		key = key * 31 + layers;
+
+		if (camera != nullptr)
+			key = key * 31 + hashCamera(*camera);
+
+		Entry& entry = mEntries[camera];
+		entry.lastUsedFrame = frameIdx;
+
+		DrawMeshStats& stats = getCurrentFrameStats();
+		if (entry.isBuilt && entry.key == key)
+		{
+			stats.numReused += (UINT32)entry.meshes.size();
+			return entry.meshes;
+		}
+
+		entry.key = key;
+		entry.isBuilt = true;
+		entry.meshes = drawHelper.buildMeshes(sortType, camera, layers);
+
+		stats.numBuilt += (UINT32)entry.meshes.size();
+		return entry.meshes;
+	}
+
+	void DrawMeshCache::clear()
+	{
+		mEntries.clear();
+	}
+
+	UINT64 DrawMeshCache::hashCamera(const Camera& camera)
+	{
+		Rect2I pixelArea;
+
+		const SPtr<Viewport>& viewport = camera.getViewport();
+		if (viewport != nullptr)
+			pixelArea = viewport->getPixelArea();
+
+		return hash(camera.getViewMatrix(), camera.getProjectionMatrixRS(), pixelArea);
+	}
+
+	DrawMeshStats DrawMeshCache::getFrameStats()
+	{
+		getCurrentFrameStats();
+		return sLastFrameStats;
+	}
+
+	void DrawMeshCache::_notifyMeshes(UINT32 numBuilt, UINT32 numReused)
+	{
+		DrawMeshStats& stats = getCurrentFrameStats();
+		stats.numBuilt += numBuilt;
+		stats.numReused += numReused;
+	}
+
+	void DrawMeshCache::recordBytes(const void* data, UINT32 size)
+	{
+		// FNV-1a
+		const UINT8* bytes = (const UINT8*)data;
+		for (UINT32 i = 0; i < size; i++)
+		{
+			mCommandsHash ^= bytes[i];
+			mCommandsHash *= 1099511628211ULL;
+		}
+	}
+
+	void DrawMeshCache::recordValue(const SPtr<MeshData>& value)
+	{
+		recordValue(value.get());
+		if (value == nullptr)
+			return;
+
+		// Mesh data can be modified in-place by its owner, so hash the geometry rather than just its address
+		const UINT32 numVertices = value->getNumVertices();
+		recordValue(numVertices);
+		recordValue(value->getNumIndices());
+
+		auto positionIter = value->getVec3DataIter(VES_POSITION);
+		for (UINT32 i = 0; i < numVertices; i++)
+		{
+			recordValue(positionIter.getValue());
+			positionIter.moveNext();
+		}
+	}
+}
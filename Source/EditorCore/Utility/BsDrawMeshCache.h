@@ -0,0 +1,135 @@
+//********************************** Banshee Engine (www.banshee3d.com) **************************************************//
+//**************** Copyright (c) 2019 Marko Pintera (marko.pintera@gmail.com). All rights reserved. **********************//
+#pragma once
+
+#include "BsEditorPrerequisites.h"
+#include "Utility/BsDrawHelper.h"
+
+namespace bs
+{
+	/** @addtogroup Utility-Editor
+	 *  @{
+	 */
+
+	/** Number of meshes created and reused by DrawMeshCache%s during a single frame. */
+	struct DrawMeshStats
+	{
+		UINT32 numBuilt = 0; /**< Number of meshes created, each requiring GPU buffer allocation on the core thread. */
+		UINT32 numReused = 0; /**< Number of meshes reused from an earlier frame, without any GPU allocations. */
+	};
+
+	/**
+	 * Retains meshes built by a DrawHelper so they can be reused in later frames. Editor handles and gizmos are re-queued
+	 * every frame but rarely change, so rather than creating new meshes on every DrawHelper::buildMeshes() call, the
+	 * caller records each draw command it issues to the DrawHelper through record(), and the meshes are only rebuilt when
+	 * the recorded commands or the camera differ from the previous build for the same camera.
+	 */
+	class BS_ED_EXPORT DrawMeshCache
+	{
+		/** Meshes built for a single camera. */
+		struct Entry
+		{
+			UINT64 key = 0;
+			UINT64 lastUsedFrame = 0;
+			bool isBuilt = false;
+			Vector<DrawHelper::ShapeMeshData> meshes;
+		};
+
+	public:
+		/**
+		 * Records a draw command issued to the DrawHelper. Must be called for every command (including color, transform
+		 * and layer changes) with all the values that influence the generated geometry.
+		 *
+		 * @param[in]	command		Unique name of the command.
+		 * @param[in]	args		Command parameters.
+		 */
+		template<class... Args>
+		void record(const char* command, const Args&... args)
+		{
+			recordValue(command);
+			(void)std::initializer_list<int>{ (recordValue(args), 0)... };
+		}
+
+		/** Forgets all the recorded commands. Should be called whenever the DrawHelper is cleared. */
+		void clearCommands() { mCommandsHash = HASH_SEED; }
+
+		/** Returns the hash of all the commands recorded since the last call to clearCommands(). */
+		UINT64 getCommandsHash() const { return mCommandsHash; }
+
+		/**
+		 * Returns meshes for all the commands queued on the provided DrawHelper. If the recorded commands, camera and
+		 * parameters match the last call for the same camera, the previously built meshes are returned. Otherwise this
+		 * is equivalent to calling DrawHelper::buildMeshes().
+		 */
+		const Vector<DrawHelper::ShapeMeshData>& getMeshes(DrawHelper& drawHelper, DrawHelper::SortType sortType,
+			const Camera* camera, UINT64 layers = 0xFFFFFFFFFFFFFFFF);
+
+		/** Releases all the retained meshes. */
+		void clear();
+
+		/**
+		 * Returns a hash of all camera properties that influence meshes built for it. Meshes built for a camera can only
+		 * be reused if this hash remains unchanged.
+		 */
+		static UINT64 hashCamera(const Camera& camera);
+
+		/** Hashes the provided values using the same hash function as record(). */
+		template<class... Args>
+		static UINT64 hash(const Args&... args)
+		{
+			DrawMeshCache hasher;
+			(void)std::initializer_list<int>{ (hasher.recordValue(args), 0)... };
+
+			return hasher.mCommandsHash;
+		}
+
+		/** Returns the number of meshes built and reused by all caches during the last completed frame. */
+		static DrawMeshStats getFrameStats();
+
+		/** @name Internal
+		 *  @{
+		 */
+
+		/** Registers meshes created or reused outside of getMeshes(), so they are included in getFrameStats(). */
+		static void _notifyMeshes(UINT32 numBuilt, UINT32 numReused);
+
+		/** @} */
+	private:
+		static constexpr UINT64 HASH_SEED = 14695981039346656037ULL;
+
+		/** Hashes the provided bytes into the command hash. */
+		void recordBytes(const void* data, UINT32 size);
+
+		void recordValue(const char* value) { recordBytes(value, (UINT32)strlen(value) + 1); }
+		void recordValue(const String& value) { recordBytes(value.data(), (UINT32)value.size() + 1); }
+		void recordValue(const SPtr<MeshData>& value);
+
+		template<class T>
+		void recordValue(const Vector<T>& value)
+		{
+			recordValue((UINT32)value.size());
+			for (auto& entry : value)
+				recordValue(entry);
+		}
+
+		template<class T>
+		void recordValue(const ResourceHandle<T>& value)
+		{
+			recordValue(value.getUUID());
+			recordValue(value.isLoaded());
+		}
+
+		template<class T>
+		void recordValue(const T& value)
+		{
+			static_assert(std::is_trivially_copyable<T>::value, "Only plain values can be recorded.");
+			recordBytes(&value, sizeof(value));
+		}
+
+		UINT64 mCommandsHash = HASH_SEED;
+		UnorderedMap<const Camera*, Entry> mEntries;
+		UINT64 mLastFrameIdx = 0;
+	};
+
+	/** @} */
+}
@@ -0,0 +1,269 @@
+//********************************** Banshee Engine (www.banshee3d.com) **************************************************//
+//**************** Copyright (c) 2019 Marko Pintera (marko.pintera@gmail.com). All rights reserved. **********************//
+#include "Utility/BsEditorProfiler.h"
+#include "CoreThread/BsCoreThread.h"
+#include "FileSystem/BsFileSystem.h"
+#include "FileSystem/BsDataStream.h"
+
+namespace bs
+{
+	/** Buffer of the current thread, and the profiler generation it was created for. */
+	static thread_local void* tlsThreadBuffer = nullptr;
+	static thread_local UINT32 tlsThreadBufferGeneration = 0;
+
+	/** Writes the provided string as a JSON string literal. */
+	static void writeJSONString(StringStream& output, const char* value)
+	{
+		output << '"';
+		for (const char* iter = value; *iter != '\0'; ++iter)
+		{
+			if (*iter == '"' || *iter == '\\')
+				output << '\\';
+
+			output << *iter;
+		}
+		output << '"';
+	}
+
+	std::atomic<bool> EditorProfiler::sEnabled{false};
+	std::atomic<UINT32> EditorProfiler::sGeneration{0};
+
+	EditorProfiler::EditorProfiler()
+		:mMainThreadId(BS_THREAD_CURRENT_ID)
+	{
+		// Invalidates any buffers cached by threads for a previous instance of the profiler
+		sGeneration++;
+	}
+
+	EditorProfiler::~EditorProfiler()
+	{
+		sEnabled = false;
+	}
+
+	void EditorProfiler::setEnabled(bool enabled)
+	{
+		sEnabled = enabled;
+	}
+
+	void EditorProfiler::beginFrame()
+	{
+		const UINT64 frameIdx = mFrameIdx.load(std::memory_order_relaxed) + 1;
+
+		mFrameStarts[frameIdx % FRAME_HISTORY] = getTime();
+		mFrameIdx.store(frameIdx, std::memory_order_relaxed);
+	}
+
+	UINT64 EditorProfiler::getFrameStart(UINT64 frameIdx) const
+	{
+		const UINT64 currentFrameIdx = getFrameIdx();
+		if (frameIdx > currentFrameIdx || currentFrameIdx - frameIdx >= FRAME_HISTORY)
+			return 0;
+
+		return mFrameStarts[frameIdx % FRAME_HISTORY];
+	}
+
+	Vector<EditorProfilerSample> EditorProfiler::getSamples(UINT64 firstFrame, UINT64 lastFrame) const
+	{
+		Vector<EditorProfilerSample> output;
+
+		Lock lock(mBuffersMutex);
+		for (auto& buffer : mBuffers)
+		{
+			ScopedSpinLock bufferLock(buffer->lock);
+
+			const UINT32 firstSample = (buffer->nextSample + SAMPLES_PER_THREAD - buffer->numSamples) % SAMPLES_PER_THREAD;
+			for (UINT32 i = 0; i < buffer->numSamples; i++)
+			{
+				const EditorProfilerSample& sample = buffer->samples[(firstSample + i) % SAMPLES_PER_THREAD];
+				if (sample.frameIdx >= firstFrame && sample.frameIdx <= lastFrame)
+					output.push_back(sample);
+			}
+		}
+
+		return output;
+	}
+
+	Vector<EditorProfilerAggregate> EditorProfiler::getAggregates(UINT32 numFrames) const
+	{
+		const UINT64 lastFrame = getFrameIdx();
+		const UINT64 firstFrame = lastFrame >= numFrames ? lastFrame - numFrames + 1 : 0;
+
+		Vector<EditorProfilerAggregate> output;
+		Map<std::pair<String, String>, UINT32> lookup;
+
+		for (auto& sample : getSamples(firstFrame, lastFrame))
+		{
+			const auto key = std::make_pair(String(sample.category), String(sample.name));
+
+			auto iterFind = lookup.find(key);
+			if (iterFind == lookup.end())
+			{
+				iterFind = lookup.insert(std::make_pair(key, (UINT32)output.size())).first;
+
+				EditorProfilerAggregate aggregate;
+				aggregate.category = key.first;
+				aggregate.name = key.second;
+				output.push_back(aggregate);
+			}
+
+			EditorProfilerAggregate& aggregate = output[iterFind->second];
+			aggregate.totalTime += sample.duration;
+			aggregate.maxTime = std::max(aggregate.maxTime, sample.duration);
+			aggregate.numSamples++;
+		}
+
+		std::sort(output.begin(), output.end(),
+			[](const EditorProfilerAggregate& a, const EditorProfilerAggregate& b)
+		{
+			return a.totalTime > b.totalTime;
+		});
+
+		return output;
+	}
+
+	Vector<String> EditorProfiler::getThreadNames() const
+	{
+		Lock lock(mBuffersMutex);
+
+		Vector<String> output;
+		output.reserve(mBuffers.size());
+
+		for (auto& buffer : mBuffers)
+			output.push_back(buffer->name);
+
+		return output;
+	}
+
+	String EditorProfiler::exportChromeTrace() const
+	{
+		const Vector<String> threadNames = getThreadNames();
+		const Vector<EditorProfilerSample> samples = getSamples(0, getFrameIdx());
+
+		StringStream output;
+		output << "{\"traceEvents\":[";
+
+		bool first = true;
+		for (UINT32 i = 0; i < (UINT32)threadNames.size(); i++)
+		{
+			output << (first ? "\n" : ",\n");
+			output << "{\"name\":\"thread_name\",\"ph\":\"M\",\"pid\":0,\"tid\":" << i << ",\"args\":{\"name\":";
+			writeJSONString(output, threadNames[i].c_str());
+			output << "}}";
+
+			first = false;
+		}
+
+		for (auto& sample : samples)
+		{
+			output << (first ? "\n" : ",\n");
+			output << "{\"name\":";
+			writeJSONString(output, sample.name);
+			output << ",\"cat\":";
+			writeJSONString(output, sample.category);
+			output << ",\"ph\":\"X\",\"ts\":" << sample.start << ",\"dur\":" << sample.duration;
+			output << ",\"pid\":0,\"tid\":" << sample.threadIdx << ",\"args\":{\"frame\":" << sample.frameIdx << "}}";
+
+			first = false;
+		}
+
+		output << "\n]}\n";
+		return output.str();
+	}
+
+	void EditorProfiler::exportChromeTrace(const Path& path) const
+	{
+		const String trace = exportChromeTrace();
+
+		SPtr<DataStream> stream = FileSystem::createAndOpenFile(path);
+		stream->write(trace.c_str(), trace.size() * sizeof(String::value_type));
+		stream->close();
+	}
+
+	void EditorProfiler::clear()
+	{
+		Lock lock(mBuffersMutex);
+		for (auto& buffer : mBuffers)
+		{
+			ScopedSpinLock bufferLock(buffer->lock);
+
+			buffer->nextSample = 0;
+			buffer->numSamples = 0;
+		}
+	}
+
+	void EditorProfiler::_beginSample()
+	{
+		getThreadBuffer().depth++;
+	}
+
+	void EditorProfiler::_endSample(const char* category, const char* name, UINT64 start, UINT64 frameIdx)
+	{
+		const UINT64 end = getTime();
+		ThreadBuffer& buffer = getThreadBuffer();
+
+		if (buffer.depth > 0)
+			buffer.depth--;
+
+		EditorProfilerSample sample;
+		sample.category = category;
+		sample.name = name;
+		sample.start = start;
+		sample.duration = end - start;
+		sample.frameIdx = frameIdx;
+		sample.threadIdx = buffer.threadIdx;
+		sample.depth = buffer.depth;
+
+		ScopedSpinLock lock(buffer.lock);
+		buffer.samples[buffer.nextSample] = sample;
+		buffer.nextSample = (buffer.nextSample + 1) % SAMPLES_PER_THREAD;
+		buffer.numSamples = std::min(buffer.numSamples + 1, SAMPLES_PER_THREAD);
+	}
+
+	EditorProfiler::ThreadBuffer& EditorProfiler::getThreadBuffer()
+	{
+		const UINT32 generation = sGeneration.load(std::memory_order_relaxed);
+		if (tlsThreadBuffer != nullptr && tlsThreadBufferGeneration == generation)
+			return *static_cast<ThreadBuffer*>(tlsThreadBuffer);
+
+		UPtr<ThreadBuffer> buffer = bs_unique_ptr_new<ThreadBuffer>();
+		buffer->threadId = BS_THREAD_CURRENT_ID;
+		buffer->samples.resize(SAMPLES_PER_THREAD);
+
+		Lock lock(mBuffersMutex);
+		if (buffer->threadId == mMainThreadId)
+			buffer->name = "Main";
+		else if (buffer->threadId == gCoreThread().getCoreThreadId())
+			buffer->name = "Core";
+		else
+			buffer->name = "Worker " + toString(mNumWorkerThreads++);
+
+		buffer->threadIdx = (UINT32)mBuffers.size();
+
+		tlsThreadBuffer = buffer.get();
+		tlsThreadBufferGeneration = generation;
+
+		mBuffers.push_back(std::move(buffer));
+		return *mBuffers.back();
+	}
+
+	void EditorProfilerScope::begin()
+	{
+		if (!EditorProfiler::isStarted())
+			return;
+
+		EditorProfiler& profiler = EditorProfiler::instance();
+		profiler._beginSample();
+
+		mFrameIdx = profiler.getFrameIdx();
+		mStart = profiler.getTime();
+		mActive = true;
+	}
+
+	void EditorProfilerScope::end()
+	{
+		if (!EditorProfiler::isStarted())
+			return;
+
+		EditorProfiler::instance()._endSample(mCategory, mName, mStart, mFrameIdx);
+	}
+}
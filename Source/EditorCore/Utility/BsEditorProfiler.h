@@ -0,0 +1,185 @@
+//********************************** Banshee Engine (www.banshee3d.com) **************************************************//
+//**************** Copyright (c) 2019 Marko Pintera (marko.pintera@gmail.com). All rights reserved. **********************//
+#pragma once
+
+#include "BsEditorPrerequisites.h"
+#include "Utility/BsModule.h"
+#include "Utility/BsTimer.h"
+#include "Threading/BsSpinLock.h"
+
+namespace bs
+{
+	/** @addtogroup Utility-Editor
+	 *  @{
+	 */
+
+	/** Timing of a single profiled scope, as recorded by EditorProfiler. */
+	struct EditorProfilerSample
+	{
+		const char* category; /**< Subsystem the scope belongs to. */
+		const char* name; /**< Name of the scope. */
+		UINT64 start; /**< Time at which the scope was entered, in microseconds since profiler start up. */
+		UINT64 duration; /**< Time spent in the scope, in microseconds. */
+		UINT64 frameIdx; /**< Index of the editor frame during which the scope was entered. */
+		UINT32 threadIdx; /**< Index of the thread the scope executed on, see EditorProfiler::getThreadNames(). */
+		UINT32 depth; /**< Number of profiled scopes the scope was nested in, on the same thread. */
+	};
+
+	/** Accumulated timings of all samples with the same category and name. */
+	struct EditorProfilerAggregate
+	{
+		String category;
+		String name;
+		UINT64 totalTime = 0; /**< Total time spent in the scope, in microseconds. */
+		UINT64 maxTime = 0; /**< Longest time spent in a single execution of the scope, in microseconds. */
+		UINT32 numSamples = 0;
+	};
+
+	/**
+	 * Records timings of scopes marked with BS_EDITOR_PROFILE_SCOPE, so it can be determined which editor subsystem is
+	 * responsible for slow frames. Each thread records into its own fixed size ring buffer, so older samples are
+	 * discarded as new ones are recorded. Recording is disabled by default, in which case the markers only cost a
+	 * single flag check.
+	 *
+	 * @note	Thread safe.
+	 */
+	class BS_ED_EXPORT EditorProfiler : public Module<EditorProfiler>
+	{
+		/** Samples recorded by a single thread. */
+		struct ThreadBuffer
+		{
+			String name;
+			ThreadId threadId;
+			UINT32 threadIdx = 0;
+			UINT32 depth = 0;
+
+			SpinLock lock;
+			Vector<EditorProfilerSample> samples;
+			UINT32 nextSample = 0;
+			UINT32 numSamples = 0;
+		};
+
+	public:
+		/** Maximum number of samples kept per thread. */
+		static constexpr UINT32 SAMPLES_PER_THREAD = 16384;
+
+		/** Number of past frames whose start times are remembered. */
+		static constexpr UINT32 FRAME_HISTORY = 256;
+
+		EditorProfiler();
+		~EditorProfiler();
+
+		/** Enables or disables recording of samples. Previously recorded samples are kept. */
+		void setEnabled(bool enabled);
+
+		/** Checks is the profiler currently recording samples. */
+		static bool isEnabled() { return sEnabled.load(std::memory_order_relaxed); }
+
+		/** Marks the start of a new editor frame. Must be called from the main thread. */
+		void beginFrame();
+
+		/** Returns the index of the current editor frame. */
+		UINT64 getFrameIdx() const { return mFrameIdx.load(std::memory_order_relaxed); }
+
+		/**
+		 * Returns the time at which the provided frame started, in microseconds since profiler start up. Only the last
+		 * FRAME_HISTORY frames are available, zero is returned for older frames.
+		 */
+		UINT64 getFrameStart(UINT64 frameIdx) const;
+
+		/** Returns the current time, in microseconds since profiler start up. */
+		UINT64 getTime() const { return mTimer.getMicroseconds(); }
+
+		/** Returns all the samples still in the buffers that were entered during the provided range of frames, inclusive. */
+		Vector<EditorProfilerSample> getSamples(UINT64 firstFrame, UINT64 lastFrame) const;
+
+		/** Returns timings accumulated per category and scope name, over the last @p numFrames frames. */
+		Vector<EditorProfilerAggregate> getAggregates(UINT32 numFrames) const;
+
+		/** Returns names of all the threads that recorded samples, indexed by EditorProfilerSample::threadIdx. */
+		Vector<String> getThreadNames() const;
+
+		/**
+		 * Outputs all the samples still in the buffers in the Chrome trace event format. The output can be viewed in
+		 * chrome://tracing or any other viewer supporting the format.
+		 */
+		String exportChromeTrace() const;
+
+		/** Writes the output of exportChromeTrace() to the provided file. */
+		void exportChromeTrace(const Path& path) const;
+
+		/** Removes all recorded samples. */
+		void clear();
+
+		/** @name Internal
+		 *  @{
+		 */
+
+		/** Called when a profiled scope is entered on the current thread. */
+		void _beginSample();
+
+		/** Called when a profiled scope entered at @p start is exited on the current thread. */
+		void _endSample(const char* category, const char* name, UINT64 start, UINT64 frameIdx);
+
+		/** @} */
+	private:
+		/** Returns the buffer of the calling thread, creating it if the thread has not recorded samples before. */
+		ThreadBuffer& getThreadBuffer();
+
+		static std::atomic<bool> sEnabled;
+		static std::atomic<UINT32> sGeneration;
+
+		Timer mTimer;
+		ThreadId mMainThreadId;
+		std::atomic<UINT64> mFrameIdx{0};
+		UINT64 mFrameStarts[FRAME_HISTORY] = {};
+
+		mutable Mutex mBuffersMutex;
+		Vector<UPtr<ThreadBuffer>> mBuffers;
+		UINT32 mNumWorkerThreads = 0;
+	};
+
+	/**
+	 * Records the time spent between construction and destruction as a single EditorProfiler sample. Does nothing if the
+	 * profiler is not enabled at the time of construction. Category and name must be string literals, as only the
+	 * pointers are stored.
+	 */
+	class BS_ED_EXPORT EditorProfilerScope
+	{
+	public:
+		EditorProfilerScope(const char* category, const char* name)
+			:mCategory(category), mName(name)
+		{
+			if (EditorProfiler::isEnabled())
+				begin();
+		}
+
+		~EditorProfilerScope()
+		{
+			if (mActive)
+				end();
+		}
+
+		EditorProfilerScope(const EditorProfilerScope&) = delete;
+		EditorProfilerScope& operator=(const EditorProfilerScope&) = delete;
+
+	private:
+		void begin();
+		void end();
+
+		const char* mCategory;
+		const char* mName;
+		UINT64 mStart = 0;
+		UINT64 mFrameIdx = 0;
+		bool mActive = false;
+	};
+
+#define BS_EDITOR_PROFILE_CONCAT_INNER(a, b) a##b
+#define BS_EDITOR_PROFILE_CONCAT(a, b) BS_EDITOR_PROFILE_CONCAT_INNER(a, b)
+
+	/** Profiles the remainder of the enclosing scope using EditorProfiler. */
+#define BS_EDITOR_PROFILE_SCOPE(category, name)															\
+	bs::EditorProfilerScope BS_EDITOR_PROFILE_CONCAT(_editorProfilerScope, __LINE__)(category, name)
+
+	/** @} */
+}
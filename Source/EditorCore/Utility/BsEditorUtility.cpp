@@ -3,6 +3,8 @@
 #include "Utility/BsEditorUtility.h"
 #include "Scene/BsSceneObject.h"
 #include "Components/BsCRenderable.h"
+#include "Serialization/BsMemorySerializer.h"
+#include "Reflection/BsRTTIType.h"
 
 namespace bs
 {
@@ -211,4 +213,162 @@ namespace bs
 			}
 		}
 	}
-}
\ No newline at end of file
+
+	Vector<HSceneObject> EditorUtility::cloneSceneObjects(const Vector<HSceneObject>& objects, const HSceneObject& parent,
+		bool keepWorldTransform, bool remapReferences)
+	{
+		/** Serialized data of a single object to clone. */
+		struct EncodedObject
+		{
+			UINT8* data;
+			UINT32 size;
+			Transform worldTransform;
+			bool ownContext;
+		};
+
+		const auto createContext = []()
+		{
+			CoreSerializationContext context;
+			context.goState = bs_shared_ptr_new<GameObjectDeserializationState>(
+				GODM_UseNewIds | GODM_UseNewUUID | GODM_RestoreExternal);
+
+			return context;
+		};
+
+		Vector<HSceneObject> clones;
+		clones.reserve(objects.size());
+
+		UnorderedSet<UINT64> objectIds;
+		for (auto& object : objects)
+		{
+			if (!object.isDestroyed())
+				objectIds.insert(object->getInstanceId());
+		}
+
+		bs_frame_mark();
+		{
+			FrameVector<EncodedObject> encodedObjects;
+			encodedObjects.reserve(objects.size());
+
+			// All objects are encoded into the frame allocator, released in one go once the clones are created
+			const auto frameAllocator = [](UINT32 size) { return (void*)bs_frame_alloc(size); };
+
+			MemorySerializer serializer;
+			for (auto& object : objects)
+			{
+				if (object.isDestroyed())
+					continue;
+
+				EncodedObject encoded;
+				encoded.worldTransform = object->getTransform();
+
+				// Unless references between the objects are remapped, each object is decoded using its own context so
+				// its references are resolved as if it was cloned on its own. Objects that are descendants of other
+				// objects in the list always get their own context, as otherwise the shared context would encounter the
+				// same instance IDs twice.
+				encoded.ownContext = !remapReferences;
+				for (HSceneObject ancestor = object->getParent(); !encoded.ownContext && ancestor != nullptr; 
+					ancestor = ancestor->getParent())
+				{
+					if (objectIds.find(ancestor->getInstanceId()) != objectIds.end())
+					{
+						encoded.ownContext = true;
+						break;
+					}
+				}
+
+				// Clones get instantiated manually, once they have been attached to their parents
+				const bool isInstantiated = !object->hasFlag(SOF_DontInstantiate);
+				object->_setFlags(SOF_DontInstantiate);
+
+				encoded.data = serializer.encode(object.get(), encoded.size, frameAllocator);
+
+				if (isInstantiated)
+					object->_unsetFlags(SOF_DontInstantiate);
+
+				encodedObjects.push_back(encoded);
+			}
+
+			CoreSerializationContext sharedContext = createContext();
+			for (auto& encoded : encodedObjects)
+			{
+				SPtr<SceneObject> clone;
+				if (encoded.ownContext)
+				{
+					CoreSerializationContext context = createContext();
+					clone = std::static_pointer_cast<SceneObject>(serializer.decode(encoded.data, encoded.size, &context));
+				}
+				else
+				{
+					clone = std::static_pointer_cast<SceneObject>(
+						serializer.decode(encoded.data, encoded.size, &sharedContext));
+				}
+
+				clones.push_back(clone->getHandle());
+			}
+
+			// Attach all the clones before instantiating them, so their transforms are only updated once
+			for (UINT32 i = 0; i < (UINT32)clones.size(); i++)
+			{
+				const HSceneObject& clone = clones[i];
+				if (parent != nullptr)
+					clone->setParent(parent, false);
+
+				if (keepWorldTransform)
+				{
+					const Transform& tfrm = encodedObjects[i].worldTransform;
+					clone->setWorldPosition(tfrm.getPosition());
+					clone->setWorldRotation(tfrm.getRotation());
+					clone->setWorldScale(tfrm.getScale());
+				}
+			}
+
+			for (auto& clone : clones)
+				clone->_instantiate();
+		}
+		bs_frame_clear();
+
+		return clones;
+	}
+
+	void EditorUtility::removeDescendants(Vector<HSceneObject>& objects)
+	{
+		UnorderedSet<UINT64> objectIds;
+		for (auto& object : objects)
+		{
+			if (!object.isDestroyed())
+				objectIds.insert(object->getInstanceId());
+		}
+
+		// Each object only needs its ancestors checked against the set, rather than being compared with every other
+		// object in the list
+		UnorderedSet<UINT64> addedIds;
+		UINT32 numKept = 0;
+		for (UINT32 i = 0; i < (UINT32)objects.size(); i++)
+		{
+			const HSceneObject& object = objects[i];
+			if (object.isDestroyed())
+				continue;
+
+			bool hasSelectedAncestor = false;
+			for (HSceneObject ancestor = object->getParent(); ancestor != nullptr; ancestor = ancestor->getParent())
+			{
+				if (objectIds.find(ancestor->getInstanceId()) != objectIds.end())
+				{
+					hasSelectedAncestor = true;
+					break;
+				}
+			}
+
+			if (hasSelectedAncestor || !addedIds.insert(object->getInstanceId()).second)
+				continue;
+
+			if (numKept != i)
+				objects[numKept] = object;
+
+			numKept++;
+		}
+
+		objects.resize(numKept);
+	}
+}
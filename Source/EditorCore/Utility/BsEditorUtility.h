@@ -72,6 +72,31 @@ namespace bs
 		 */
 		static void restoreIds(const HSceneObject& restored, SceneObjProxy& proxy);
 
+		/**
+		 * Clones multiple scene objects in a single batch. All the objects are serialized into one shared buffer, which
+		 * is considerably faster than calling SceneObject::clone() on each object separately. Clones are instantiated
+		 * only after they have been attached to their parent.
+		 *
+		 * @param[in]	objects				Objects to clone. Destroyed objects are ignored.
+		 * @param[in]	parent				Parent to attach the clones to. If null the clones are attached to the scene
+		 *									root.
+		 * @param[in]	keepWorldTransform	If true the clones will have the same world transform as their originals,
+		 *									otherwise they keep the local transform of their originals.
+		 * @param[in]	remapReferences		If false each object is cloned as if on its own, and references from one
+		 *									object in @p objects to another keep pointing to the original. If true all
+		 *									the objects are deserialized using a shared context, and such references
+		 *									are remapped to point to the clone of the referenced object instead.
+		 * @return							Clones, in the same order as the non-destroyed objects in @p objects.
+		 */
+		static Vector<HSceneObject> cloneSceneObjects(const Vector<HSceneObject>& objects,
+			const HSceneObject& parent = HSceneObject(), bool keepWorldTransform = false, bool remapReferences = false);
+
+		/**
+		 * Removes objects that are descendants of other objects in the provided list. Duplicate entries and destroyed
+		 * objects are removed as well. Order of the remaining objects is preserved.
+		 */
+		static void removeDescendants(Vector<HSceneObject>& objects);
+
 		/**
 		 * Displays a platform specific file/folder open/save dialog.
 		 *
@@ -247,8 +247,13 @@ namespace bs.Editor
         public virtual InspectableState Refresh(bool force)
         {
             InspectableState state = InspectableState.NotModified;
-            for (int i = 0; i < rows.Count; i++)
-                state |= rows[i].Refresh(force);
+
+            // Rows of a collapsed dictionary cannot be interacted with, they are refreshed once it is expanded again
+            if (isExpanded || force)
+            {
+                for (int i = 0; i < rows.Count; i++)
+                    state |= rows[i].Refresh(force);
+            }
 
             if (editRow != null && editRow.Enabled)
                 state |= editRow.Refresh(force);
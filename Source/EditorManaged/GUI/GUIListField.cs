@@ -13,11 +13,21 @@ namespace bs.Editor
 
     /// <summary>
     /// Base class for objects that display GUI for a modifyable list of elements. Elements can be added, removed and moved.
+    /// Large lists are split into pages, and GUI rows are only created for elements on the currently displayed page.
     /// </summary>
     public abstract class GUIListFieldBase
     {
         private const int IndentAmount = 5;
 
+        /// <summary>
+        /// Maximum number of elements displayed at once. Lists with more elements display page controls.
+        /// </summary>
+        public const int RowsPerPage = 50;
+
+        /// <summary>
+        /// Rows for the elements on the current page. Element displayed by row at index <c>i</c> is at index
+        /// <c>FirstVisibleIndex + i</c> in the list.
+        /// </summary>
         protected List<GUIListFieldRow> rows = new List<GUIListFieldRow>();
         protected GUILayoutY guiLayout;
         protected GUIIntField guiSizeField;
@@ -26,6 +36,8 @@ namespace bs.Editor
         protected GUILayoutX guiInternalTitleLayout;
         protected GUILayoutY guiContentLayout;
         protected GUIToggle guiFoldout;
+        protected GUILayoutX guiPageLayout;
+        protected GUILabel guiPageLabel;
 
         protected bool isExpanded;
         protected int depth;
@@ -33,6 +45,7 @@ namespace bs.Editor
 
         private State state;
         private bool isModified;
+        private int page;
 
         /// <summary>
         /// Expands or collapses the entries of the dictionary.
@@ -47,6 +60,38 @@ namespace bs.Editor
             }
         }
 
+        /// <summary>
+        /// Index of the page of elements currently displayed. Pages contain <see cref="RowsPerPage"/> elements each.
+        /// </summary>
+        public int Page
+        {
+            get { return page; }
+            set
+            {
+                if (page == value)
+                    return;
+
+                page = value;
+                BuildGUI();
+            }
+        }
+
+        /// <summary>
+        /// Returns the number of pages required to display all the elements.
+        /// </summary>
+        public int NumPages
+        {
+            get { return MathEx.Max(1, (GetNumRows() + RowsPerPage - 1) / RowsPerPage); }
+        }
+
+        /// <summary>
+        /// Sequential index of the element displayed by the first row on the current page.
+        /// </summary>
+        protected int FirstVisibleIndex
+        {
+            get { return page * RowsPerPage; }
+        }
+
         /// <summary>
         /// Event that triggers when the list foldout is expanded or collapsed (rows are shown or hidden).
         /// </summary>
@@ -70,6 +115,7 @@ namespace bs.Editor
 
         /// <summary>
         /// (Re)builds the list GUI elements. Must be called at least once in order for the contents to be populated.
+        /// Only the elements on the current page receive GUI rows.
         /// </summary>
         public void BuildGUI(bool force = false)
         {
@@ -77,28 +123,38 @@ namespace bs.Editor
 
             if (!IsNull())
             {
-                // Hidden dependency: Initialize must be called after all elements are 
-                // in the dictionary so we do it in two steps
                 int numRows = GetNumRows();
-                int oldNumRows = rows.Count;
+                page = MathEx.Clamp(page, 0, NumPages - 1);
+
+                int firstIndex = FirstVisibleIndex;
+                int numVisibleRows = MathEx.Clamp(numRows - firstIndex, 0, RowsPerPage);
+                int oldNumVisibleRows = rows.Count;
 
-                for (int i = oldNumRows; i < numRows; i++)
+                // Hidden dependency: Initialize must be called after all elements are 
+                // in the dictionary so we do it in two steps
+                for (int i = oldNumVisibleRows; i < numVisibleRows; i++)
                 {
                     GUIListFieldRow newRow = CreateRow();
                     rows.Add(newRow);
                 }
 
-                for (int i = oldNumRows - 1; i >= numRows; i--)
+                for (int i = oldNumVisibleRows - 1; i >= numVisibleRows; i--)
                 {
                     rows[i].Destroy();
                     rows.RemoveAt(i);
                 }
 
-                for (int i = oldNumRows; i < numRows; i++)
-                    rows[i].Initialize(this, guiContentLayout, i, depth + 1);
+                for (int i = oldNumVisibleRows; i < numVisibleRows; i++)
+                    rows[i].Initialize(this, guiContentLayout, firstIndex + i, depth + 1);
 
-                for (int i = 0; i < rows.Count; i++)
-                    rows[i].SetIndex(i);
+                // Rows that now display a different element due to a page change need their GUI rebuilt
+                for (int i = 0; i < MathEx.Min(oldNumVisibleRows, numVisibleRows); i++)
+                {
+                    if (rows[i].SetIndex(firstIndex + i))
+                        rows[i].BuildGUI();
+                }
+
+                UpdatePageGUI();
 
                 if(force)
                     guiSizeField.Value = numRows;
@@ -109,6 +165,48 @@ namespace bs.Editor
                     row.Destroy();
 
                 rows.Clear();
+                page = 0;
+            }
+        }
+
+        /// <summary>
+        /// Returns the row displaying the element at the specified index, switching to the page containing the element if
+        /// it is not currently displayed.
+        /// </summary>
+        /// <param name="seqIndex">Sequential index of the element.</param>
+        /// <returns>Row displaying the element, or null if the index is out of range.</returns>
+        protected GUIListFieldRow GetRowForIndex(int seqIndex)
+        {
+            if (seqIndex < 0 || seqIndex >= GetNumRows())
+                return null;
+
+            Page = seqIndex / RowsPerPage;
+
+            int rowIdx = seqIndex - FirstVisibleIndex;
+            if (rowIdx < 0 || rowIdx >= rows.Count)
+                return null;
+
+            return rows[rowIdx];
+        }
+
+        /// <summary>
+        /// Updates the page controls to reflect the current page and the number of elements.
+        /// </summary>
+        private void UpdatePageGUI()
+        {
+            if (guiPageLayout == null)
+                return;
+
+            int numPages = NumPages;
+            guiPageLayout.Active = numPages > 1;
+
+            if (numPages > 1)
+            {
+                int firstIndex = FirstVisibleIndex;
+                int lastIndex = MathEx.Min(firstIndex + RowsPerPage, GetNumRows()) - 1;
+
+                guiPageLabel.SetContent(new LocEdString(firstIndex + " - " + lastIndex + " (" + (page + 1) + "/" + 
+                    numPages + ")"));
             }
         }
 
@@ -170,6 +268,28 @@ namespace bs.Editor
                 GUILayoutY guiIndentLayoutY = guiIndentLayoutX.AddLayoutY();
                 guiIndentLayoutY.AddSpace(IndentAmount);
                 guiContentLayout = guiIndentLayoutY.AddLayoutY();
+
+                guiPageLayout = guiIndentLayoutY.AddLayoutX();
+                GUIButton guiFirstPageBtn = new GUIButton(new LocEdString("<<"), GUIOption.FixedWidth(30));
+                GUIButton guiPrevPageBtn = new GUIButton(new LocEdString("<"), GUIOption.FixedWidth(30));
+                GUIButton guiNextPageBtn = new GUIButton(new LocEdString(">"), GUIOption.FixedWidth(30));
+                GUIButton guiLastPageBtn = new GUIButton(new LocEdString(">>"), GUIOption.FixedWidth(30));
+                guiPageLabel = new GUILabel("");
+
+                guiFirstPageBtn.OnClick += () => Page = 0;
+                guiPrevPageBtn.OnClick += () => Page = MathEx.Max(0, page - 1);
+                guiNextPageBtn.OnClick += () => Page = MathEx.Min(NumPages - 1, page + 1);
+                guiLastPageBtn.OnClick += () => Page = NumPages - 1;
+
+                guiPageLayout.AddElement(guiFirstPageBtn);
+                guiPageLayout.AddElement(guiPrevPageBtn);
+                guiPageLayout.AddFlexibleSpace();
+                guiPageLayout.AddElement(guiPageLabel);
+                guiPageLayout.AddFlexibleSpace();
+                guiPageLayout.AddElement(guiNextPageBtn);
+                guiPageLayout.AddElement(guiLastPageBtn);
+                guiPageLayout.Active = false;
+
                 guiIndentLayoutY.AddSpace(IndentAmount);
                 guiIndentLayoutX.AddSpace(IndentAmount);
                 guiChildLayout.AddSpace(IndentAmount);
@@ -213,6 +333,8 @@ namespace bs.Editor
                 {
                     guiInternalTitleLayout.Destroy();
                     guiChildLayout.Destroy();
+                    guiPageLayout = null;
+                    guiPageLabel = null;
                     BuildEmptyGUI();
 
                     state = State.Empty;
@@ -230,7 +352,7 @@ namespace bs.Editor
         }
 
         /// <summary>
-        /// Refreshes contents of all list rows and checks if anything was modified.
+        /// Refreshes contents of all visible list rows and checks if anything was modified.
         /// </summary>
         /// <param name="force">Forces the GUI fields to display the latest values assigned on the object.</param>
         /// <returns>State representing was anything modified between two last calls to <see cref="Refresh"/>.</returns>
@@ -238,8 +360,12 @@ namespace bs.Editor
         {
             InspectableState state = InspectableState.NotModified;
 
-            for (int i = 0; i < rows.Count; i++)
-                state |= rows[i].Refresh(force);
+            // Rows of a collapsed list cannot be interacted with, they are refreshed once the list is expanded again
+            if (isExpanded || force)
+            {
+                for (int i = 0; i < rows.Count; i++)
+                    state |= rows[i].Refresh(force);
+            }
 
             if (isModified)
             {
@@ -265,6 +391,8 @@ namespace bs.Editor
             {
                 guiChildLayout.Destroy();
                 guiChildLayout = null;
+                guiPageLayout = null;
+                guiPageLabel = null;
             }
 
             for (int i = 0; i < rows.Count; i++)
@@ -920,9 +1048,14 @@ namespace bs.Editor
         /// Changes the index of the list element this row represents.
         /// </summary>
         /// <param name="seqIndex">Sequential index of the list entry.</param>
-        internal void SetIndex(int seqIndex)
+        /// <returns>True if the index changed, false otherwise.</returns>
+        internal bool SetIndex(int seqIndex)
         {
+            if (this.seqIndex == seqIndex)
+                return false;
+
             this.seqIndex = seqIndex;
+            return true;
         }
 
         /// <summary>
@@ -237,7 +237,6 @@ namespace bs.Editor
         internal static VirtualButton DuplicateKey = new VirtualButton(DuplicateBinding);
         internal static VirtualButton DeleteKey = new VirtualButton(DeleteBinding);
 
-        private static FolderMonitor monitor;
         private static ScriptCodeManager codeManager;
         private static RRef<Prefab> lastLoadedScene;
         private static bool sceneDirty;
@@ -326,12 +325,7 @@ namespace bs.Editor
             inputConfig.RegisterButton(RenameBinding, ButtonCode.F2);
 
             if (IsProjectLoaded)
-            {
-                monitor = new FolderMonitor(ProjectLibrary.ResourceFolder);
-                monitor.OnAdded += OnAssetModified;
-                monitor.OnRemoved += OnAssetModified;
-                monitor.OnModified += OnAssetModified;
-            }
+                ProjectLibrary.StartMonitor();
         }
 
         /// <summary>
@@ -374,15 +368,6 @@ namespace bs.Editor
                 EditorSceneData = EditorSceneData.FromScene(Scene.Root);
         }
 
-        /// <summary>
-        /// Triggered when the folder monitor detects an asset in the monitored folder was modified.
-        /// </summary>
-        /// <param name="path">Path to the modified file or folder.</param>
-        private static void OnAssetModified(string path)
-        {
-            ProjectLibrary.Refresh(path);
-        }
-
         /// <summary>
         /// Called every frame by the runtime.
         /// </summary>
@@ -887,12 +872,7 @@ namespace bs.Editor
         private static void UnloadProject()
         {
             Scene.Clear();
-
-            if (monitor != null)
-            {
-                monitor.Destroy();
-                monitor = null;
-            }
+            ProjectLibrary.StopMonitor();
 
             LibraryWindow window = EditorWindow.GetWindow<LibraryWindow>();
             if (window != null)
@@ -1053,17 +1033,7 @@ namespace bs.Editor
             EditorSettings.Save();
 
             ProjectLibrary.Refresh();
-
-            if(monitor != null)
-            {
-                monitor.Destroy();
-                monitor = null;
-            }
-
-            monitor = new FolderMonitor(ProjectLibrary.ResourceFolder);
-            monitor.OnAdded += OnAssetModified;
-            monitor.OnRemoved += OnAssetModified;
-            monitor.OnModified += OnAssetModified;
+            ProjectLibrary.StartMonitor();
 
             if (!string.IsNullOrWhiteSpace(ProjectSettings.LastOpenScene))
             {
@@ -20,9 +20,6 @@ namespace bs.Editor
         [SerializeField]
         internal Dictionary<UUID, EditorAnimClipInfo> dirtyAnimClips = new Dictionary<UUID, EditorAnimClipInfo>();
 
-        [SerializeField]
-        internal long lastCompileTime;
-
         [SerializeField]
         internal EditorSceneData editorSceneData;
     }
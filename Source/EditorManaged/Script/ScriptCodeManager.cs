@@ -20,9 +20,14 @@ namespace bs.Editor
     {
         private const int CompilerLogCategory = 100;
 
+        private static readonly Regex CompilerErrorRegex = new Regex(@"Compiler error: (.*)\n\tin (.*)\[(.*):.*\]");
+        private static readonly Regex CompilerWarningRegex = new Regex(@"Compiler warning: (.*)\n\tin (.*)\[(.*):.*\]");
+
         private bool isGameAssemblyDirty;
         private bool isEditorAssemblyDirty;
         private CompilerInstance compilerInstance;
+        private ScriptAssemblyType compilingType;
+        private bool clearMessagesOnDone;
 
         /// <summary>
         /// Constructs a new script code manager.
@@ -34,45 +39,14 @@ namespace bs.Editor
             ProjectLibrary.OnEntryImported += OnEntryImported;
 
             // Check for missing or out of date assemblies
-            DateTime lastModifiedGameScript = DateTime.MinValue;
-            DateTime lastModifiedEditorScript = DateTime.MinValue;
-
-            LibraryEntry[] scriptEntries = ProjectLibrary.Search("*.cs", new ResourceType[] { ResourceType.ScriptCode });
-            for (int i = 0; i < scriptEntries.Length; i++)
-            {
-                if(scriptEntries[i].Type != LibraryEntryType.File)
-                    continue;
-
-                FileEntry fileEntry = (FileEntry)scriptEntries[i];
-
-                string absPath = Path.Combine(ProjectLibrary.ResourceFolder, fileEntry.Path);
-                ScriptCodeImportOptions io = (ScriptCodeImportOptions) fileEntry.Options;
-                if (io.EditorScript)
-                    lastModifiedEditorScript = File.GetLastWriteTime(absPath);
-                else
-                    lastModifiedGameScript = File.GetLastWriteTime(absPath);
-            }
-
-            DateTime lastCompileTime = new DateTime(EditorApplication.PersistentData.lastCompileTime);
-            if (lastModifiedGameScript != DateTime.MinValue)
-            {
-                string gameAssemblyPath = Path.Combine(EditorApplication.ScriptAssemblyPath,
-                    EditorApplication.ScriptGameAssemblyName);
-
-                isGameAssemblyDirty = (!File.Exists(gameAssemblyPath) || 
-                                      File.GetLastWriteTime(gameAssemblyPath) < lastModifiedGameScript) && 
-                                      (lastModifiedGameScript > lastCompileTime);
-            }
-
-            if (lastModifiedEditorScript != DateTime.MinValue)
-            {
-                string editorAssemblyPath = Path.Combine(EditorApplication.ScriptAssemblyPath,
-                    EditorApplication.ScriptEditorAssemblyName);
-
-                isEditorAssemblyDirty = (!File.Exists(editorAssemblyPath) || 
-                                         File.GetLastWriteTime(editorAssemblyPath) < lastModifiedEditorScript) && 
-                                        (lastModifiedEditorScript > lastCompileTime);
-            }
+            string outputDir = EditorApplication.ScriptAssemblyPath;
+            isGameAssemblyDirty = !ScriptCompiler.IsUpToDate(ScriptAssemblyType.Game, BuildManager.ActivePlatform, true,
+                outputDir);
+
+            // Note: If the game assembly is dirty this is checked again once it compiles, as its public interface
+            // might change
+            isEditorAssemblyDirty = !ScriptCompiler.IsUpToDate(ScriptAssemblyType.Editor, BuildManager.ActivePlatform,
+                true, outputDir);
         }
 
         /// <summary>
@@ -89,39 +63,29 @@ namespace bs.Editor
                 {
                     if (EditorApplication.HasFocus)
                     {
-                        string outputDir = EditorApplication.ScriptAssemblyPath;
-
                         if (isGameAssemblyDirty)
-                        {
-                            compilerInstance = ScriptCompiler.CompileAsync(
-                                ScriptAssemblyType.Game, BuildManager.ActivePlatform, true, outputDir);
-
-                            EditorApplication.SetStatusCompiling(true);
-                            EditorApplication.PersistentData.lastCompileTime = DateTime.Now.Ticks;
-                            isGameAssemblyDirty = false;
-                        }
+                            StartCompile(ScriptAssemblyType.Game, true);
                         else if (isEditorAssemblyDirty)
-                        {
-                            compilerInstance = ScriptCompiler.CompileAsync(
-                                ScriptAssemblyType.Editor, BuildManager.ActivePlatform, true, outputDir);
-
-                            EditorApplication.SetStatusCompiling(true);
-                            EditorApplication.PersistentData.lastCompileTime = DateTime.Now.Ticks;
-                            isEditorAssemblyDirty = false;
-                        }
+                            StartCompile(ScriptAssemblyType.Editor, true);
                     }
                 }
                 else
                 {
                     if (compilerInstance.IsDone)
                     {
-                        Debug.Clear(LogVerbosity.Any, CompilerLogCategory);
+                        // Only clear the messages once per reload, so that warnings reported by the game assembly
+                        // compilation remain visible while compiling the editor assembly
+                        if (clearMessagesOnDone)
+                        {
+                            Debug.Clear(LogVerbosity.Any, CompilerLogCategory);
 
-                        LogWindow window = EditorWindow.GetWindow<LogWindow>();
-                        if (window != null)
-                            window.Refresh();
+                            LogWindow window = EditorWindow.GetWindow<LogWindow>();
+                            if (window != null)
+                                window.Refresh();
+                        }
 
-                        if (compilerInstance.HasErrors)
+                        bool hasErrors = compilerInstance.HasErrors;
+                        if (hasErrors)
                         {
                             foreach (var msg in compilerInstance.WarningMessages)
                                 Debug.LogMessage(FormMessage(msg), LogVerbosity.Warning, CompilerLogCategory);
@@ -133,6 +97,20 @@ namespace bs.Editor
                         compilerInstance.Dispose();
                         compilerInstance = null;
 
+                        // Editor scripts depend on the public interface of the game assembly. If it changed compile them
+                        // right away, so both assemblies are picked up by a single reload.
+                        if (!hasErrors && compilingType == ScriptAssemblyType.Game)
+                        {
+                            isEditorAssemblyDirty |= !ScriptCompiler.IsUpToDate(ScriptAssemblyType.Editor,
+                                BuildManager.ActivePlatform, true, EditorApplication.ScriptAssemblyPath);
+
+                            if (isEditorAssemblyDirty)
+                            {
+                                StartCompile(ScriptAssemblyType.Editor, false);
+                                return;
+                            }
+                        }
+
                         EditorApplication.SetStatusCompiling(false);
                         EditorApplication.ReloadAssemblies();
                     }
@@ -140,6 +118,28 @@ namespace bs.Editor
             }
         }
 
+        /// <summary>
+        /// Starts compilation of the specified script assembly.
+        /// </summary>
+        /// <param name="type">Type of the assembly to compile.</param>
+        /// <param name="clearMessages">Determines should existing compiler messages be cleared once the compilation
+        ///                             finishes.</param>
+        private void StartCompile(ScriptAssemblyType type, bool clearMessages)
+        {
+            compilerInstance = ScriptCompiler.CompileAsync(type, BuildManager.ActivePlatform, true,
+                EditorApplication.ScriptAssemblyPath);
+
+            compilingType = type;
+            clearMessagesOnDone = clearMessages;
+
+            EditorApplication.SetStatusCompiling(true);
+
+            if (type == ScriptAssemblyType.Game)
+                isGameAssemblyDirty = false;
+            else
+                isEditorAssemblyDirty = false;
+        }
+
         /// <summary>
         /// Triggered when a new resource is added to the project library.
         /// </summary>
@@ -252,15 +252,11 @@ namespace bs.Editor
             // Note: If modifying FormMessage method make sure to update this one as well to match the formattting
 
             // Check for error
-            Regex regex = new Regex(@"Compiler error: (.*)\n\tin (.*)\[(.*):.*\]");
-            var match = regex.Match(message);
+            var match = CompilerErrorRegex.Match(message);
 
             // Check for warning
             if (!match.Success)
-            {
-                regex = new Regex(@"Compiler warning: (.*)\n\tin (.*)\[(.*):.*\]");
-                match = regex.Match(message);
-            }
+                match = CompilerWarningRegex.Match(message);
 
             // No match
             if (!match.Success)
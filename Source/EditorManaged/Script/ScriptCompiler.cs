@@ -4,6 +4,8 @@ using System;
 using System.Collections.Generic;
 using System.Diagnostics;
 using System.IO;
+using System.Reflection;
+using System.Security.Cryptography;
 using System.Text;
 using System.Text.RegularExpressions;
 using System.Threading;
@@ -37,6 +39,12 @@ namespace bs.Editor
     /// </summary>
     public static class ScriptCompiler
     {
+        /// <summary>
+        /// Extension of the file written next to a compiled assembly, containing the hash of the inputs it was compiled
+        /// from.
+        /// </summary>
+        private const string InputHashExtension = ".inputhash";
+
         /// <summary>
         /// Starts compilation of the script files in the project for the specified assembly for the specified platform.
         /// </summary>
@@ -47,6 +55,58 @@ namespace bs.Editor
         /// <returns>Compiler instance that contains the compiler process. Caller must ensure to properly dispose
         ///          of this object when done.</returns>
         public static CompilerInstance CompileAsync(ScriptAssemblyType type, PlatformType platform, bool debug, string outputDir)
+        {
+            AssemblyInputs inputs = GetInputs(type, platform, debug, outputDir);
+            string inputHash = CalculateInputHash(inputs);
+
+            return new CompilerInstance(inputs.files, inputs.defines, inputs.assemblyFolders, inputs.assemblies, debug,
+                inputs.outputFile, inputHash);
+        }
+
+        /// <summary>
+        /// Checks does the assembly need to be recompiled. An assembly is considered up to date if it was previously
+        /// successfully compiled from the same set of script files, defines and referenced assemblies. For the editor
+        /// assembly only the public types and members of the referenced game assembly are considered, so changes to the
+        /// game assembly's implementation do not require the editor assembly to be recompiled.
+        /// </summary>
+        /// <param name="type">Type of the assembly to check.</param>
+        /// <param name="platform">Platform the assembly is compiled for.</param>
+        /// <param name="debug">Determines is the assembly compiled with debug information.</param>
+        /// <param name="outputDir">Absolute path to the directory containing the compiled assemblies.</param>
+        /// <returns>True if the assembly doesn't need to be compiled, false otherwise. Returns true if there are no
+        ///          script files to compile.</returns>
+        public static bool IsUpToDate(ScriptAssemblyType type, PlatformType platform, bool debug, string outputDir)
+        {
+            AssemblyInputs inputs = GetInputs(type, platform, debug, outputDir);
+            if (inputs.files.Length == 0)
+                return true;
+
+            string hashFile = GetInputHashFile(inputs.outputFile);
+            if (!File.Exists(inputs.outputFile) || !File.Exists(hashFile))
+                return false;
+
+            return File.ReadAllText(hashFile) == CalculateInputHash(inputs);
+        }
+
+        /// <summary>
+        /// Returns the absolute path to the file in which the input hash for the provided assembly is stored.
+        /// </summary>
+        /// <param name="outputFile">Absolute path to the assembly.</param>
+        /// <returns>Absolute path to the input hash file.</returns>
+        internal static string GetInputHashFile(string outputFile)
+        {
+            return outputFile + InputHashExtension;
+        }
+
+        /// <summary>
+        /// Gathers all the information required for compiling the specified assembly.
+        /// </summary>
+        /// <param name="type">Type of the assembly to compile. This determines which script files are used as input.</param>
+        /// <param name="platform">Platform to compile the assemblies for.</param>
+        /// <param name="debug">Determines should the assemblies contain debug information.</param>
+        /// <param name="outputDir">Absolute path to the directory where to output the assemblies.</param>
+        /// <returns>Inputs required for compiling the assembly.</returns>
+        private static AssemblyInputs GetInputs(ScriptAssemblyType type, PlatformType platform, bool debug, string outputDir)
         {
             LibraryEntry[] scriptEntries = ProjectLibrary.Search("*", new ResourceType[] { ResourceType.ScriptCode });
 
@@ -66,9 +126,11 @@ namespace bs.Editor
                 }
             }
 
-            string[] assemblyFolders;
-            string[] assemblies;
-            string outputFile;
+            AssemblyInputs inputs = new AssemblyInputs();
+            inputs.type = type;
+            inputs.platform = platform;
+            inputs.debug = debug;
+            inputs.files = scriptFiles.ToArray();
 
             string builtinAssemblyPath = debug
                     ? EditorApplication.BuiltinDebugAssemblyPath
@@ -77,38 +139,256 @@ namespace bs.Editor
             string[] frameworkAssemblies = BuildManager.GetFrameworkAssemblies(platform);
             if (type == ScriptAssemblyType.Game)
             {
-                assemblyFolders = new string[]
+                inputs.assemblyFolders = new string[]
                 {
                     builtinAssemblyPath, 
                     EditorApplication.FrameworkAssemblyPath
                 };
 
-                assemblies = new string[frameworkAssemblies.Length + 1];
-                assemblies[assemblies.Length - 1] = EditorApplication.EngineAssemblyName;
+                inputs.assemblies = new string[frameworkAssemblies.Length + 1];
+                inputs.assemblies[inputs.assemblies.Length - 1] = EditorApplication.EngineAssemblyName;
 
-                outputFile = Path.Combine(outputDir, EditorApplication.ScriptGameAssemblyName);
+                inputs.outputFile = Path.Combine(outputDir, EditorApplication.ScriptGameAssemblyName);
             }
             else
             {
-                assemblyFolders = new string[]
+                inputs.assemblyFolders = new string[]
                 {
                     builtinAssemblyPath, 
                     EditorApplication.FrameworkAssemblyPath,
                     EditorApplication.ScriptAssemblyPath
                 };
 
-                assemblies = new string[frameworkAssemblies.Length + 3];
-                assemblies[assemblies.Length - 1] = EditorApplication.EngineAssemblyName;
-                assemblies[assemblies.Length - 2] = EditorApplication.EditorAssemblyName;
-                assemblies[assemblies.Length - 3] = EditorApplication.ScriptGameAssemblyName;
+                inputs.assemblies = new string[frameworkAssemblies.Length + 3];
+                inputs.assemblies[inputs.assemblies.Length - 1] = EditorApplication.EngineAssemblyName;
+                inputs.assemblies[inputs.assemblies.Length - 2] = EditorApplication.EditorAssemblyName;
+                inputs.assemblies[inputs.assemblies.Length - 3] = EditorApplication.ScriptGameAssemblyName;
+
+                inputs.outputFile = Path.Combine(outputDir, EditorApplication.ScriptEditorAssemblyName);
+            }
+
+            Array.Copy(frameworkAssemblies, inputs.assemblies, frameworkAssemblies.Length);
+
+            inputs.defines = BuildManager.GetDefines(platform);
+            return inputs;
+        }
+
+        /// <summary>
+        /// Calculates a hash that uniquely identifies the provided compiler inputs. Script files are identified by their
+        /// path, size and last modification time, which avoids having to read the contents of every file.
+        /// </summary>
+        /// <param name="inputs">Inputs to calculate the hash for.</param>
+        /// <returns>Hash of the inputs, as a hexadecimal string.</returns>
+        private static string CalculateInputHash(AssemblyInputs inputs)
+        {
+            StringBuilder sb = new StringBuilder();
+            sb.AppendLine(inputs.platform.ToString());
+            sb.AppendLine(inputs.debug.ToString());
+            sb.AppendLine(inputs.defines);
+
+            foreach (var assembly in inputs.assemblies)
+                sb.AppendLine(assembly);
+
+            string[] files = (string[])inputs.files.Clone();
+            Array.Sort(files, StringComparer.Ordinal);
+
+            foreach (var file in files)
+            {
+                FileInfo fileInfo = new FileInfo(file);
+                if (fileInfo.Exists)
+                    sb.AppendLine(file + "|" + fileInfo.Length + "|" + fileInfo.LastWriteTimeUtc.Ticks);
+                else
+                    sb.AppendLine(file);
+            }
+
+            // Editor scripts only need to be recompiled if the public interface of the game assembly changed
+            if (inputs.type == ScriptAssemblyType.Editor)
+            {
+                string gameAssemblyPath = Path.Combine(EditorApplication.ScriptAssemblyPath,
+                    EditorApplication.ScriptGameAssemblyName);
+
+                sb.AppendLine(GetPublicSurfaceHash(gameAssemblyPath, inputs.assemblyFolders));
+            }
+
+            return CalculateHash(Encoding.UTF8.GetBytes(sb.ToString()));
+        }
+
+        /// <summary>
+        /// Calculates a hash of all the types and members of an assembly that are visible to other assemblies. If the
+        /// assembly cannot be inspected the hash of the entire assembly file is returned instead.
+        /// </summary>
+        /// <param name="assemblyPath">Absolute path to the assembly.</param>
+        /// <param name="assemblyFolders">Folders in which to look for assemblies referenced by the assembly.</param>
+        /// <returns>Hash of the public surface of the assembly, as a hexadecimal string. Empty if the assembly doesn't
+        ///          exist.</returns>
+        private static string GetPublicSurfaceHash(string assemblyPath, string[] assemblyFolders)
+        {
+            if (!File.Exists(assemblyPath))
+                return "";
+
+            // Assemblies cannot be unloaded individually, so the assembly is inspected in a temporary domain that is
+            // unloaded afterwards. This also ensures the latest version of the assembly is loaded every time, as loading
+            // an assembly with the same identity twice would return the previously loaded version.
+            AppDomain domain = null;
+            try
+            {
+                AppDomainSetup setup = new AppDomainSetup();
+                setup.ApplicationBase = Path.GetDirectoryName(typeof(PublicSurfaceHasher).Assembly.Location);
+
+                domain = AppDomain.CreateDomain("PublicSurfaceHash", null, setup);
+                PublicSurfaceHasher hasher = (PublicSurfaceHasher)domain.CreateInstanceAndUnwrap(
+                    typeof(PublicSurfaceHasher).Assembly.FullName, typeof(PublicSurfaceHasher).FullName);
+
+                return hasher.Calculate(assemblyPath, assemblyFolders);
+            }
+            catch (Exception)
+            {
+                return CalculateHash(File.ReadAllBytes(assemblyPath));
+            }
+            finally
+            {
+                if (domain != null)
+                    AppDomain.Unload(domain);
+            }
+        }
+
+        /// <summary>
+        /// Calculates the public surface hash of an assembly, as described by <see cref="GetPublicSurfaceHash"/>. Meant
+        /// to be instantiated in a separate application domain.
+        /// </summary>
+        private class PublicSurfaceHasher : MarshalByRefObject
+        {
+            /// <summary>
+            /// Loads the assembly for reflection only into the current domain, and calculates the hash of its public
+            /// surface.
+            /// </summary>
+            /// <param name="assemblyPath">Absolute path to the assembly.</param>
+            /// <param name="assemblyFolders">Folders in which to look for assemblies referenced by the assembly.</param>
+            /// <returns>Hash of the public surface of the assembly, as a hexadecimal string.</returns>
+            public string Calculate(string assemblyPath, string[] assemblyFolders)
+            {
+                byte[] assemblyBytes = File.ReadAllBytes(assemblyPath);
+
+                ResolveEventHandler resolveHandler = (sender, args) =>
+                {
+                    string name = new AssemblyName(args.Name).Name + ".dll";
+                    foreach (var folder in assemblyFolders)
+                    {
+                        string path = Path.Combine(folder, name);
+                        if (File.Exists(path))
+                            return Assembly.ReflectionOnlyLoadFrom(path);
+                    }
+
+                    return Assembly.ReflectionOnlyLoad(args.Name);
+                };
+
+                AppDomain.CurrentDomain.ReflectionOnlyAssemblyResolve += resolveHandler;
+                try
+                {
+                    Assembly assembly = Assembly.ReflectionOnlyLoad(assemblyBytes);
 
-                outputFile = Path.Combine(outputDir, EditorApplication.ScriptEditorAssemblyName);
+                    const BindingFlags flags = BindingFlags.Public | BindingFlags.NonPublic | BindingFlags.Instance |
+                                               BindingFlags.Static | BindingFlags.DeclaredOnly;
+
+                    List<string> entries = new List<string>();
+                    foreach (var type in assembly.GetTypes())
+                    {
+                        if (!type.IsPublic && !type.IsNestedPublic && !type.IsNestedFamily && !type.IsNestedFamORAssem)
+                            continue;
+
+                        StringBuilder sb = new StringBuilder();
+                        sb.Append(type.FullName + ":" + type.Attributes + ":" + type.BaseType);
+                        foreach (var iface in type.GetInterfaces())
+                            sb.Append("," + iface.FullName);
+
+                        List<string> members = new List<string>();
+                        foreach (var member in type.GetMembers(flags))
+                        {
+                            if (IsVisibleOutsideAssembly(member))
+                                members.Add(member.MemberType + " " + member);
+                        }
+
+                        members.Sort(StringComparer.Ordinal);
+                        foreach (var member in members)
+                            sb.Append("\n" + member);
+
+                        entries.Add(sb.ToString());
+                    }
+
+                    entries.Sort(StringComparer.Ordinal);
+                    return CalculateHash(Encoding.UTF8.GetBytes(string.Join("\n", entries.ToArray())));
+                }
+                catch (Exception)
+                {
+                    return CalculateHash(assemblyBytes);
+                }
+                finally
+                {
+                    AppDomain.CurrentDomain.ReflectionOnlyAssemblyResolve -= resolveHandler;
+                }
             }
+        }
+
+        /// <summary>
+        /// Checks can the member be accessed from outside of the assembly it is defined in.
+        /// </summary>
+        /// <param name="member">Member to check.</param>
+        /// <returns>True if the member is public or protected, false otherwise.</returns>
+        private static bool IsVisibleOutsideAssembly(MemberInfo member)
+        {
+            if (member is FieldInfo field)
+                return field.IsPublic || field.IsFamily || field.IsFamilyOrAssembly;
 
-            Array.Copy(frameworkAssemblies, assemblies, frameworkAssemblies.Length);
+            if (member is MethodBase method)
+                return method.IsPublic || method.IsFamily || method.IsFamilyOrAssembly;
 
-            string defines = BuildManager.GetDefines(platform);
-            return new CompilerInstance(scriptFiles.ToArray(), defines, assemblyFolders, assemblies, debug, outputFile);
+            if (member is PropertyInfo property)
+            {
+                foreach (var accessor in property.GetAccessors(true))
+                {
+                    if (IsVisibleOutsideAssembly(accessor))
+                        return true;
+                }
+
+                return false;
+            }
+
+            if (member is EventInfo evnt)
+            {
+                MethodInfo addMethod = evnt.GetAddMethod(true);
+                return addMethod != null && IsVisibleOutsideAssembly(addMethod);
+            }
+
+            if (member is Type nestedType)
+                return nestedType.IsNestedPublic || nestedType.IsNestedFamily || nestedType.IsNestedFamORAssem;
+
+            return false;
+        }
+
+        /// <summary>
+        /// Calculates a hash of the provided data.
+        /// </summary>
+        /// <param name="data">Data to calculate the hash for.</param>
+        /// <returns>Hash of the data, as a hexadecimal string.</returns>
+        private static string CalculateHash(byte[] data)
+        {
+            using (MD5 md5 = MD5.Create())
+                return BitConverter.ToString(md5.ComputeHash(data)).Replace("-", "");
+        }
+
+        /// <summary>
+        /// Contains all the information required for compiling a single assembly.
+        /// </summary>
+        private class AssemblyInputs
+        {
+            public ScriptAssemblyType type;
+            public PlatformType platform;
+            public bool debug;
+            public string[] files;
+            public string defines;
+            public string[] assemblyFolders;
+            public string[] assemblies;
+            public string outputFile;
         }
     }
 
@@ -119,6 +399,8 @@ namespace bs.Editor
     {
         private Process process;
         private Thread readErrorsThread;
+        private string inputHash;
+        private string inputHashFile;
 
         private List<CompilerMessage> errors = new List<CompilerMessage>();
         private List<CompilerMessage> warnings = new List<CompilerMessage>();
@@ -135,9 +417,14 @@ namespace bs.Editor
         /// <param name="assemblies">Names of the assemblies containing code referenced by the script files.</param>
         /// <param name="debugBuild">Determines should the assembly be compiled with additional debug information.</param>
         /// <param name="outputFile">Absolute path to the assembly file to generate.</param>
+        /// <param name="inputHash">Hash of the compiler inputs. Written next to the assembly if compilation succeeds, so
+        ///                         the assembly can later be checked for being up to date. Ignored if null.</param>
         internal CompilerInstance(string[] files, string defines, string[] assemblyFolders, string[] assemblies,
-            bool debugBuild, string outputFile)
+            bool debugBuild, string outputFile, string inputHash = null)
         {
+            this.inputHash = inputHash;
+            inputHashFile = ScriptCompiler.GetInputHashFile(outputFile);
+
             ProcessStartInfo procStartInfo = new ProcessStartInfo();
             StringBuilder argumentsBuilder = new StringBuilder();
 
@@ -185,6 +472,9 @@ namespace bs.Editor
             if (File.Exists(outputFile))
                 File.Delete(outputFile);
 
+            if (File.Exists(inputHashFile))
+                File.Delete(inputHashFile);
+
             string outputDir = Path.GetDirectoryName(outputFile);
             if (!Directory.Exists(outputDir))
                 Directory.CreateDirectory(outputDir);
@@ -212,9 +502,17 @@ namespace bs.Editor
         {
             while (true)
             {
-                if (process == null || process.HasExited)
+                if (process == null)
                     return;
 
+                if (process.HasExited)
+                {
+                    if (process.ExitCode == 0 && inputHash != null)
+                        File.WriteAllText(inputHashFile, inputHash);
+
+                    return;
+                }
+
                 string line = process.StandardError.ReadLine();
                 if (string.IsNullOrEmpty(line))
                     continue;
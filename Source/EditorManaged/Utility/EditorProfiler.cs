@@ -0,0 +1,201 @@
+﻿//********************************** Banshee Engine (www.banshee3d.com) **************************************************//
+//**************** Copyright (c) 2019 Marko Pintera (marko.pintera@gmail.com). All rights reserved. **********************//
+
+using System.Runtime.CompilerServices;
+
+namespace bs.Editor
+{
+    /** @addtogroup Utility-Editor
+     *  @{
+     */
+
+    /// <summary>
+    /// Timing of a single profiled scope recorded by the <see cref="EditorProfiler"/>.
+    /// </summary>
+    public struct EditorProfilerSample
+    {
+        /// <summary>Editor subsystem the scope belongs to.</summary>
+        public string category;
+
+        /// <summary>Name of the scope.</summary>
+        public string name;
+
+        /// <summary>Index of the thread the scope executed on, see <see cref="EditorProfiler.ThreadNames"/>.</summary>
+        public int thread;
+
+        /// <summary>Number of profiled scopes the scope was nested in, on the same thread.</summary>
+        public int depth;
+
+        /// <summary>Time at which the scope was entered, in microseconds.</summary>
+        public ulong start;
+
+        /// <summary>Time spent in the scope, in microseconds.</summary>
+        public ulong duration;
+    }
+
+    /// <summary>
+    /// Accumulated timings of all samples with the same category and name.
+    /// </summary>
+    public struct EditorProfilerAggregate
+    {
+        /// <summary>Editor subsystem the scope belongs to.</summary>
+        public string category;
+
+        /// <summary>Name of the scope.</summary>
+        public string name;
+
+        /// <summary>Total time spent in the scope, in microseconds.</summary>
+        public ulong totalTime;
+
+        /// <summary>Longest time spent in a single execution of the scope, in microseconds.</summary>
+        public ulong maxTime;
+
+        /// <summary>Number of times the scope was executed.</summary>
+        public int numSamples;
+    }
+
+    /// <summary>
+    /// Records how long the instrumented editor subsystems take to execute, on all threads. Recording is disabled by
+    /// default.
+    /// </summary>
+    public static class EditorProfiler
+    {
+        /// <summary>
+        /// Determines whether the profiler is recording samples.
+        /// </summary>
+        public static bool Enabled
+        {
+            get { return Internal_IsEnabled(); }
+            set { Internal_SetEnabled(value); }
+        }
+
+        /// <summary>
+        /// Index of the current editor frame.
+        /// </summary>
+        public static ulong FrameIndex
+        {
+            get { return Internal_GetFrameIdx(); }
+        }
+
+        /// <summary>
+        /// Names of all the threads that recorded samples, indexed by <see cref="EditorProfilerSample.thread"/>.
+        /// </summary>
+        public static string[] ThreadNames
+        {
+            get { return Internal_GetThreadNames(); }
+        }
+
+        /// <summary>
+        /// Returns the time at which the provided frame started, in microseconds. Only recent frames are available,
+        /// zero is returned for older frames.
+        /// </summary>
+        /// <param name="frameIdx">Index of the frame to retrieve the start time for.</param>
+        /// <returns>Start time of the frame, in microseconds.</returns>
+        public static ulong GetFrameStart(ulong frameIdx)
+        {
+            return Internal_GetFrameStart(frameIdx);
+        }
+
+        /// <summary>
+        /// Returns all the recorded samples that were entered during the provided range of frames.
+        /// </summary>
+        /// <param name="firstFrame">Index of the first frame to return the samples for.</param>
+        /// <param name="lastFrame">Index of the last frame to return the samples for, inclusive.</param>
+        /// <returns>Samples recorded during the frames, on all threads.</returns>
+        public static EditorProfilerSample[] GetSamples(ulong firstFrame, ulong lastFrame)
+        {
+            string[] categories, names;
+            uint[] threads, depths;
+            ulong[] starts, durations;
+            Internal_GetSamples(firstFrame, lastFrame, out categories, out names, out threads, out depths, out starts,
+                out durations);
+
+            EditorProfilerSample[] output = new EditorProfilerSample[names.Length];
+            for (int i = 0; i < output.Length; i++)
+            {
+                output[i].category = categories[i];
+                output[i].name = names[i];
+                output[i].thread = (int)threads[i];
+                output[i].depth = (int)depths[i];
+                output[i].start = starts[i];
+                output[i].duration = durations[i];
+            }
+
+            return output;
+        }
+
+        /// <summary>
+        /// Returns timings accumulated per category and scope name, sorted by total time spent.
+        /// </summary>
+        /// <param name="numFrames">Number of most recent frames to accumulate the timings over.</param>
+        /// <returns>Accumulated timings for each scope.</returns>
+        public static EditorProfilerAggregate[] GetAggregates(int numFrames)
+        {
+            string[] categories, names;
+            ulong[] totalTimes, maxTimes;
+            uint[] numSamples;
+            Internal_GetAggregates((uint)MathEx.Max(numFrames, 1), out categories, out names, out totalTimes,
+                out maxTimes, out numSamples);
+
+            EditorProfilerAggregate[] output = new EditorProfilerAggregate[names.Length];
+            for (int i = 0; i < output.Length; i++)
+            {
+                output[i].category = categories[i];
+                output[i].name = names[i];
+                output[i].totalTime = totalTimes[i];
+                output[i].maxTime = maxTimes[i];
+                output[i].numSamples = (int)numSamples[i];
+            }
+
+            return output;
+        }
+
+        /// <summary>
+        /// Writes all the recorded samples to a file in the Chrome trace event format, viewable in chrome://tracing.
+        /// </summary>
+        /// <param name="path">Absolute path to the file to write.</param>
+        public static void ExportChromeTrace(string path)
+        {
+            Internal_ExportChromeTrace(path);
+        }
+
+        /// <summary>
+        /// Removes all the recorded samples.
+        /// </summary>
+        public static void Clear()
+        {
+            Internal_Clear();
+        }
+
+        [MethodImpl(MethodImplOptions.InternalCall)]
+        private static extern void Internal_SetEnabled(bool enabled);
+
+        [MethodImpl(MethodImplOptions.InternalCall)]
+        private static extern bool Internal_IsEnabled();
+
+        [MethodImpl(MethodImplOptions.InternalCall)]
+        private static extern ulong Internal_GetFrameIdx();
+
+        [MethodImpl(MethodImplOptions.InternalCall)]
+        private static extern ulong Internal_GetFrameStart(ulong frameIdx);
+
+        [MethodImpl(MethodImplOptions.InternalCall)]
+        private static extern string[] Internal_GetThreadNames();
+
+        [MethodImpl(MethodImplOptions.InternalCall)]
+        private static extern void Internal_GetSamples(ulong firstFrame, ulong lastFrame, out string[] categories,
+            out string[] names, out uint[] threads, out uint[] depths, out ulong[] starts, out ulong[] durations);
+
+        [MethodImpl(MethodImplOptions.InternalCall)]
+        private static extern void Internal_GetAggregates(uint numFrames, out string[] categories, out string[] names,
+            out ulong[] totalTimes, out ulong[] maxTimes, out uint[] numSamples);
+
+        [MethodImpl(MethodImplOptions.InternalCall)]
+        private static extern void Internal_ExportChromeTrace(string path);
+
+        [MethodImpl(MethodImplOptions.InternalCall)]
+        private static extern void Internal_Clear();
+    }
+
+    /** @} */
+}
@@ -81,6 +81,21 @@ namespace bs.Editor
             return flattenedHierarchy.ToArray();
         }
 
+        /// <summary>
+        /// Removes scene objects that are children (direct or indirect) of other scene objects in the provided array.
+        /// Duplicate and destroyed objects are removed as well.
+        /// </summary>
+        /// <param name="objects">Scene objects to filter.</param>
+        /// <returns>Scene objects that don't have any of their parents in the provided array, in their original order.
+        ///          </returns>
+        public static SceneObject[] RemoveDescendants(SceneObject[] objects)
+        {
+            if (objects == null)
+                return new SceneObject[0];
+
+            return Internal_RemoveDescendants(objects);
+        }
+
         /// <summary>
         /// Find all resources that the provided resource depends on.
         /// </summary>
@@ -121,6 +136,9 @@ namespace bs.Editor
 
         [MethodImpl(MethodImplOptions.InternalCall)]
         private static extern bool Internal_IsInternal(IntPtr soPtr);
+
+        [MethodImpl(MethodImplOptions.InternalCall)]
+        private static extern SceneObject[] Internal_RemoveDescendants(SceneObject[] objects);
     }
 
     /** @} */
@@ -0,0 +1,277 @@
+﻿//********************************** Banshee Engine (www.banshee3d.com) **************************************************//
+//**************** Copyright (c) 2019 Marko Pintera (marko.pintera@gmail.com). All rights reserved. **********************//
+using System.Collections.Generic;
+using bs;
+
+namespace bs.Editor
+{
+    /** @addtogroup Windows
+     *  @{
+     */
+
+    /// <summary>
+    /// Displays timings recorded by the <see cref="EditorProfiler"/>. Shows a timeline of the most recently completed
+    /// frame, split per thread, and a list of timings accumulated over recent frames for each instrumented scope.
+    /// </summary>
+    [DefaultSize(800, 500)]
+    public class EditorProfilerWindow : EditorWindow
+    {
+        #region Constants
+        private const int TITLE_HEIGHT = 25;
+        private const int THREAD_LABEL_WIDTH = 70;
+        private const int BAR_HEIGHT = 16;
+        private const int MAX_VISIBLE_DEPTH = 4;
+        private const int ROW_PADDING = 4;
+        private const int ENTRY_HEIGHT = 18;
+        private const int AGGREGATE_FRAMES = 60;
+        private const int REFRESH_INTERVAL = 10;
+
+        private static readonly Color[] CATEGORY_COLORS =
+        {
+            new Color(0.85f, 0.45f, 0.20f), new Color(0.25f, 0.55f, 0.85f), new Color(0.35f, 0.70f, 0.35f),
+            new Color(0.75f, 0.35f, 0.70f), new Color(0.80f, 0.75f, 0.25f), new Color(0.30f, 0.70f, 0.70f),
+            new Color(0.80f, 0.30f, 0.35f), new Color(0.55f, 0.55f, 0.55f)
+        };
+        #endregion
+        #region Fields
+        private GUIToggle recordBtn;
+        private GUILabel frameTimeLabel;
+        private GUICanvas timelineCanvas;
+        private GUIScrollArea aggregatesArea;
+        private List<GUILabel> aggregateLabels = new List<GUILabel>();
+        private Dictionary<string, Color> categoryColors = new Dictionary<string, Color>();
+        private int framesUntilRefresh;
+        #endregion
+        #region Private methods
+
+        /// <summary>
+        /// Opens the editor profiler window.
+        /// </summary>
+        [MenuItem("Windows/Editor Profiler", 6000)]
+        private static void OpenEditorProfilerWindow()
+        {
+            OpenWindow<EditorProfilerWindow>();
+        }
+
+        /// <inheritdoc/>
+        protected override LocString GetDisplayName()
+        {
+            return new LocEdString("Editor Profiler");
+        }
+
+        private void OnInitialize()
+        {
+            GUILayoutY layout = GUI.AddLayoutY();
+            GUILayoutX titleLayout = layout.AddLayoutX();
+
+            recordBtn = new GUIToggle(new LocEdString("Record"), EditorStyles.Button, GUIOption.FixedHeight(TITLE_HEIGHT));
+            GUIButton clearBtn = new GUIButton(new LocEdString("Clear"), GUIOption.FixedHeight(TITLE_HEIGHT));
+            GUIButton exportBtn = new GUIButton(new LocEdString("Export trace"), GUIOption.FixedHeight(TITLE_HEIGHT));
+            frameTimeLabel = new GUILabel("", GUIOption.FixedHeight(TITLE_HEIGHT));
+
+            titleLayout.AddElement(recordBtn);
+            titleLayout.AddElement(clearBtn);
+            titleLayout.AddElement(exportBtn);
+            titleLayout.AddFlexibleSpace();
+            titleLayout.AddElement(frameTimeLabel);
+
+            recordBtn.Value = EditorProfiler.Enabled;
+            recordBtn.OnToggled += x => EditorProfiler.Enabled = x;
+
+            clearBtn.OnClick += () =>
+            {
+                EditorProfiler.Clear();
+                Refresh();
+            };
+
+            exportBtn.OnClick += () =>
+            {
+                string tracePath;
+                if (BrowseDialog.SaveFile("", "*.json", out tracePath))
+                    EditorProfiler.ExportChromeTrace(tracePath);
+            };
+
+            timelineCanvas = new GUICanvas();
+            layout.AddElement(timelineCanvas);
+
+            aggregatesArea = new GUIScrollArea(ScrollBarType.ShowIfDoesntFit, ScrollBarType.NeverShow);
+            layout.AddElement(aggregatesArea);
+
+            Refresh();
+        }
+
+        private void OnEditorUpdate()
+        {
+            if (recordBtn.Value != EditorProfiler.Enabled)
+                recordBtn.Value = EditorProfiler.Enabled;
+
+            if (!EditorProfiler.Enabled)
+                return;
+
+            // Rebuilding the GUI every frame would itself show up in the profile, so only refresh periodically
+            framesUntilRefresh--;
+            if (framesUntilRefresh > 0)
+                return;
+
+            Refresh();
+            framesUntilRefresh = REFRESH_INTERVAL;
+        }
+
+        /// <inheritdoc/>
+        protected override void WindowResized(int width, int height)
+        {
+            base.WindowResized(width, height);
+
+            Refresh();
+        }
+
+        /// <summary>
+        /// Rebuilds the timeline and the aggregate list from the latest recorded samples.
+        /// </summary>
+        private void Refresh()
+        {
+            RebuildTimeline();
+            RebuildAggregates();
+        }
+
+        /// <summary>
+        /// Draws the samples of the most recently completed frame, with a separate row for each thread.
+        /// </summary>
+        private void RebuildTimeline()
+        {
+            timelineCanvas.Clear();
+
+            string[] threadNames = EditorProfiler.ThreadNames;
+            int rowHeight = BAR_HEIGHT * MAX_VISIBLE_DEPTH + ROW_PADDING;
+            int canvasHeight = MathEx.Max(threadNames.Length, 1) * rowHeight;
+
+            timelineCanvas.SetWidth(Width);
+            timelineCanvas.SetHeight(canvasHeight);
+
+            // Current frame is still in progress, so display the one before it
+            ulong currentFrame = EditorProfiler.FrameIndex;
+            if (currentFrame < 2)
+            {
+                frameTimeLabel.SetContent("");
+                return;
+            }
+
+            ulong frameIdx = currentFrame - 1;
+            ulong frameStart = EditorProfiler.GetFrameStart(frameIdx);
+            ulong frameEnd = EditorProfiler.GetFrameStart(currentFrame);
+            if (frameStart == 0 || frameEnd <= frameStart)
+                return;
+
+            float frameDuration = frameEnd - frameStart;
+            frameTimeLabel.SetContent("Frame " + frameIdx + ": " + (frameDuration / 1000.0f).ToString("F2") + " ms");
+
+            int timelineWidth = MathEx.Max(Width - THREAD_LABEL_WIDTH, 1);
+            for (int i = 0; i < threadNames.Length; i++)
+            {
+                int rowY = i * rowHeight;
+                timelineCanvas.DrawText(threadNames[i], new Vector2I(2, rowY), EditorBuiltin.DefaultFont, Color.LightGray,
+                    EditorStyles.DefaultFontSize);
+
+                if (i > 0)
+                {
+                    timelineCanvas.DrawLine(new Vector2I(0, rowY - ROW_PADDING / 2), 
+                        new Vector2I(Width, rowY - ROW_PADDING / 2), Color.DarkGray);
+                }
+            }
+
+            EditorProfilerSample[] samples = EditorProfiler.GetSamples(frameIdx, frameIdx);
+            foreach (var sample in samples)
+            {
+                // Samples on other threads may have started during the previous frame, or extend into the next one
+                float start = sample.start > frameStart ? sample.start - frameStart : 0.0f;
+                float end = MathEx.Min((float)(sample.start + sample.duration - frameStart), frameDuration);
+                if (end <= start)
+                    continue;
+
+                // Keep very short samples at least a pixel wide so they remain visible
+                int x0 = THREAD_LABEL_WIDTH + (int)(start / frameDuration * timelineWidth);
+                int x1 = MathEx.Max(THREAD_LABEL_WIDTH + (int)(end / frameDuration * timelineWidth), x0 + 1);
+
+                int depth = MathEx.Min(sample.depth, MAX_VISIBLE_DEPTH - 1);
+                int y0 = sample.thread * rowHeight + depth * BAR_HEIGHT;
+                int y1 = y0 + BAR_HEIGHT - 1;
+
+                Vector2I[] trianglePoints =
+                {
+                    new Vector2I(x1, y0), new Vector2I(x1, y1), new Vector2I(x0, y0), new Vector2I(x0, y1)
+                };
+
+                timelineCanvas.DrawTriangleStrip(trianglePoints, GetCategoryColor(sample.category), 101);
+
+                string label = sample.name + " (" + (sample.duration / 1000.0f).ToString("F2") + " ms)";
+                Vector2I textBounds = GUIUtility.CalculateTextBounds(label, EditorBuiltin.DefaultFont,
+                    EditorStyles.DefaultFontSize);
+
+                if (textBounds.x < (x1 - x0 - 4))
+                {
+                    timelineCanvas.DrawText(label, new Vector2I(x0 + 2, y0), EditorBuiltin.DefaultFont, Color.White,
+                        EditorStyles.DefaultFontSize, 100);
+                }
+            }
+        }
+
+        /// <summary>
+        /// Updates the list of timings accumulated over the last few frames, for each instrumented scope.
+        /// </summary>
+        private void RebuildAggregates()
+        {
+            EditorProfilerAggregate[] aggregates = EditorProfiler.GetAggregates(AGGREGATE_FRAMES);
+
+            while (aggregateLabels.Count < aggregates.Length)
+            {
+                GUILabel label = new GUILabel("", GUIOption.FixedHeight(ENTRY_HEIGHT));
+                aggregatesArea.Layout.AddElement(label);
+
+                aggregateLabels.Add(label);
+            }
+
+            for (int i = 0; i < aggregateLabels.Count; i++)
+            {
+                if (i >= aggregates.Length)
+                {
+                    aggregateLabels[i].Active = false;
+                    continue;
+                }
+
+                EditorProfilerAggregate aggregate = aggregates[i];
+                float totalMs = aggregate.totalTime / 1000.0f;
+                float maxMs = aggregate.maxTime / 1000.0f;
+
+                string text = aggregate.category + " / " + aggregate.name + 
+                    "    total: " + totalMs.ToString("F2") + " ms" +
+                    "    per frame: " + (totalMs / AGGREGATE_FRAMES).ToString("F3") + " ms" +
+                    "    max: " + maxMs.ToString("F2") + " ms" +
+                    "    calls: " + aggregate.numSamples;
+
+                aggregateLabels[i].SetContent(text);
+                aggregateLabels[i].Active = true;
+            }
+        }
+
+        /// <summary>
+        /// Returns a color used for displaying samples of the provided category. Each category is assigned its own color
+        /// on first use.
+        /// </summary>
+        /// <param name="category">Category to retrieve the color for.</param>
+        /// <returns>Color to draw the samples with.</returns>
+        private Color GetCategoryColor(string category)
+        {
+            Color color;
+            if (!categoryColors.TryGetValue(category, out color))
+            {
+                color = CATEGORY_COLORS[categoryColors.Count % CATEGORY_COLORS.Length];
+                categoryColors[category] = color;
+            }
+
+            return color;
+        }
+        #endregion
+    }
+
+    /** @} */
+}
@@ -113,6 +113,8 @@ namespace bs.Editor
         private class InspectableArrayGUI : GUIListFieldBase
         {
             private Array array;
+            private SerializableArray serializableArray;
+            private Array serializableArraySource;
             private int numElements;
             private InspectableContext context;
             private SerializableProperty property;
@@ -201,16 +203,14 @@ namespace bs.Editor
             }
 
             /// <summary>
-            /// Returns an array row at the specified index.
+            /// Returns an array row at the specified index. Switches to the page containing the row if it is not
+            /// currently displayed.
             /// </summary>
             /// <param name="idx">Index of the row.</param>
             /// <returns>Array row representation or null if index is out of range.</returns>
             public InspectableArrayGUIRow GetRow(int idx)
             {
-                if (idx < GetNumRows())
-                    return (InspectableArrayGUIRow)rows[idx];
-
-                return null;
+                return (InspectableArrayGUIRow)GetRowForIndex(idx);
             }
 
             /// <inheritdoc/>
@@ -240,6 +240,12 @@ namespace bs.Editor
                             numElements = array.Length;
                             BuildGUI(true);
                         }
+                        else
+                        {
+                            // Native arrays are returned as a new copy on every access, so keep the latest copy for
+                            // the rows to read from, instead of each row retrieving its own copy
+                            array = newArray;
+                        }
                     }
                 }
 
@@ -270,16 +276,14 @@ namespace bs.Editor
             /// <inheritdoc/>
             protected internal override object GetValue(int seqIndex)
             {
-                SerializableArray serzArray = property.GetArray();
+                SerializableArray serzArray = GetSerializableArray();
 
                 // Create a property wrapper for native arrays so we get notified when the array values change
                 if (style.StyleFlags.HasFlag(InspectableFieldStyleFlags.NativeWrapper))
                 {
                     SerializableProperty.Getter getter = () =>
                     {
-                        Array array = property.GetValue<Array>();
-
-                        if (array != null)
+                        if (array != null && seqIndex < array.Length)
                             return array.GetValue(seqIndex);
                         else
                             return null;
@@ -287,9 +291,7 @@ namespace bs.Editor
 
                     SerializableProperty.Setter setter = (object value) =>
                     {
-                        Array array = property.GetValue<Array>();
-
-                        if (array != null)
+                        if (array != null && seqIndex < array.Length)
                         {
                             array.SetValue(value, seqIndex);
                             property.SetValue(array);
@@ -302,6 +304,23 @@ namespace bs.Editor
                     return serzArray.GetProperty(seqIndex);
             }
 
+            /// <summary>
+            /// Returns the serializable wrapper for the current array. The wrapper is only re-created when the array
+            /// object changes. Native arrays are copied on every access, but their wrapper is only used for retrieving
+            /// the element type, so it is retained.
+            /// </summary>
+            private SerializableArray GetSerializableArray()
+            {
+                bool isNative = style.StyleFlags.HasFlag(InspectableFieldStyleFlags.NativeWrapper);
+                if (serializableArray == null || (serializableArraySource != array && !isNative))
+                {
+                    serializableArray = property.GetArray();
+                    serializableArraySource = array;
+                }
+
+                return serializableArray;
+            }
+
             /// <inheritdoc/>
             protected internal override void SetValue(int seqIndex, object value)
             {
@@ -329,10 +348,7 @@ namespace bs.Editor
                 int size = guiSizeField.Value; // TODO - Support multi-rank arrays
 
                 Array newArray = property.CreateArrayInstance(new int[] { size });
-                int maxSize = MathEx.Min(size, array.Length);
-
-                for (int i = 0; i < maxSize; i++)
-                    newArray.SetValue(array.GetValue(i), i);
+                Array.Copy(array, newArray, MathEx.Min(size, array.Length));
 
                 property.SetValue(newArray);
                 array = newArray;
@@ -367,15 +383,10 @@ namespace bs.Editor
                 int size = MathEx.Max(0, array.Length - 1);
                 Array newArray = property.CreateArrayInstance(new int[] { size });
 
-                int destIdx = 0;
-                for (int i = 0; i < array.Length; i++)
-                {
-                    if (i == index)
-                        continue;
-
-                    newArray.SetValue(array.GetValue(i), destIdx);
-                    destIdx++;
-                }
+                index = MathEx.Clamp(index, 0, array.Length);
+                Array.Copy(array, 0, newArray, 0, MathEx.Min(index, size));
+                if (index < size)
+                    Array.Copy(array, index + 1, newArray, index, size - index);
 
                 property.SetValue(newArray);
                 array = newArray;
@@ -389,23 +400,13 @@ namespace bs.Editor
             {
                 StartUndo();
 
-                SerializableArray array = property.GetArray();
-
-                int size = array.GetLength() + 1;
+                int size = array.Length + 1;
                 Array newArray = property.CreateArrayInstance(new int[] { size });
+                Array.Copy(array, newArray, array.Length);
 
                 object clonedEntry = null;
-                for (int i = 0; i < array.GetLength(); i++)
-                {
-                    object value = array.GetProperty(i).GetValue<object>();
-
-                    newArray.SetValue(value, i);
-
-                    if (i == index)
-                    {
-                        clonedEntry = SerializableUtility.Clone(array.GetProperty(i).GetValue<object>());
-                    }
-                }
+                if (index >= 0 && index < array.Length)
+                    clonedEntry = SerializableUtility.Clone(array.GetValue(index));
 
                 newArray.SetValue(clonedEntry, size - 1);
 
@@ -105,6 +105,8 @@ namespace bs.Editor
         private class InspectableListGUI : GUIListFieldBase
         {
             private IList list;
+            private SerializableList serializableList;
+            private IList serializableListSource;
             private int numElements;
             private InspectableContext context;
             private SerializableProperty property;
@@ -181,16 +183,14 @@ namespace bs.Editor
             }
 
             /// <summary>
-            /// Returns a list row at the specified index.
+            /// Returns a list row at the specified index. Switches to the page containing the row if it is not
+            /// currently displayed.
             /// </summary>
             /// <param name="idx">Index of the row.</param>
             /// <returns>List row representation or null if index is out of range.</returns>
             public InspectableListGUIRow GetRow(int idx)
             {
-                if (idx < GetNumRows())
-                    return (InspectableListGUIRow)rows[idx];
-
-                return null;
+                return (InspectableListGUIRow)GetRowForIndex(idx);
             }
 
             /// <inheritdoc/>
@@ -250,9 +250,22 @@ namespace bs.Editor
             /// <inheritdoc/>
             protected internal override object GetValue(int seqIndex)
             {
-                SerializableList list = property.GetList();
+                return GetSerializableList().GetProperty(seqIndex);
+            }
+
+            /// <summary>
+            /// Returns the serializable wrapper for the current list. The wrapper is only re-created when the list
+            /// object changes.
+            /// </summary>
+            private SerializableList GetSerializableList()
+            {
+                if (serializableList == null || serializableListSource != list)
+                {
+                    serializableList = property.GetList();
+                    serializableListSource = list;
+                }
 
-                return list.GetProperty(seqIndex);
+                return serializableList;
             }
 
             /// <inheritdoc/>
@@ -279,16 +292,19 @@ namespace bs.Editor
             {
                 StartUndo();
 
-                int size = guiSizeField.Value;
+                int size = MathEx.Max(0, guiSizeField.Value);
 
-                IList newList = property.CreateListInstance(size);
+                // Resize the existing list in place, rather than copying all of its elements into a new one
+                for (int i = list.Count - 1; i >= size; i--)
+                    list.RemoveAt(i);
 
-                int maxSize = MathEx.Min(size, list.Count);
-                for (int i = 0; i < maxSize; i++)
-                    newList[i] = list[i];
+                if (size > list.Count)
+                {
+                    IList defaultEntries = property.CreateListInstance(size - list.Count);
+                    for (int i = 0; i < defaultEntries.Count; i++)
+                        list.Add(defaultEntries[i]);
+                }
 
-                property.SetValue(newList);
-                list = newList;
                 numElements = list.Count;
 
                 EndUndo();
@@ -324,10 +340,8 @@ namespace bs.Editor
             {
                 StartUndo();
 
-                SerializableList serializableList = property.GetList();
-
                 if (index >= 0 && index < list.Count)
-                    list.Add(SerializableUtility.Clone(serializableList.GetProperty(index).GetValue<object>()));
+                    list.Add(SerializableUtility.Clone(list[index]));
 
                 numElements = list.Count;
 
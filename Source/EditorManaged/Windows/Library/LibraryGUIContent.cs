@@ -14,15 +14,29 @@ namespace bs.Editor
 
     /// <summary>
     /// Manages GUI for the content area of the library window. Content area displays resources as a grid or list of
-    /// resource icons.
+    /// resource icons. All tiles have the same size, so their positions are calculated directly from their index. GUI is
+    /// only created for tiles in the visible rows (plus a small margin), and is recycled as the content area is scrolled.
+    /// Preview icons of newly visible tiles are assigned over the course of multiple frames.
     /// </summary>
     internal class LibraryGUIContent
     {
         internal const int TOP_MARGIN = 8;
         internal const int LIST_ENTRY_SPACING = 6;
 
+        /// <summary>
+        /// Number of rows above and below the visible area for which GUI is kept, so that scrolling by a small amount
+        /// doesn't require any GUI to be updated.
+        /// </summary>
+        private const int VISIBLE_ROW_MARGIN = 2;
+
+        /// <summary>
+        /// Maximum number of preview icons to assign per frame.
+        /// </summary>
+        private const int ICONS_PER_FRAME = 16;
+
         private GUIPanel mainPanel;
         private GUILayout main;
+        private GUIPanel tiles;
         private GUIPanel overlay;
         private GUIPanel underlay;
         private GUIPanel deepUnderlay;
@@ -36,9 +50,25 @@ namespace bs.Editor
         private int elementsPerRow;
         private int paddingLeft;
         private int paddingRight;
-
-        private List<LibraryGUIEntry> entries = new List<LibraryGUIEntry>();
-        private Dictionary<string, LibraryGUIEntry> entryLookup = new Dictionary<string, LibraryGUIEntry>();
+        private int elemWidth;
+        private int elemHeight;
+        private int rowPitch;
+        private float horzSpacing;
+        private Vector2I origin;
+
+        private int firstActiveRow = -1;
+        private int lastActiveRow = -1;
+
+        private List<ResourceToDisplay> resourcesToDisplay = new List<ResourceToDisplay>();
+        private Dictionary<string, int> indexLookup = new Dictionary<string, int>();
+        private Dictionary<int, LibraryGUIEntry> activeEntries = new Dictionary<int, LibraryGUIEntry>();
+        private Stack<LibraryGUIEntry> entryPool = new Stack<LibraryGUIEntry>();
+        private Queue<LibraryGUIEntry> pendingIcons = new Queue<LibraryGUIEntry>();
+
+        private HashSet<string> selectedPaths = new HashSet<string>();
+        private HashSet<string> cutPaths = new HashSet<string>();
+        private string hoveredPath;
+        private string pingedPath;
 
         /// <summary>
         /// Area of the content area relative to the parent window.
@@ -89,11 +119,11 @@ namespace bs.Editor
         }
 
         /// <summary>
-        /// Returns objects representing each of the displayed resource icons.
+        /// Returns the number of displayed resource tiles, including the ones that are currently scrolled out of view.
         /// </summary>
-        public List<LibraryGUIEntry> Entries
+        public int EntryCount
         {
-            get { return entries; }
+            get { return resourcesToDisplay.Count; }
         }
 
         /// <summary>
@@ -104,6 +134,14 @@ namespace bs.Editor
             get { return window; }
         }
 
+        /// <summary>
+        /// Returns a GUI panel containing the icons and labels of the resource tiles.
+        /// </summary>
+        public GUIPanel Tiles
+        {
+            get { return tiles; }
+        }
+
         /// <summary>
         /// Returns a GUI panel that can be used for displaying elements underneath the resource tiles.
         /// </summary>
@@ -160,8 +198,13 @@ namespace bs.Editor
             if (mainPanel != null)
                 mainPanel.Destroy();
 
-            entries.Clear();
-            entryLookup.Clear();
+            resourcesToDisplay.Clear();
+            indexLookup.Clear();
+            activeEntries.Clear();
+            entryPool.Clear();
+            pendingIcons.Clear();
+            firstActiveRow = -1;
+            lastActiveRow = -1;
 
             mainPanel = parent.Layout.AddPanel();
 
@@ -172,12 +215,12 @@ namespace bs.Editor
             renameOverlay = mainPanel.AddPanel(-1);
 
             main = contentPanel.AddLayoutY();
+            tiles = contentPanel.AddPanel();
 
-            List<ResourceToDisplay> resourcesToDisplay = new List<ResourceToDisplay>();
             foreach (var entry in entriesToDisplay)
             {
                 if (entry.Type == LibraryEntryType.Directory)
-                    resourcesToDisplay.Add(new ResourceToDisplay(entry.Path, LibraryGUIEntryType.Single));
+                    AddResourceToDisplay(entry.Path, LibraryGUIEntryType.Single);
                 else
                 {
                     FileEntry fileEntry = (FileEntry)entry;
@@ -186,55 +229,42 @@ namespace bs.Editor
                     if (metas.Length > 0)
                     {
                         if (metas.Length == 1)
-                            resourcesToDisplay.Add(new ResourceToDisplay(entry.Path, LibraryGUIEntryType.Single));
+                            AddResourceToDisplay(entry.Path, LibraryGUIEntryType.Single);
                         else
                         {
-                            resourcesToDisplay.Add(new ResourceToDisplay(entry.Path, LibraryGUIEntryType.MultiFirst));
+                            AddResourceToDisplay(entry.Path, LibraryGUIEntryType.MultiFirst);
 
                             for (int i = 1; i < metas.Length - 1; i++)
                             {
                                 string path = Path.Combine(entry.Path, metas[i].SubresourceName);
-                                resourcesToDisplay.Add(new ResourceToDisplay(path, LibraryGUIEntryType.MultiElement));
+                                AddResourceToDisplay(path, LibraryGUIEntryType.MultiElement);
                             }
 
                             string lastPath = Path.Combine(entry.Path, metas[metas.Length - 1].SubresourceName);
-                            resourcesToDisplay.Add(new ResourceToDisplay(lastPath, LibraryGUIEntryType.MultiLast));
+                            AddResourceToDisplay(lastPath, LibraryGUIEntryType.MultiLast);
                         }
                     }
                 }
             }
 
-            int minHorzElemSpacing = 0;
+            int neededHeight;
             if (viewType == ProjectViewType.List16)
             {
                 tileSize = 16;
                 gridLayout = false;
                 elementsPerRow = 1;
-                minHorzElemSpacing = 0;
-                int elemWidth = bounds.width;
-                int elemHeight = tileSize;
-
-                main.AddSpace(TOP_MARGIN);
-
-                for (int i = 0; i < resourcesToDisplay.Count; i++)
-                {
-                    ResourceToDisplay entry = resourcesToDisplay[i];
-
-                    LibraryGUIEntry guiEntry = new LibraryGUIEntry(this, main, entry.path, i, elemWidth, elemHeight, 0,
-                        entry.type);
-                    entries.Add(guiEntry);
-                    entryLookup[guiEntry.path] = guiEntry;
-
-                    if (i != resourcesToDisplay.Count - 1)
-                        main.AddSpace(LIST_ENTRY_SPACING);
-                }
-
-                main.AddFlexibleSpace();
+                elemWidth = bounds.width;
+                elemHeight = tileSize;
+                rowPitch = elemHeight + LIST_ENTRY_SPACING;
+                paddingLeft = 0;
+                paddingRight = 0;
+                horzSpacing = 0.0f;
+
+                neededHeight = TOP_MARGIN + resourcesToDisplay.Count * rowPitch;
             }
             else
             {
-                int elemWidth = 0;
-                int elemHeight = 0;
+                int minHorzElemSpacing = 0;
                 int vertElemSpacing = 0;
 
                 switch (viewType)
@@ -263,12 +293,13 @@ namespace bs.Editor
                 }
 
                 gridLayout = true;
+                rowPitch = elemHeight + vertElemSpacing;
 
                 int availableWidth = bounds.width;
                 elementsPerRow = MathEx.FloorToInt((availableWidth - minHorzElemSpacing) / (float)(elemWidth + minHorzElemSpacing));
 
                 int numRows = MathEx.CeilToInt(resourcesToDisplay.Count / (float)Math.Max(elementsPerRow, 1));
-                int neededHeight = numRows * elemHeight + TOP_MARGIN;
+                neededHeight = numRows * elemHeight + TOP_MARGIN;
                 if (numRows > 0)
                     neededHeight += (numRows - 1)* vertElemSpacing;
 
@@ -283,7 +314,7 @@ namespace bs.Editor
 
                 paddingLeft = minHorzElemSpacing;
                 paddingRight = minHorzElemSpacing;
-                float horzSpacing = 0.0f;
+                horzSpacing = 0.0f;
 
                 // Distribute the spacing to the padding, as there are not in-between spaces to apply it to
                 if (extraRowSpace > 0 && elementsPerRow < 2)
@@ -291,87 +322,95 @@ namespace bs.Editor
                     int extraPadding = extraRowSpace / 2;
                     paddingLeft += extraPadding;
                     paddingRight += (extraRowSpace - extraPadding);
-
-                    extraRowSpace = 0;
                 }
                 else
                     horzSpacing = extraRowSpace / (float)(elementsPerRow - 1);
 
                 elementsPerRow = Math.Max(elementsPerRow, 1);
 
-                main.AddSpace(TOP_MARGIN);
-                GUILayoutX rowLayout = main.AddLayoutX();
-                rowLayout.AddSpace(paddingLeft);
-
-                float spacingCounter = 0.0f;
-                int elemsInRow = 0;
-                for (int i = 0; i < resourcesToDisplay.Count; i++)
-                {
-                    if (elemsInRow == elementsPerRow && elemsInRow > 0)
-                    {
-                        main.AddSpace(vertElemSpacing);
-                        rowLayout = main.AddLayoutX();
-                        rowLayout.AddSpace(paddingLeft);
-
-                        elemsInRow = 0;
-                        spacingCounter = 0.0f;
-                    }
-
-                    ResourceToDisplay entry = resourcesToDisplay[i];
-                    elemsInRow++;
+                numRows = MathEx.CeilToInt(resourcesToDisplay.Count / (float)elementsPerRow);
+                neededHeight = numRows * elemHeight + TOP_MARGIN;
+                if (numRows > 0)
+                    neededHeight += (numRows - 1) * vertElemSpacing;
+            }
 
-                    if (elemsInRow != elementsPerRow)
-                        spacingCounter += horzSpacing;
+            // Reserve the space for all the tiles, so the scroll area is sized correctly. Tiles themselves are
+            // positioned manually.
+            main.AddSpace(neededHeight);
+            main.AddFlexibleSpace();
 
-                    int spacing = (int)spacingCounter;
-                    spacingCounter -= spacing;
+            Rect2I mainBounds = main.Bounds;
+            origin = new Vector2I(mainBounds.x, mainBounds.y);
 
-                    LibraryGUIEntry guiEntry = new LibraryGUIEntry(this, rowLayout, entry.path, i, elemWidth, elemHeight,
-                        spacing, entry.type);
-                    entries.Add(guiEntry);
-                    entryLookup[guiEntry.path] = guiEntry;
+            // Fix bounds as that makes GUI updates faster
+            tiles.Bounds = mainBounds;
+            underlay.Bounds = mainBounds;
+            overlay.Bounds = mainBounds;
+            deepUnderlay.Bounds = mainBounds;
+            renameOverlay.Bounds = mainBounds;
 
-                    if (elemsInRow == elementsPerRow)
-                        rowLayout.AddSpace(paddingRight);
+            UpdateActiveEntries();
+        }
 
-                    rowLayout.AddSpace(spacing);
-                }
+        /// <summary>
+        /// Called every frame.
+        /// </summary>
+        public void Update()
+        {
+            UpdateActiveEntries();
 
-                int extraElements = elementsPerRow - elemsInRow;
-                int extraSpacing = 0;
+            for (int i = 0; i < ICONS_PER_FRAME && pendingIcons.Count > 0; i++)
+                pendingIcons.Dequeue().AssignPreviewIcon();
 
-                if (extraElements > 1)
-                {
-                    spacingCounter += (extraElements - 1) * horzSpacing;
-                    extraSpacing += (int)spacingCounter;
-                }
+            foreach (var entry in activeEntries.Values)
+                entry.Update();
+        }
 
-                if (extraElements > 0)
-                    rowLayout.AddSpace(elemWidth * extraElements + extraSpacing + paddingRight);
+        /// <summary>
+        /// Returns the project library path of the resource tile at the specified index.
+        /// </summary>
+        /// <param name="index">Sequential index of the tile in the content area.</param>
+        /// <returns>Project library path of the tile.</returns>
+        public string GetPath(int index)
+        {
+            return resourcesToDisplay[index].path;
+        }
 
-                main.AddFlexibleSpace();
-            }
+        /// <summary>
+        /// Returns the bounds of the resource tile at the specified index.
+        /// </summary>
+        /// <param name="index">Sequential index of the tile in the content area.</param>
+        /// <returns>Bounds of the tile, relative to the scroll area the content area is part of.</returns>
+        public Rect2I GetBounds(int index)
+        {
+            int row = index / elementsPerRow;
+            int column = index % elementsPerRow;
 
-            // Fix bounds as that makes GUI updates faster
-            underlay.Bounds = main.Bounds;
-            overlay.Bounds = main.Bounds;
-            deepUnderlay.Bounds = main.Bounds;
-            renameOverlay.Bounds = main.Bounds;
+            int x = origin.x + paddingLeft + column * elemWidth + (int)(column * horzSpacing);
+            int y = origin.y + TOP_MARGIN + row * rowPitch;
 
-            for (int i = 0; i < entries.Count; i++)
+            if (gridLayout)
             {
-                LibraryGUIEntry guiEntry = entries[i];
-                guiEntry.Initialize();
+                return new Rect2I(x, y - LibraryGUIEntry.VERT_PADDING, elemWidth,
+                    elemHeight + LibraryGUIEntry.VERT_PADDING * 2);
             }
+
+            return new Rect2I(x, y - LibraryGUIEntry.VERT_PADDING, elemWidth, elemHeight + LibraryGUIEntry.VERT_PADDING);
         }
 
         /// <summary>
-        /// Called every frame.
+        /// Finds the sequential index of the resource tile with the specified path.
         /// </summary>
-        public void Update()
+        /// <param name="path">Project library path to the element.</param>
+        /// <param name="index">Index of the tile, or -1 if none found.</param>
+        /// <returns>True if a tile was found, false otherwise.</returns>
+        public bool TryGetIndex(string path, out int index)
         {
-            for (int i = 0; i < entries.Count; i++)
-                entries[i].Update();
+            if (path != null && indexLookup.TryGetValue(path, out index))
+                return true;
+
+            index = -1;
+            return false;
         }
 
         /// <summary>
@@ -381,12 +420,17 @@ namespace bs.Editor
         /// <param name="hovered">True if mark as hovered, false to reset to normal.</param>
         public void MarkAsHovered(string path, bool hovered)
         {
-            if (!string.IsNullOrEmpty(path))
-            {
-                LibraryGUIEntry previousUnderCursorElem;
-                if (entryLookup.TryGetValue(path, out previousUnderCursorElem))
-                    previousUnderCursorElem.MarkAsHovered(hovered);
-            }
+            if (string.IsNullOrEmpty(path))
+                return;
+
+            if (hovered)
+                hoveredPath = path;
+            else if (hoveredPath == path)
+                hoveredPath = null;
+
+            LibraryGUIEntry entry;
+            if (TryGetActiveEntry(path, out entry))
+                entry.MarkAsHovered(hovered);
         }
 
         /// <summary>
@@ -396,12 +440,17 @@ namespace bs.Editor
         /// <param name="pinged">True if mark as pinged, false to reset to normal.</param>
         public void MarkAsPinged(string path, bool pinged)
         {
-            if (!string.IsNullOrEmpty(path))
-            {
-                LibraryGUIEntry previousUnderCursorElem;
-                if (entryLookup.TryGetValue(path, out previousUnderCursorElem))
-                    previousUnderCursorElem.MarkAsPinged(pinged);
-            }
+            if (string.IsNullOrEmpty(path))
+                return;
+
+            if (pinged)
+                pingedPath = path;
+            else if (pingedPath == path)
+                pingedPath = null;
+
+            LibraryGUIEntry entry;
+            if (TryGetActiveEntry(path, out entry))
+                entry.MarkAsPinged(pinged);
         }
 
         /// <summary>
@@ -411,12 +460,17 @@ namespace bs.Editor
         /// <param name="cut">True if mark as cut, false to reset to normal.</param>
         public void MarkAsCut(string path, bool cut)
         {
-            if (!string.IsNullOrEmpty(path))
-            {
-                LibraryGUIEntry previousUnderCursorElem;
-                if (entryLookup.TryGetValue(path, out previousUnderCursorElem))
-                    previousUnderCursorElem.MarkAsCut(cut);
-            }
+            if (string.IsNullOrEmpty(path))
+                return;
+
+            if (cut)
+                cutPaths.Add(path);
+            else
+                cutPaths.Remove(path);
+
+            LibraryGUIEntry entry;
+            if (TryGetActiveEntry(path, out entry))
+                entry.MarkAsCut(cut);
         }
 
         /// <summary>
@@ -426,57 +480,238 @@ namespace bs.Editor
         /// <param name="selected">True if mark as selected, false to reset to normal.</param>
         public void MarkAsSelected(string path, bool selected)
         {
-            if (!string.IsNullOrEmpty(path))
-            {
-                LibraryGUIEntry previousUnderCursorElem;
-                if (entryLookup.TryGetValue(path, out previousUnderCursorElem))
-                    previousUnderCursorElem.MarkAsSelected(selected);
-            }
+            if (string.IsNullOrEmpty(path))
+                return;
+
+            if (selected)
+                selectedPaths.Add(path);
+            else
+                selectedPaths.Remove(path);
+
+            LibraryGUIEntry entry;
+            if (TryGetActiveEntry(path, out entry))
+                entry.MarkAsSelected(selected);
         }
 
         /// <summary>
         /// Attempts to find a resource tile element at the specified coordinates.
         /// </summary>
         /// <param name="scrollPos">Coordinates relative to the scroll area the content area is part of.</param>
-        /// <returns>True if found an entry, false otherwise.</returns>
+        /// <returns>Found entry, or null if none found.</returns>
         public LibraryGUIEntry FindElementAt(Vector2I scrollPos)
         {
-            foreach (var element in entries)
+            int firstRow, lastRow;
+            GetRowsInRange(scrollPos.y, scrollPos.y, out firstRow, out lastRow);
+
+            for (int row = firstRow; row <= lastRow; row++)
             {
-                if (element.bounds.Contains(scrollPos))
-                    return element;
+                int rowEnd = Math.Min((row + 1) * elementsPerRow, resourcesToDisplay.Count);
+                for (int i = row * elementsPerRow; i < rowEnd; i++)
+                {
+                    if (GetBounds(i).Contains(scrollPos))
+                        return GetEntry(i);
+                }
             }
 
             return null;
         }
 
         /// <summary>
-        /// Attempts to find all resource tile elements overlapping the specified bounds.
+        /// Attempts to find all resource tiles overlapping the specified bounds. Tiles that are not currently visible are
+        /// included as well.
         /// </summary>
         /// <param name="scrollBounds">Bounds to check for overlap, specified relative to the scroll area the content area 
         ///                            is part of.</param>
-        /// <returns>A list of found entries.</returns>
-        public LibraryGUIEntry[] FindElementsOverlapping(Rect2I scrollBounds)
+        /// <returns>Sequential indices of the found tiles, in increasing order.</returns>
+        public int[] FindEntriesOverlapping(Rect2I scrollBounds)
         {
-            List<LibraryGUIEntry> elements = new List<LibraryGUIEntry>();
-            foreach (var element in entries)
+            int firstRow, lastRow;
+            GetRowsInRange(scrollBounds.y, scrollBounds.y + scrollBounds.height, out firstRow, out lastRow);
+
+            List<int> indices = new List<int>();
+            for (int row = firstRow; row <= lastRow; row++)
             {
-                if (element.Bounds.Overlaps(scrollBounds))
-                    elements.Add(element);
+                int rowEnd = Math.Min((row + 1) * elementsPerRow, resourcesToDisplay.Count);
+                for (int i = row * elementsPerRow; i < rowEnd; i++)
+                {
+                    if (GetBounds(i).Overlaps(scrollBounds))
+                        indices.Add(i);
+                }
             }
 
-            return elements.ToArray();
+            return indices.ToArray();
         }
 
         /// <summary>
-        /// Attempts to find a resource tile element with the specified path.
+        /// Attempts to find a resource tile element with the specified path. If the tile is not currently visible its
+        /// GUI is created, and is kept until the next time the visible tiles are updated.
         /// </summary>
         /// <param name="path">Project library path to the element.</param>
         /// <param name="entry">Found element, or null if none found.</param>
         /// <returns>True if an element was found, false otherwise.</returns>
         public bool TryGetEntry(string path, out LibraryGUIEntry entry)
         {
-            return entryLookup.TryGetValue(path, out entry);
+            int index;
+            if (!TryGetIndex(path, out index))
+            {
+                entry = null;
+                return false;
+            }
+
+            entry = GetEntry(index);
+            return true;
+        }
+
+        /// <summary>
+        /// Registers a new resource tile to display.
+        /// </summary>
+        /// <param name="path">Project library path of the resource.</param>
+        /// <param name="type">Type of the tile to display.</param>
+        private void AddResourceToDisplay(string path, LibraryGUIEntryType type)
+        {
+            indexLookup[path] = resourcesToDisplay.Count;
+            resourcesToDisplay.Add(new ResourceToDisplay(path, type));
+        }
+
+        /// <summary>
+        /// Finds the tile element with the specified path, if its GUI currently exists.
+        /// </summary>
+        /// <param name="path">Project library path to the element.</param>
+        /// <param name="entry">Found element, or null if none found.</param>
+        /// <returns>True if an element was found, false otherwise.</returns>
+        private bool TryGetActiveEntry(string path, out LibraryGUIEntry entry)
+        {
+            int index;
+            if (TryGetIndex(path, out index))
+                return activeEntries.TryGetValue(index, out entry);
+
+            entry = null;
+            return false;
+        }
+
+        /// <summary>
+        /// Returns the tile element at the specified index, creating its GUI if it doesn't exist.
+        /// </summary>
+        /// <param name="index">Sequential index of the tile in the content area.</param>
+        /// <returns>Tile element at the specified index.</returns>
+        private LibraryGUIEntry GetEntry(int index)
+        {
+            LibraryGUIEntry entry;
+            if (activeEntries.TryGetValue(index, out entry))
+                return entry;
+
+            if (entryPool.Count > 0)
+                entry = entryPool.Pop();
+            else
+                entry = new LibraryGUIEntry(this);
+
+            ResourceToDisplay resource = resourcesToDisplay[index];
+            entry.UpdateContents(resource.path, index, GetBounds(index), GetSpacing(index), resource.type);
+
+            if (cutPaths.Contains(resource.path))
+                entry.MarkAsCut(true);
+
+            if (hoveredPath == resource.path)
+                entry.MarkAsHovered(true);
+
+            if (selectedPaths.Contains(resource.path))
+                entry.MarkAsSelected(true);
+
+            if (pingedPath == resource.path)
+                entry.MarkAsPinged(true);
+
+            activeEntries[index] = entry;
+            pendingIcons.Enqueue(entry);
+
+            return entry;
+        }
+
+        /// <summary>
+        /// Determines which rows are visible in the parent scroll area, creates GUI for any newly visible tiles, and
+        /// recycles the GUI of tiles that are no longer visible.
+        /// </summary>
+        private void UpdateActiveEntries()
+        {
+            if (main == null)
+                return;
+
+            Rect2I scrollBounds = parent.Bounds;
+            Rect2I scrollLayoutBounds = parent.Layout.Bounds;
+
+            int visibleTop = scrollBounds.y - scrollLayoutBounds.y;
+            int visibleBottom = visibleTop + scrollBounds.height;
+
+            int firstRow, lastRow;
+            GetRowsInRange(visibleTop, visibleBottom, out firstRow, out lastRow);
+
+            int numRows = MathEx.CeilToInt(resourcesToDisplay.Count / (float)elementsPerRow);
+            firstRow = Math.Max(firstRow - VISIBLE_ROW_MARGIN, 0);
+            lastRow = Math.Min(lastRow + VISIBLE_ROW_MARGIN, numRows - 1);
+
+            int firstIndex = firstRow * elementsPerRow;
+            int lastIndex = Math.Min((lastRow + 1) * elementsPerRow, resourcesToDisplay.Count) - 1;
+
+            // Nothing to do unless the visible rows changed, or some entries outside of them were requested
+            bool rangeChanged = firstRow != firstActiveRow || lastRow != lastActiveRow;
+            if (!rangeChanged && activeEntries.Count <= Math.Max(lastIndex - firstIndex + 1, 0))
+                return;
+
+            List<int> toRecycle = new List<int>();
+            foreach (var entry in activeEntries)
+            {
+                if ((entry.Key < firstIndex || entry.Key > lastIndex) && !entry.Value.IsPinned)
+                    toRecycle.Add(entry.Key);
+            }
+
+            foreach (var index in toRecycle)
+            {
+                LibraryGUIEntry entry = activeEntries[index];
+                entry.Release();
+
+                activeEntries.Remove(index);
+                entryPool.Push(entry);
+            }
+
+            for (int i = firstIndex; i <= lastIndex; i++)
+                GetEntry(i);
+
+            firstActiveRow = firstRow;
+            lastActiveRow = lastRow;
+        }
+
+        /// <summary>
+        /// Returns a range of rows that might overlap the provided vertical range. The range is conservative, and might
+        /// include rows that don't actually overlap.
+        /// </summary>
+        /// <param name="top">Top of the vertical range, relative to the scroll area the content area is part of.</param>
+        /// <param name="bottom">Bottom of the vertical range, relative to the scroll area the content area is part of.
+        ///                      </param>
+        /// <param name="firstRow">Index of the first row in the range.</param>
+        /// <param name="lastRow">Index of the last row in the range. Less than <paramref name="firstRow"/> if the range
+        ///                       is empty.</param>
+        private void GetRowsInRange(int top, int bottom, out int firstRow, out int lastRow)
+        {
+            int numRows = MathEx.CeilToInt(resourcesToDisplay.Count / (float)elementsPerRow);
+
+            firstRow = MathEx.FloorToInt((top - origin.y - TOP_MARGIN) / (float)rowPitch);
+            lastRow = MathEx.FloorToInt((bottom - origin.y - TOP_MARGIN) / (float)rowPitch) + 1;
+
+            firstRow = Math.Max(firstRow, 0);
+            lastRow = Math.Min(lastRow, numRows - 1);
+        }
+
+        /// <summary>
+        /// Returns the spacing between the tile at the specified index and the next tile in the same row.
+        /// </summary>
+        /// <param name="index">Sequential index of the tile in the content area.</param>
+        /// <returns>Spacing to the next tile, or 0 if the tile is the last one in its row.</returns>
+        private int GetSpacing(int index)
+        {
+            int column = index % elementsPerRow;
+            if (column == elementsPerRow - 1)
+                return 0;
+
+            return (int)((column + 1) * horzSpacing) - (int)(column * horzSpacing);
         }
 
         /// <summary>
@@ -12,7 +12,8 @@ namespace bs.Editor
      */
 
     /// <summary>
-    /// Represents GUI for a single resource tile used in <see cref="LibraryGUIContent"/>.
+    /// Represents GUI for a single resource tile used in <see cref="LibraryGUIContent"/>. Tiles are recycled as the
+    /// content area is scrolled, so the same object can display different resources over its lifetime.
     /// </summary>
     internal class LibraryGUIEntry
     {
@@ -20,7 +21,7 @@ namespace bs.Editor
         private static readonly Color SELECTION_COLOR = Color.DarkCyan;
         private static readonly Color HOVER_COLOR = new Color(Color.DarkCyan.r, Color.DarkCyan.g, Color.DarkCyan.b, 0.5f);
         private static readonly Color CUT_COLOR = new Color(1.0f, 1.0f, 1.0f, 0.5f);
-        private const int VERT_PADDING = 3;
+        internal const int VERT_PADDING = 3;
         private const int BG_HORZ_PADDING = 2;
         private const int BG_VERT_PADDING = 2;
 
@@ -39,21 +40,23 @@ namespace bs.Editor
             None, Hovered, Selected, Pinged
         }
 
-        public int index;
+        public int index = -1;
         public string path;
         public GUITexture icon;
         public GUILabel label;
         public Rect2I bounds;
         public int spacing;
 
+        private GUIButton overlayBtn;
         private GUITexture underlay;
         private GUITexture groupUnderlay;
+        private LibraryGUIEntryType groupUnderlayType = LibraryGUIEntryType.Single;
         private LibraryGUIContent owner;
         private UnderlayState underlayState;
         private GUITextBox renameTextBox;
 
-        private int width;
         private LibraryGUIEntryType type;
+        private bool previewIconAssigned;
         private bool delayedSelect;
         private float delayedSelectTime;
         private ulong delayedOpenCodeEditorFrame = ulong.MaxValue;
@@ -67,172 +70,116 @@ namespace bs.Editor
         }
 
         /// <summary>
-        /// Constructs a new resource tile entry.
+        /// Checks if the entry has an operation in progress, in which case it must not be recycled even if it is scrolled
+        /// out of view.
         /// </summary>
-        /// <param name="owner">Content area this entry is part of.</param>
-        /// <param name="parent">Parent layout to add this entry's GUI elements to.</param>
-        /// <param name="path">Path to the project library entry to display data for.</param>
-        /// <param name="index">Sequential index of the entry in the conent area.</param>
-        /// <param name="width">Width of the GUI entry.</param>
-        /// <param name="height">Maximum allowed height for the label.</param>
-        /// <param name="spacing">Spacing between this element and the next element on the same row. 0 if last.</param>
-        /// <param name="type">Type of the entry, which controls its style and/or behaviour.</param>
-        public LibraryGUIEntry(LibraryGUIContent owner, GUILayout parent, string path, int index, int width, int height,
-            int spacing, LibraryGUIEntryType type)
+        public bool IsPinned
         {
-            GUILayout entryLayout;
-
-            if (owner.GridLayout)
-                entryLayout = parent.AddLayoutY();
-            else
-                entryLayout = parent.AddLayoutX();
-
-            SpriteTexture iconTexture = GetIcon(path, owner.TileSize);
+            get { return renameTextBox != null || delayedSelect || delayedOpenCodeEditorFrame != ulong.MaxValue; }
+        }
 
-            icon = new GUITexture(iconTexture, GUITextureScaleMode.ScaleToFit,
-                true, GUIOption.FixedHeight(owner.TileSize), GUIOption.FixedWidth(owner.TileSize));
+        /// <summary>
+        /// Constructs a new resource tile entry. The entry doesn't display anything until
+        /// <see cref="UpdateContents"/> is called.
+        /// </summary>
+        /// <param name="owner">Content area this entry is part of.</param>
+        public LibraryGUIEntry(LibraryGUIContent owner)
+        {
+            this.owner = owner;
 
-            label = null;
+            icon = new GUITexture(null, GUITextureScaleMode.ScaleToFit, true);
 
-            string name = PathEx.GetTail(path);
             if (owner.GridLayout)
-            {
-                int labelHeight = height - owner.TileSize;
-
-                label = new GUILabel(name, EditorStyles.MultiLineLabelCentered,
-                    GUIOption.FixedWidth(width), GUIOption.FixedHeight(labelHeight));
-
-                switch (type)
-                {
-                    case LibraryGUIEntryType.Single:
-                        break;
-                    case LibraryGUIEntryType.MultiFirst:
-                        groupUnderlay = new GUITexture(null, LibraryEntryFirstBg);
-                        break;
-                    case LibraryGUIEntryType.MultiElement:
-                        groupUnderlay = new GUITexture(null, LibraryEntryBg);
-                        break;
-                    case LibraryGUIEntryType.MultiLast:
-                        groupUnderlay = new GUITexture(null, LibraryEntryLastBg);
-                        break;
-                }
-            }
+                label = new GUILabel("", EditorStyles.MultiLineLabelCentered);
             else
-            {
-                label = new GUILabel(name, GUIOption.FixedWidth(width - owner.TileSize), GUIOption.FixedHeight(height));
+                label = new GUILabel("");
 
-                switch (type)
-                {
-                    case LibraryGUIEntryType.Single:
-                        break;
-                    case LibraryGUIEntryType.MultiFirst:
-                        groupUnderlay = new GUITexture(null, LibraryEntryVertFirstBg);
-                        break;
-                    case LibraryGUIEntryType.MultiElement:
-                        groupUnderlay = new GUITexture(null, LibraryEntryVertBg);
-                        break;
-                    case LibraryGUIEntryType.MultiLast:
-                        groupUnderlay = new GUITexture(null, LibraryEntryVertLastBg);
-                        break;
-                }
-            }
+            owner.Tiles.AddElement(icon);
+            owner.Tiles.AddElement(label);
 
-            entryLayout.AddElement(icon);
-            entryLayout.AddElement(label);
-
-            if (groupUnderlay != null)
-                owner.DeepUnderlay.AddElement(groupUnderlay);
+            overlayBtn = new GUIButton("", EditorStyles.Blank);
+            overlayBtn.OnClick += () => OnEntryClicked(path);
+            overlayBtn.OnDoubleClick += () => OnEntryDoubleClicked(path);
+            overlayBtn.SetContextMenu(owner.Window.ContextMenu);
+            overlayBtn.AcceptsKeyFocus = false;
 
-            this.owner = owner;
-            this.index = index;
-            this.path = path;
-            this.bounds = new Rect2I();
-            this.underlay = null;
-            this.type = type;
-            this.width = width;
-            this.spacing = spacing;
+            owner.Overlay.AddElement(overlayBtn);
         }
 
         /// <summary>
-        /// Positions the GUI elements. Must be called after construction, but only after all content area entries have
-        /// been constructed so that entry's final bounds are known.
+        /// Assigns a new resource to display in the tile, and positions the GUI elements. Only a generic icon for the
+        /// resource type is displayed until <see cref="AssignPreviewIcon"/> is called.
         /// </summary>
-        public void Initialize()
+        /// <param name="path">Path to the project library entry to display data for.</param>
+        /// <param name="index">Sequential index of the entry in the conent area.</param>
+        /// <param name="bounds">Bounds of the entry relative to the content area.</param>
+        /// <param name="spacing">Spacing between this element and the next element on the same row. 0 if last.</param>
+        /// <param name="type">Type of the entry, which controls its style and/or behaviour.</param>
+        public void UpdateContents(string path, int index, Rect2I bounds, int spacing, LibraryGUIEntryType type)
         {
-            Rect2I iconBounds = icon.Bounds;
-            bounds = iconBounds;
-            Rect2I labelBounds = label.Bounds;
+            this.path = path;
+            this.index = index;
+            this.bounds = bounds;
+            this.spacing = spacing;
+            this.type = type;
+
+            ClearUnderlay();
+            delayedSelect = false;
+            previewIconAssigned = false;
+
+            int tileSize = owner.TileSize;
+            icon.SetTexture(GetTypeIcon(path, tileSize));
+            icon.SetTint(Color.White);
+            label.SetContent(PathEx.GetTail(path));
 
             if (owner.GridLayout)
             {
-                bounds.x = labelBounds.x;
-                bounds.y -= VERT_PADDING;
-                bounds.width = labelBounds.width;
-                bounds.height = (labelBounds.y + labelBounds.height + VERT_PADDING) - bounds.y;
+                int top = bounds.y + VERT_PADDING;
+
+                icon.Bounds = new Rect2I(bounds.x + (bounds.width - tileSize) / 2, top, tileSize, tileSize);
+                label.Bounds = new Rect2I(bounds.x, top + tileSize, bounds.width, bounds.height - VERT_PADDING * 2 - tileSize);
             }
             else
             {
-                bounds.y -= VERT_PADDING;
-                bounds.width = width;
-                bounds.height += VERT_PADDING;
-            }
+                int top = bounds.y + VERT_PADDING;
 
-            string hoistedPath = path;
+                icon.Bounds = new Rect2I(bounds.x, top, tileSize, tileSize);
+                label.Bounds = new Rect2I(bounds.x + tileSize, top, bounds.width - tileSize, bounds.height - VERT_PADDING);
+            }
 
-            GUIButton overlayBtn = new GUIButton("", EditorStyles.Blank);
             overlayBtn.Bounds = bounds;
-            overlayBtn.OnClick += () => OnEntryClicked(hoistedPath);
-            overlayBtn.OnDoubleClick += () => OnEntryDoubleClicked(hoistedPath);
-            overlayBtn.SetContextMenu(owner.Window.ContextMenu);
-            overlayBtn.AcceptsKeyFocus = false;
 
-            owner.Overlay.AddElement(overlayBtn);
-
-            if (groupUnderlay != null)
-            {
-                if (owner.GridLayout)
-                {
-                    bool firstInRow = index % owner.ElementsPerRow == 0;
-                    bool lastInRow = index % owner.ElementsPerRow == (owner.ElementsPerRow - 1);
+            UpdateGroupUnderlay();
+            SetActive(true);
+        }
 
-                    int offsetToPrevious = 0;
-                    if (type == LibraryGUIEntryType.MultiFirst)
-                    {
-                        if (firstInRow)
-                            offsetToPrevious = owner.PaddingLeft / 3;
-                        else
-                            offsetToPrevious = spacing / 3;
-                    }
-                    else if (firstInRow)
-                        offsetToPrevious = owner.PaddingLeft;
+        /// <summary>
+        /// Hides the entry so it can be reused for displaying another resource later.
+        /// </summary>
+        public void Release()
+        {
+            StopRename();
+            ClearUnderlay();
+            SetActive(false);
 
-                    int offsetToNext = spacing;
-                    if (type == LibraryGUIEntryType.MultiLast)
-                    {
-                        if (lastInRow)
-                            offsetToNext = owner.PaddingRight / 3;
-                        else
-                            offsetToNext = spacing / 3;
-                    }
-                    else if (lastInRow)
-                        offsetToNext = owner.PaddingRight + spacing;
+            path = null;
+            index = -1;
+            delayedSelect = false;
+        }
 
-                    Rect2I bgBounds = new Rect2I(bounds.x - offsetToPrevious, bounds.y,
-                        bounds.width + offsetToNext + offsetToPrevious, bounds.height);
-                    groupUnderlay.Bounds = bgBounds;
-                }
-                else
-                {
-                    int offsetToNext = BG_VERT_PADDING + LibraryGUIContent.LIST_ENTRY_SPACING;
-                    if (type == LibraryGUIEntryType.MultiLast)
-                        offsetToNext = BG_VERT_PADDING * 2;
+        /// <summary>
+        /// Replaces the generic resource type icon with the resource preview icon, if the resource has one.
+        /// </summary>
+        public void AssignPreviewIcon()
+        {
+            if (path == null || previewIconAssigned)
+                return;
 
-                    Rect2I bgBounds = new Rect2I(bounds.x, bounds.y - BG_VERT_PADDING,
-                        bounds.width, bounds.height + offsetToNext);
+            previewIconAssigned = true;
 
-                    groupUnderlay.Bounds = bgBounds;
-                }
-            }
+            SpriteTexture previewIcon = GetPreviewIcon(path, owner.TileSize);
+            if (previewIcon != null)
+                icon.SetTexture(previewIcon);
         }
 
         /// <summary>
@@ -256,6 +203,7 @@ namespace bs.Editor
                 }
 
                 ProgressBar.Hide();
+                delayedOpenCodeEditorFrame = ulong.MaxValue;
             }
         }
 
@@ -386,6 +334,118 @@ namespace bs.Editor
             return "";
         }
 
+        /// <summary>
+        /// Shows or hides all the GUI elements of the entry.
+        /// </summary>
+        /// <param name="active">True to show the elements, false to hide them.</param>
+        private void SetActive(bool active)
+        {
+            icon.Active = active;
+            label.Active = active;
+            overlayBtn.Active = active;
+
+            if (groupUnderlay != null)
+                groupUnderlay.Active = active;
+        }
+
+        /// <summary>
+        /// Creates, updates or removes the background displayed behind entries that are part of a multi-resource group,
+        /// depending on the entry type and position.
+        /// </summary>
+        private void UpdateGroupUnderlay()
+        {
+            if (groupUnderlay != null && groupUnderlayType != type)
+            {
+                groupUnderlay.Destroy();
+                groupUnderlay = null;
+            }
+
+            groupUnderlayType = type;
+            if (type == LibraryGUIEntryType.Single)
+                return;
+
+            if (groupUnderlay == null)
+            {
+                string style = null;
+                if (owner.GridLayout)
+                {
+                    switch (type)
+                    {
+                        case LibraryGUIEntryType.MultiFirst:
+                            style = LibraryEntryFirstBg;
+                            break;
+                        case LibraryGUIEntryType.MultiElement:
+                            style = LibraryEntryBg;
+                            break;
+                        case LibraryGUIEntryType.MultiLast:
+                            style = LibraryEntryLastBg;
+                            break;
+                    }
+                }
+                else
+                {
+                    switch (type)
+                    {
+                        case LibraryGUIEntryType.MultiFirst:
+                            style = LibraryEntryVertFirstBg;
+                            break;
+                        case LibraryGUIEntryType.MultiElement:
+                            style = LibraryEntryVertBg;
+                            break;
+                        case LibraryGUIEntryType.MultiLast:
+                            style = LibraryEntryVertLastBg;
+                            break;
+                    }
+                }
+
+                groupUnderlay = new GUITexture(null, style);
+                owner.DeepUnderlay.AddElement(groupUnderlay);
+            }
+
+            if (owner.GridLayout)
+            {
+                bool firstInRow = index % owner.ElementsPerRow == 0;
+                bool lastInRow = index % owner.ElementsPerRow == (owner.ElementsPerRow - 1);
+
+                int offsetToPrevious = 0;
+                if (type == LibraryGUIEntryType.MultiFirst)
+                {
+                    if (firstInRow)
+                        offsetToPrevious = owner.PaddingLeft / 3;
+                    else
+                        offsetToPrevious = spacing / 3;
+                }
+                else if (firstInRow)
+                    offsetToPrevious = owner.PaddingLeft;
+
+                int offsetToNext = spacing;
+                if (type == LibraryGUIEntryType.MultiLast)
+                {
+                    if (lastInRow)
+                        offsetToNext = owner.PaddingRight / 3;
+                    else
+                        offsetToNext = spacing / 3;
+                }
+                else if (lastInRow)
+                    offsetToNext = owner.PaddingRight + spacing;
+
+                Rect2I bgBounds = new Rect2I(bounds.x - offsetToPrevious, bounds.y,
+                    bounds.width + offsetToNext + offsetToPrevious, bounds.height);
+                groupUnderlay.Bounds = bgBounds;
+            }
+            else
+            {
+                int offsetToNext = BG_VERT_PADDING + LibraryGUIContent.LIST_ENTRY_SPACING;
+                if (type == LibraryGUIEntryType.MultiLast)
+                    offsetToNext = BG_VERT_PADDING * 2;
+
+                Rect2I bgBounds = new Rect2I(bounds.x, bounds.y - BG_VERT_PADDING,
+                    bounds.width, bounds.height + offsetToNext);
+
+                groupUnderlay.Bounds = bgBounds;
+            }
+        }
+
         /// <summary>
         /// Clears the underlay GUI element (for example ping, hover, select).
         /// </summary>
@@ -472,12 +532,12 @@ namespace bs.Editor
         }
 
         /// <summary>
-        /// Returns an icon that can be used for displaying a resource of the specified type.
+        /// Returns a generic icon that can be used for displaying a resource of the specified type.
         /// </summary>
         /// <param name="path">Path to the project library entry to display data for.</param>
         /// <param name="size">Size of the icon to retrieve, in pixels.</param>
         /// <returns>Icon to display for the specified entry.</returns>
-        private static SpriteTexture GetIcon(string path, int size)
+        private static SpriteTexture GetTypeIcon(string path, int size)
         {
             LibraryEntry entry = ProjectLibrary.GetEntry(path);
             if (entry.Type == LibraryEntryType.Directory)
@@ -487,21 +547,6 @@ namespace bs.Editor
             else
             {
                 ResourceMeta meta = ProjectLibrary.GetMeta(path);
-                ProjectResourceIcons icons = meta.Icons;
-
-                RRef<Texture> icon;
-                if (size <= 16)
-                    icon = icons.icon16;
-                else if (size <= 32)
-                    icon = icons.icon32;
-                else if (size <= 48)
-                    icon = icons.icon48;
-                else
-                    icon = icons.icon64;
-
-                if (icon.Value != null)
-                    return new SpriteTexture(icon);
-
                 switch (meta.ResType)
                 {
                     case ResourceType.Font:
@@ -541,6 +586,40 @@ namespace bs.Editor
 
             return null;
         }
+
+        /// <summary>
+        /// Returns the preview icon generated for the resource during import.
+        /// </summary>
+        /// <param name="path">Path to the project library entry to display data for.</param>
+        /// <param name="size">Size of the icon to retrieve, in pixels.</param>
+        /// <returns>Preview icon of the resource, or null if the entry doesn't have one.</returns>
+        private static SpriteTexture GetPreviewIcon(string path, int size)
+        {
+            LibraryEntry entry = ProjectLibrary.GetEntry(path);
+            if (entry == null || entry.Type == LibraryEntryType.Directory)
+                return null;
+
+            ResourceMeta meta = ProjectLibrary.GetMeta(path);
+            if (meta == null)
+                return null;
+
+            ProjectResourceIcons icons = meta.Icons;
+
+            RRef<Texture> icon;
+            if (size <= 16)
+                icon = icons.icon16;
+            else if (size <= 32)
+                icon = icons.icon32;
+            else if (size <= 48)
+                icon = icons.icon48;
+            else
+                icon = icons.icon64;
+
+            if (icon.Value != null)
+                return new SpriteTexture(icon);
+
+            return null;
+        }
     }
 
     /// <summary>
@@ -483,8 +483,8 @@ namespace bs.Editor
         /// <param name="path">Project library path to the element.</param>
         internal void Select(string path)
         {
-            LibraryGUIEntry entry;
-            if (!content.TryGetEntry(path, out entry))
+            int index;
+            if (!content.TryGetIndex(path, out index))
                 return;
 
             bool ctrlDown = Input.IsButtonHeld(ButtonCode.LeftControl) || Input.IsButtonHeld(ButtonCode.RightControl);
@@ -492,23 +492,23 @@ namespace bs.Editor
 
             if (shiftDown)
             {
-                if (selectionAnchorStart != -1 && selectionAnchorStart < content.Entries.Count)
+                if (selectionAnchorStart != -1 && selectionAnchorStart < content.EntryCount)
                 {
-                    int start = Math.Min(entry.index, selectionAnchorStart);
-                    int end = Math.Max(entry.index, selectionAnchorStart);
+                    int start = Math.Min(index, selectionAnchorStart);
+                    int end = Math.Max(index, selectionAnchorStart);
 
                     List<string> newSelection = new List<string>();
                     for(int i = start; i <= end; i++)
-                        newSelection.Add(content.Entries[i].path);
+                        newSelection.Add(content.GetPath(i));
 
                     SetSelection(newSelection);
-                    selectionAnchorEnd = entry.index;
+                    selectionAnchorEnd = index;
                 }
                 else
                 {
                     SetSelection(new List<string>() {path});
-                    selectionAnchorStart = entry.index;
-                    selectionAnchorEnd = entry.index;
+                    selectionAnchorStart = index;
+                    selectionAnchorEnd = index;
                 }
             }
             else if (ctrlDown)
@@ -522,23 +522,11 @@ namespace bs.Editor
                         DeselectAll();
                     else
                     {
-                        if (selectionAnchorStart == entry.index)
-                        {
-                            LibraryGUIEntry newAnchorEntry;
-                            if (!content.TryGetEntry(newSelection[0], out newAnchorEntry))
-                                selectionAnchorStart = -1;
-                            else
-                                selectionAnchorStart = newAnchorEntry.index;
-                        }
+                        if (selectionAnchorStart == index)
+                            content.TryGetIndex(newSelection[0], out selectionAnchorStart);
 
-                        if (selectionAnchorEnd == entry.index)
-                        {
-                            LibraryGUIEntry newAnchorEntry;
-                            if (!content.TryGetEntry(newSelection[newSelection.Count - 1], out newAnchorEntry))
-                                selectionAnchorEnd = -1;
-                            else
-                                selectionAnchorEnd = newAnchorEntry.index;
-                        }
+                        if (selectionAnchorEnd == index)
+                            content.TryGetIndex(newSelection[newSelection.Count - 1], out selectionAnchorEnd);
 
                         SetSelection(newSelection);
                     }
@@ -547,15 +535,15 @@ namespace bs.Editor
                 {
                     newSelection.Add(path);
                     SetSelection(newSelection);
-                    selectionAnchorEnd = entry.index;
+                    selectionAnchorEnd = index;
                 }
             }
             else
             {
                 SetSelection(new List<string>() {path});
 
-                selectionAnchorStart = entry.index;
-                selectionAnchorEnd = entry.index;
+                selectionAnchorStart = index;
+                selectionAnchorEnd = index;
             }
         }
 
@@ -572,17 +560,17 @@ namespace bs.Editor
             if (selectionPaths.Count == 0 || selectionAnchorEnd == -1)
             {
                 // Nothing is selected so we arbitrarily select first or last element
-                if (content.Entries.Count > 0)
+                if (content.EntryCount > 0)
                 {
                     switch (dir)
                     {
                         case MoveDirection.Left:
                         case MoveDirection.Up:
-                            newPath = content.Entries[content.Entries.Count - 1].path;
+                            newPath = content.GetPath(content.EntryCount - 1);
                             break;
                         case MoveDirection.Right:
                         case MoveDirection.Down:
-                            newPath = content.Entries[0].path;
+                            newPath = content.GetPath(0);
                             break;
                     }
                 }
@@ -593,19 +581,19 @@ namespace bs.Editor
                 {
                     case MoveDirection.Left:
                         if (selectionAnchorEnd - 1 >= 0)
-                            newPath = content.Entries[selectionAnchorEnd - 1].path;
+                            newPath = content.GetPath(selectionAnchorEnd - 1);
                         break;
                     case MoveDirection.Up:
                         if (selectionAnchorEnd - content.ElementsPerRow >= 0)
-                            newPath = content.Entries[selectionAnchorEnd - content.ElementsPerRow].path;
+                            newPath = content.GetPath(selectionAnchorEnd - content.ElementsPerRow);
                         break;
                     case MoveDirection.Right:
-                        if (selectionAnchorEnd + 1 < content.Entries.Count)
-                            newPath = content.Entries[selectionAnchorEnd + 1].path;
+                        if (selectionAnchorEnd + 1 < content.EntryCount)
+                            newPath = content.GetPath(selectionAnchorEnd + 1);
                         break;
                     case MoveDirection.Down:
-                        if (selectionAnchorEnd + content.ElementsPerRow < content.Entries.Count)
-                            newPath = content.Entries[selectionAnchorEnd + content.ElementsPerRow].path;
+                        if (selectionAnchorEnd + content.ElementsPerRow < content.EntryCount)
+                            newPath = content.GetPath(selectionAnchorEnd + content.ElementsPerRow);
                         break;
                 }
             }
@@ -775,11 +763,11 @@ namespace bs.Editor
         /// <param name="path">Project library path to the element.</param>
         internal void ScrollToEntry(string path)
         {
-            LibraryGUIEntry entryGUI;
-            if (!content.TryGetEntry(path, out entryGUI))
+            int index;
+            if (!content.TryGetIndex(path, out index))
                 return;
 
-            Rect2I entryBounds = entryGUI.Bounds;
+            Rect2I entryBounds = content.GetBounds(index);
 
             Rect2I contentBounds = contentScrollArea.Layout.Bounds;
             Rect2I windowEntryBounds = entryBounds;
@@ -995,12 +983,12 @@ namespace bs.Editor
         /// <param name="scrollBounds">Bounds relative to the content scroll area.</param>
         private void SelectInArea(Rect2I scrollBounds)
         {
-            LibraryGUIEntry[] foundElements = content.FindElementsOverlapping(scrollBounds);
+            int[] foundElements = content.FindEntriesOverlapping(scrollBounds);
 
             if (foundElements.Length > 0)
             {
-                selectionAnchorStart = foundElements[0].index;
-                selectionAnchorEnd = foundElements[foundElements.Length - 1].index;
+                selectionAnchorStart = foundElements[0];
+                selectionAnchorEnd = foundElements[foundElements.Length - 1];
             }
             else
             {
@@ -1010,7 +998,7 @@ namespace bs.Editor
 
             List<string> elementPaths = new List<string>();
             foreach (var elem in foundElements)
-                elementPaths.Add(elem.path);
+                elementPaths.Add(content.GetPath(elem));
 
             SetSelection(elementPaths);
         }
@@ -1351,7 +1339,7 @@ namespace bs.Editor
                     ClearHoverHighlight();
 
                     hoverHighlightPath = underCursorElem.path;
-                    underCursorElem.MarkAsHovered(true);
+                    content.MarkAsHovered(hoverHighlightPath, true);
                 }
             }
         }
@@ -86,6 +86,23 @@ namespace bs.Editor
             totalFilesToImport += Internal_Refresh(path, false);
         }
 
+        /// <summary>
+        /// Starts monitoring the project library folder for changes made outside of the editor. Detected changes are
+        /// collected and applied in batches during <see cref="Update"/>.
+        /// </summary>
+        internal static void StartMonitor()
+        {
+            Internal_StartMonitor();
+        }
+
+        /// <summary>
+        /// Stops monitoring the project library folder for changes.
+        /// </summary>
+        internal static void StopMonitor()
+        {
+            Internal_StopMonitor();
+        }
+
         /// <summary>
         /// Registers a new resource in the library.
         /// </summary>
@@ -314,6 +331,7 @@ namespace bs.Editor
         /// </summary>
         internal static void Update()
         {
+            totalFilesToImport += Internal_UpdateMonitor();
             Internal_FinalizeImports();
 
             int inProgressImports = InProgressImportCount;
@@ -376,6 +394,15 @@ namespace bs.Editor
         [MethodImpl(MethodImplOptions.InternalCall)]
         private static extern int Internal_GetInProgressImportCount();
 
+        [MethodImpl(MethodImplOptions.InternalCall)]
+        private static extern void Internal_StartMonitor();
+
+        [MethodImpl(MethodImplOptions.InternalCall)]
+        private static extern void Internal_StopMonitor();
+
+        [MethodImpl(MethodImplOptions.InternalCall)]
+        private static extern int Internal_UpdateMonitor();
+
         [MethodImpl(MethodImplOptions.InternalCall)]
         private static extern void Internal_Create(Resource resource, string path);
 
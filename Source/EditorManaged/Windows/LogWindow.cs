@@ -32,7 +32,15 @@ namespace bs.Editor
         private GUIListView<ConsoleGUIEntry, ConsoleEntryData> listView;
         private List<ConsoleEntryData> entries = new List<ConsoleEntryData>();
         private List<ConsoleEntryData> filteredEntries = new List<ConsoleEntryData>();
+        private List<ConsoleEntryData>[] entriesPerType = 
+        {
+            new List<ConsoleEntryData>(), new List<ConsoleEntryData>(), new List<ConsoleEntryData>()
+        };
+        private List<PendingEntry> pendingEntries = new List<PendingEntry>();
         private EntryFilter filter = EntryFilter.All;
+        private GUIToggle[] filterButtons = new GUIToggle[3];
+        private GUIContentImages[] filterButtonImages = new GUIContentImages[3];
+        private bool countsDirty = true;
         private GUITexture detailsSeparator;
         private GUIScrollArea detailsArea;
         #endregion
@@ -58,6 +66,8 @@ namespace bs.Editor
             LogEntry[] existingEntries = Debug.Messages;
             for (int i = 0; i < existingEntries.Length; i++)
                 OnEntryAdded(existingEntries[i].message, existingEntries[i].verbosity, existingEntries[i].category);
+
+            ProcessPendingEntries();
         }
 
         #endregion
@@ -111,6 +121,14 @@ namespace bs.Editor
             titleLayout.AddElement(clearBtn);
             titleLayout.AddElement(clearOnPlayBtn);
 
+            filterButtons[(int)EntryType.Info] = infoBtn;
+            filterButtons[(int)EntryType.Warning] = warningBtn;
+            filterButtons[(int)EntryType.Error] = errorBtn;
+
+            filterButtonImages[(int)EntryType.Info] = infoImages;
+            filterButtonImages[(int)EntryType.Warning] = warningImages;
+            filterButtonImages[(int)EntryType.Error] = errorImages;
+
             infoBtn.Value = filter.HasFlag(EntryFilter.Info);
             warningBtn.Value = filter.HasFlag(EntryFilter.Warning);
             errorBtn.Value = filter.HasFlag(EntryFilter.Error);
@@ -164,6 +182,14 @@ namespace bs.Editor
 
         private void OnEditorUpdate()
         {
+            ProcessPendingEntries();
+
+            if (countsDirty)
+            {
+                UpdateEntryCounts();
+                countsDirty = false;
+            }
+
             listView.Update();
         }
 
@@ -187,33 +213,69 @@ namespace bs.Editor
         }
 
         /// <summary>
-        /// Triggered when a new entry is added in the debug log.
+        /// Triggered when a new entry is added in the debug log. Entries are only queued here and processed once per frame
+        /// in <see cref="ProcessPendingEntries"/>, as a large number of messages may be logged in a single frame.
         /// </summary>
         /// <param name="message">Message string.</param>
         /// <param name="verbosity">Verbosity level defining message importance.</param>
         /// <param name="category">Category of the sub-system reporting the message.</param>
         private void OnEntryAdded(string message, LogVerbosity verbosity, int category)
         {
-            // Check if compiler message or reported exception, otherwise parse it as a normal log message
-            ParsedLogEntry logEntry = ScriptCodeManager.ParseCompilerMessage(message);
-            if (logEntry == null)
-                logEntry = Debug.ParseExceptionMessage(message);
-
-            if (logEntry == null)
-                logEntry = Debug.ParseLogMessage(message);
-
-            ConsoleEntryData newEntry = new ConsoleEntryData();
-            newEntry.verbosity = verbosity;
-            newEntry.category = category;
-            newEntry.callstack = logEntry.callstack;
-            newEntry.message = logEntry.message;
-
-            entries.Add(newEntry);
-            
-            if (DoesFilterMatch(verbosity))
+            PendingEntry pendingEntry;
+            pendingEntry.message = message;
+            pendingEntry.verbosity = verbosity;
+            pendingEntry.category = category;
+
+            pendingEntries.Add(pendingEntry);
+        }
+
+        /// <summary>
+        /// Parses all entries logged since the last call, and adds them to the console.
+        /// </summary>
+        private void ProcessPendingEntries()
+        {
+            if (pendingEntries.Count == 0)
+                return;
+
+            foreach (var pendingEntry in pendingEntries)
             {
-                listView.AddEntry(newEntry);
-                filteredEntries.Add(newEntry);
+                // Check if compiler message or reported exception, otherwise parse it as a normal log message
+                ParsedLogEntry logEntry = ScriptCodeManager.ParseCompilerMessage(pendingEntry.message);
+                if (logEntry == null)
+                    logEntry = Debug.ParseExceptionMessage(pendingEntry.message);
+
+                if (logEntry == null)
+                    logEntry = Debug.ParseLogMessage(pendingEntry.message);
+
+                ConsoleEntryData newEntry = new ConsoleEntryData();
+                newEntry.verbosity = pendingEntry.verbosity;
+                newEntry.category = pendingEntry.category;
+                newEntry.callstack = logEntry.callstack;
+                newEntry.message = logEntry.message;
+
+                entries.Add(newEntry);
+                entriesPerType[(int)GetEntryType(newEntry.verbosity)].Add(newEntry);
+
+                if (DoesFilterMatch(newEntry.verbosity))
+                {
+                    listView.AddEntry(newEntry);
+                    filteredEntries.Add(newEntry);
+                }
+            }
+
+            pendingEntries.Clear();
+            countsDirty = true;
+        }
+
+        /// <summary>
+        /// Updates the filter buttons to display the number of entries of each type.
+        /// </summary>
+        private void UpdateEntryCounts()
+        {
+            for (int i = 0; i < filterButtons.Length; i++)
+            {
+                LocString text = new LocEdString(entriesPerType[i].Count.ToString());
+                filterButtons[i].SetContent(new GUIContent(text, filterButtonImages[i]));
             }
         }
 
@@ -230,40 +292,87 @@ namespace bs.Editor
 
             listView.Clear();
             filteredEntries.Clear();
-            foreach (var entry in entries)
+
+            if (filter == EntryFilter.All)
+                filteredEntries.AddRange(entries);
+            else
             {
-                if (DoesFilterMatch(entry.verbosity))
+                // Entries are tracked per type, so only the entries matching the filter need to be visited
+                List<ConsoleEntryData> matching = null;
+                int numMatchingTypes = 0;
+                for (int i = 0; i < entriesPerType.Length; i++)
+                {
+                    if (filter.HasFlag(GetFilter((EntryType)i)))
+                    {
+                        matching = entriesPerType[i];
+                        numMatchingTypes++;
+                    }
+                }
+
+                if (numMatchingTypes == 1)
+                    filteredEntries.AddRange(matching);
+                else if (numMatchingTypes > 1)
                 {
-                    listView.AddEntry(entry);
-                    filteredEntries.Add(entry);
+                    foreach (var entry in entries)
+                    {
+                        if (DoesFilterMatch(entry.verbosity))
+                            filteredEntries.Add(entry);
+                    }
                 }
             }
 
+            foreach (var entry in filteredEntries)
+                listView.AddEntry(entry);
+
             sSelectedElementIdx = -1;
         }
 
         /// <summary>
-        /// Checks if the currently active entry filter matches the provided type (the entry with the type that should be
-        /// displayed).
+        /// Returns the entry type that messages with the provided verbosity are displayed as.
         /// </summary>
         /// <param name="verbosity">Message verbosity defining its importance.</param>
-        /// <returns>True if the entry with the specified type should be displayed in the console.</returns>
-        private bool DoesFilterMatch(LogVerbosity verbosity)
+        /// <returns>Type of the entry.</returns>
+        private static EntryType GetEntryType(LogVerbosity verbosity)
         {
             switch (verbosity)
             {
-                case LogVerbosity.VeryVerbose:
-                case LogVerbosity.Verbose:
-                case LogVerbosity.Info:
-                    return filter.HasFlag(EntryFilter.Info);
                 case LogVerbosity.Warning:
-                    return filter.HasFlag(EntryFilter.Warning);
+                    return EntryType.Warning;
                 case LogVerbosity.Error:
                 case LogVerbosity.Fatal:
-                    return filter.HasFlag(EntryFilter.Error);
+                    return EntryType.Error;
+                default:
+                    return EntryType.Info;
             }
+        }
 
-            return false;
+        /// <summary>
+        /// Returns the filter flag that controls the display of entries of the provided type.
+        /// </summary>
+        /// <param name="type">Type of the entry.</param>
+        /// <returns>Filter flag for the entry type.</returns>
+        private static EntryFilter GetFilter(EntryType type)
+        {
+            switch (type)
+            {
+                case EntryType.Warning:
+                    return EntryFilter.Warning;
+                case EntryType.Error:
+                    return EntryFilter.Error;
+                default:
+                    return EntryFilter.Info;
+            }
+        }
+
+        /// <summary>
+        /// Checks if the currently active entry filter matches the provided type (the entry with the type that should be
+        /// displayed).
+        /// </summary>
+        /// <param name="verbosity">Message verbosity defining its importance.</param>
+        /// <returns>True if the entry with the specified type should be displayed in the console.</returns>
+        private bool DoesFilterMatch(LogVerbosity verbosity)
+        {
+            return filter.HasFlag(GetFilter(GetEntryType(verbosity)));
         }
 
         /// <summary>
@@ -284,7 +393,12 @@ namespace bs.Editor
             listView.Clear();
             entries.Clear();
             filteredEntries.Clear();
+            pendingEntries.Clear();
+
+            foreach (var list in entriesPerType)
+                list.Clear();
 
+            countsDirty = true;
             sSelectedElementIdx = -1;
             RefreshDetailsPanel();
         }
@@ -393,6 +507,24 @@ namespace bs.Editor
             Info = 0x01, Warning = 0x02, Error = 0x04, All = Info | Warning | Error
         }
 
+        /// <summary>
+        /// Types of entries displayed in the console, each with its own filter.
+        /// </summary>
+        private enum EntryType
+        {
+            Info, Warning, Error
+        }
+
+        /// <summary>
+        /// Contains data about a logged message that hasn't yet been added to the console.
+        /// </summary>
+        private struct PendingEntry
+        {
+            public string message;
+            public LogVerbosity verbosity;
+            public int category;
+        }
+
         /// <summary>
         /// Contains data for a single entry in the console.
         /// </summary>
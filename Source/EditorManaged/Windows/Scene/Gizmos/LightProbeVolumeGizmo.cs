@@ -1,7 +1,6 @@
 ﻿//********************************** Banshee Engine (www.banshee3d.com) **************************************************//
 //**************** Copyright (c) 2017 Marko Pintera (marko.pintera@gmail.com). All rights reserved. **********************//
 using System;
-using System.Collections.Generic;
 using bs;
 
 namespace bs.Editor
@@ -26,7 +25,8 @@ namespace bs.Editor
         }
 
         private LightProbeVolume volume;
-        private List<HandleSliderSphere> nodeColliders = new List<HandleSliderSphere>();
+        private HandleSliderPointSet nodeColliders;
+        private Vector3[] nodePositions = new Vector3[0];
         private LightProbeInfo[] probeInfos;
 
         private MoveHandle moveHandle;
@@ -39,6 +39,8 @@ namespace bs.Editor
         {
             this.volume = volume;
             selectedNode = uint.MaxValue;
+
+            nodeColliders = new HandleSliderPointSet(this, 1.0f, false);
         }
 
         /// <inheritdoc/>
@@ -46,22 +48,14 @@ namespace bs.Editor
         {
             Matrix4 transform = volume.SceneObject.WorldTransform;
             probeInfos = volume.GetProbes();
-            for (int i = 0; i < probeInfos.Length; i++)
-            {
-                if (i == nodeColliders.Count)
-                    nodeColliders.Add(new HandleSliderSphere(this, 1.0f, false));
 
-                Vector3 position = probeInfos[i].position;
-                position = transform.MultiplyAffine(position);
+            if (nodePositions.Length != probeInfos.Length)
+                nodePositions = new Vector3[probeInfos.Length];
 
-                nodeColliders[i].Position = position;
-            }
+            for (int i = 0; i < probeInfos.Length; i++)
+                nodePositions[i] = transform.MultiplyAffine(probeInfos[i].position);
 
-            while (nodeColliders.Count > probeInfos.Length)
-            {
-                nodeColliders[nodeColliders.Count - 1].Destroy();
-                nodeColliders.RemoveAt(nodeColliders.Count - 1);
-            }
+            nodeColliders.SetPoints(nodePositions);
 
             if (selectedNode != uint.MaxValue)
             {
@@ -86,14 +80,9 @@ namespace bs.Editor
         /// <inheritdoc/>
         protected internal override void PostInput()
         {
-            for (int i = 0; i < nodeColliders.Count; i++)
-            {
-                if (nodeColliders[i].State == HandleSlider.StateType.Active)
-                {
-                    selectedNode = (uint) probeInfos[i].handle;
-                    break;
-                }
-            }
+            int activeNode = nodeColliders.ActivePoint;
+            if (activeNode >= 0 && activeNode < probeInfos.Length)
+                selectedNode = (uint) probeInfos[activeNode].handle;
 
             if (selectedNode != uint.MaxValue && moveHandle != null)
             {
@@ -0,0 +1,86 @@
+﻿//********************************** Banshee Engine (www.banshee3d.com) **************************************************//
+//**************** Copyright (c) 2019 Marko Pintera (marko.pintera@gmail.com). All rights reserved. **********************//
+using System;
+using System.Runtime.CompilerServices;
+using bs;
+
+namespace bs.Editor
+{
+    /** @addtogroup Handles
+     *  @{
+     */
+
+    /// <summary>
+    /// Handle slider represented by a sphere collider around each point in a set. Equivalent to creating a 
+    /// <see cref="HandleSliderSphere"/> per point, but much cheaper for handles with many points as all the points are 
+    /// registered and tested as a single slider. The slider doesn't allow dragging but reports which point was hovered 
+    /// over or selected.
+    /// </summary>
+    public sealed class HandleSliderPointSet : HandleSlider
+    {
+        /// <summary>
+        /// Creates a new point set handle slider. 
+        /// </summary>
+        /// <param name="parentHandle">Handle that the slider belongs to.</param>
+        /// <param name="radius">Radius of the collider sphere around each point.</param>
+        /// <param name="fixedScale">If true the handle slider will always try to maintain the same visible area in the
+        ///                          viewport regardless of distance from camera.</param>
+        /// <param name="layer">Layer that allows filtering of which sliders are interacted with from a specific camera.</param>
+        public HandleSliderPointSet(Handle parentHandle, float radius, bool fixedScale = true, UInt64 layer = 1)
+            :base(parentHandle)
+        {
+            Internal_CreateInstance(this, radius, fixedScale, layer);
+        }
+
+        /// <summary>
+        /// Index of the point the pointer is hovering over, or -1 if the slider isn't hovered over.
+        /// </summary>
+        public int HoverPoint
+        {
+            get
+            {
+                int value;
+                Internal_GetHoverPoint(mCachedPtr, out value);
+                return value;
+            }
+        }
+
+        /// <summary>
+        /// Index of the point that was selected, or -1 if the slider isn't active.
+        /// </summary>
+        public int ActivePoint
+        {
+            get
+            {
+                int value;
+                Internal_GetActivePoint(mCachedPtr, out value);
+                return value;
+            }
+        }
+
+        /// <summary>
+        /// Replaces the points of the slider. Points are relative to the slider's position, rotation and scale. Calling
+        /// this with unchanged points is cheap, so it can be called every frame.
+        /// </summary>
+        /// <param name="points">Positions of the points.</param>
+        public void SetPoints(Vector3[] points)
+        {
+            Internal_SetPoints(mCachedPtr, points);
+        }
+
+        [MethodImpl(MethodImplOptions.InternalCall)]
+        private static extern void Internal_CreateInstance(HandleSliderPointSet instance, float radius, bool fixedScale, 
+            UInt64 layer);
+
+        [MethodImpl(MethodImplOptions.InternalCall)]
+        private static extern void Internal_SetPoints(IntPtr nativeInstance, Vector3[] points);
+
+        [MethodImpl(MethodImplOptions.InternalCall)]
+        private static extern void Internal_GetHoverPoint(IntPtr nativeInstance, out int value);
+
+        [MethodImpl(MethodImplOptions.InternalCall)]
+        private static extern void Internal_GetActivePoint(IntPtr nativeInstance, out int value);
+    }
+
+    /** @} */
+}
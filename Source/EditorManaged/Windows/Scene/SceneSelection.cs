@@ -70,7 +70,8 @@ namespace bs.Editor
         }
 
         /// <summary>
-        /// Attempts to select a scene object under the pointer position.
+        /// Attempts to select a scene object under the pointer position. Picking is asynchronous and the selection is
+        /// updated during a later <see cref="Draw"/> call, once the results are available.
         /// </summary>
         /// <param name="pointerPos">Position of the pointer relative to the scene camera viewport.</param>
         /// <param name="controlHeld">Should this selection add to the existing selection, or replace it.</param>
@@ -81,7 +82,8 @@ namespace bs.Editor
         }
 
         /// <summary>
-        /// Attempts to select a scene object in the specified area.
+        /// Attempts to select a scene object in the specified area. Picking is asynchronous and the selection is updated
+        /// during a later <see cref="Draw"/> call, once the results are available.
         /// </summary>
         /// <param name="pointerPos">Position of the pointer relative to the scene camera viewport.</param>
         /// <param name="area">Size of the in which objects will be selected, in pixels and relative to 
@@ -383,7 +383,7 @@ namespace bs.Editor
         private void DeleteSelection()
         {
             SceneObject[] selectedObjects = Selection.SceneObjects;
-            CleanDuplicates(ref selectedObjects);
+            selectedObjects = EditorUtility.RemoveDescendants(selectedObjects);
 
             if (selectedObjects.Length > 0)
             {
@@ -403,7 +403,7 @@ namespace bs.Editor
         private void DuplicateSelection()
         {
             SceneObject[] selectedObjects = Selection.SceneObjects;
-            CleanDuplicates(ref selectedObjects);
+            selectedObjects = EditorUtility.RemoveDescendants(selectedObjects);
 
             if (selectedObjects.Length > 0)
             {
@@ -1107,40 +1107,6 @@ namespace bs.Editor
             cameraPreviews.Clear();
         }
 
-        /// <summary>
-        /// Parses an array of scene objects and removes elements that are children of elements that are also in the array.
-        /// </summary>
-        /// <param name="objects">Array containing duplicate objects as input, and array without duplicate objects as
-        ///                       output.</param>
-        private void CleanDuplicates(ref SceneObject[] objects)
-        {
-            List<SceneObject> cleanList = new List<SceneObject>();
-            for (int i = 0; i < objects.Length; i++)
-            {
-                bool foundParent = false;
-                for (int j = 0; j < objects.Length; j++)
-                {
-                    SceneObject elem = objects[i];
-
-                    while (elem != null && elem != objects[j])
-                        elem = elem.Parent;
-
-                    bool isChildOf = elem == objects[j];
-
-                    if (i != j && isChildOf)
-                    {
-                        foundParent = true;
-                        break;
-                    }
-                }
-
-                if (!foundParent)
-                    cleanList.Add(objects[i]);
-            }
-
-            objects = cleanList.ToArray();
-        }
-
         /// <summary>
         /// Checks if the load progress bar needs to be shown, shows/hides it and updates the progress accordingly.
         /// </summary>
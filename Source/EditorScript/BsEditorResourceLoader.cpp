@@ -36,6 +36,17 @@ namespace bs
 				"be included in the build. It may not be available outside of the editor.", path);
 		}
 
-		return gResources().loadFromUUID(resUUID, async, flags);
+		// Start loading scene dependencies in parallel, instead of loading them one by one during deserialization
+		Vector<HResource> dependencies;
+		if (meta->getTypeID() == TID_Prefab && flags.isSet(ResourceLoadFlag::LoadDependencies))
+			dependencies = gProjectLibrary().preloadDependencies(path);
+
+		HResource output = gResources().loadFromUUID(resUUID, async, flags);
+
+		// Preloaded dependencies must stay loaded until the scene finishes loading and references them itself
+		if (async)
+			gProjectLibrary()._keepUntilLoaded(output, std::move(dependencies));
+
+		return output;
 	}
 }
\ No newline at end of file
@@ -28,6 +28,7 @@
 #include "Wrappers/BsScriptUndoRedo.h"
 #include "BsEditorScriptLibrary.h"
 #include "Generated/BsScriptPlayInEditor.generated.h"
+#include "BsManagedDiffPlan.h"
 
 namespace bs
 {
@@ -56,6 +57,7 @@ namespace bs
 		ScriptSelection::startUp();
 		ScriptInspectorUtility::startUp();
 		ScriptPlayInEditor::startUp();
+		ManagedDiffPlanManager::startUp();
 
 		mOnDomainLoadConn = ScriptObjectManager::instance().onRefreshDomainLoaded.connect(std::bind(&EditorScriptManager::loadMonoTypes, this));
 		mOnAssemblyRefreshDoneConn = ScriptObjectManager::instance().onRefreshComplete.connect(std::bind(&EditorScriptManager::onAssemblyRefreshDone, this));
@@ -75,6 +77,7 @@ namespace bs
 		mOnDomainLoadConn.disconnect();
 		mOnAssemblyRefreshDoneConn.disconnect();
 
+		ManagedDiffPlanManager::shutDown();
 		ScriptPlayInEditor::shutDown();
 		ScriptInspectorUtility::shutDown();
 		ScriptSelection::shutDown();
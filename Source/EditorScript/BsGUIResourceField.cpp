@@ -186,9 +186,12 @@ namespace bs
 			else if (typeId == TID_ManagedResource)
 			{
 				SPtr<ManagedResourceMetaData> managedResMetaData = std::static_pointer_cast<ManagedResourceMetaData>(meta->getResourceMetaData());
+				if (managedResMetaData == nullptr)
+					continue;
+
 				MonoClass* providedClass = MonoManager::instance().findClass(managedResMetaData->typeNamespace, managedResMetaData->typeName);
 
-				if (providedClass->isSubClassOf(acceptedClass))
+				if (providedClass != nullptr && providedClass->isSubClassOf(acceptedClass))
 				{
 					setUUID(uuid);
 					found = true;
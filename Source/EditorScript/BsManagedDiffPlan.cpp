@@ -0,0 +1,377 @@
+//********************************** Banshee Engine (www.banshee3d.com) **************************************************//
+//**************** Copyright (c) 2016 Marko Pintera (marko.pintera@gmail.com). All rights reserved. **********************//
+#include "BsManagedDiffPlan.h"
+#include "BsMonoField.h"
+#include "BsMonoUtil.h"
+#include "BsMonoArray.h"
+#include "BsScriptObjectManager.h"
+#include "Serialization/BsScriptAssemblyManager.h"
+#include "Serialization/BsManagedSerializableObjectInfo.h"
+#include "Serialization/BsManagedSerializableObject.h"
+#include "Serialization/BsManagedSerializableField.h"
+#include "Serialization/BsMemorySerializer.h"
+#include "Scene/BsGameObjectManager.h"
+#include "BsManagedComponent.h"
+#include "BsMonoClass.h"
+#include "Reflection/BsRTTIType.h"
+
+namespace bs
+{
+	/** Value written in place of an array's element count, if the array is null. */
+	static constexpr UINT32 NULL_ARRAY = 0xFFFFFFFF;
+
+	/** Returns the size of a primitive type in managed memory, or 0 if the type cannot be copied as raw memory. */
+	static UINT32 getPrimitiveSize(ScriptPrimitiveType type)
+	{
+		switch (type)
+		{
+		case ScriptPrimitiveType::Bool:
+		case ScriptPrimitiveType::I8:
+		case ScriptPrimitiveType::U8:
+			return 1;
+		case ScriptPrimitiveType::Char:
+		case ScriptPrimitiveType::I16:
+		case ScriptPrimitiveType::U16:
+			return 2;
+		case ScriptPrimitiveType::I32:
+		case ScriptPrimitiveType::U32:
+		case ScriptPrimitiveType::Float:
+			return 4;
+		case ScriptPrimitiveType::I64:
+		case ScriptPrimitiveType::U64:
+		case ScriptPrimitiveType::Double:
+			return 8;
+		default:
+			return 0;
+		}
+	}
+
+	SPtr<ManagedDiffPlan> ManagedDiffPlan::create(const SPtr<ManagedSerializableObjectInfo>& objInfo, UINT32 generation,
+		bool canRestore)
+	{
+		SPtr<ManagedDiffPlan> plan = bs_shared_ptr_new<ManagedDiffPlan>();
+		plan->mClass = objInfo->mMonoClass;
+		plan->mGeneration = generation;
+		plan->mCanRestore = canRestore;
+
+		bool hasRawFields = false;
+		SPtr<ManagedSerializableObjectInfo> curInfo = objInfo;
+		while (curInfo != nullptr)
+		{
+			for (auto& entry : curInfo->mFields)
+			{
+				const SPtr<ManagedSerializableMemberInfo>& memberInfo = entry.second;
+				if (!memberInfo->isSerializable())
+					continue;
+
+				Field field;
+				field.member = memberInfo;
+				field.field = nullptr;
+				field.elementClass = nullptr;
+				field.size = 0;
+
+				// Properties require invoking a getter/setter, and may have side-effects, so they're always serialized
+				SPtr<ManagedSerializableFieldInfo> fieldInfo = rtti_cast<ManagedSerializableFieldInfo>(memberInfo);
+				if (fieldInfo != nullptr && fieldInfo->mMonoField != nullptr)
+				{
+					::MonoClass* elementClass = nullptr;
+					UINT32 size = 0;
+
+					const SPtr<ManagedSerializableTypeInfo>& typeInfo = memberInfo->mTypeInfo;
+					if (auto primitiveInfo = rtti_cast<ManagedSerializableTypeInfoPrimitive>(typeInfo))
+						size = getPrimitiveSize(primitiveInfo->mType);
+					else if (auto arrayInfo = rtti_cast<ManagedSerializableTypeInfoArray>(typeInfo))
+					{
+						if (arrayInfo->mRank == 1)
+						{
+							auto elementInfo = rtti_cast<ManagedSerializableTypeInfoPrimitive>(arrayInfo->mElementType);
+							if (elementInfo != nullptr)
+							{
+								size = getPrimitiveSize(elementInfo->mType);
+								elementClass = elementInfo->getMonoClass();
+							}
+						}
+					}
+
+					if (size > 0)
+					{
+						field.field = fieldInfo->mMonoField;
+						field.elementClass = elementClass;
+						field.size = size;
+
+						hasRawFields = true;
+					}
+				}
+
+				plan->mFields.push_back(field);
+			}
+
+			curInfo = curInfo->mBaseClass;
+		}
+
+		if (!hasRawFields)
+			return nullptr;
+
+		return plan;
+	}
+
+	SPtr<ManagedRawState> ManagedDiffPlan::capture(const SPtr<ManagedDiffPlan>& plan, MonoObject* instance)
+	{
+		SPtr<ManagedRawState> state = bs_shared_ptr_new<ManagedRawState>();
+		state->plan = plan;
+		state->fieldOffsets.resize(plan->mFields.size() + 1);
+
+		SPtr<ManagedSerializableObject> serializableObject;
+		Vector<UINT8>& data = state->data;
+		for (UINT32 i = 0; i < (UINT32)plan->mFields.size(); i++)
+		{
+			const Field& field = plan->mFields[i];
+			state->fieldOffsets[i] = (UINT32)data.size();
+
+			if (field.field == nullptr)
+			{
+				// Fields that can't be copied as raw memory are serialized individually, so that only the ones that
+				// changed need to be applied
+				if (serializableObject == nullptr)
+					serializableObject = ManagedSerializableObject::createFromExisting(instance);
+
+				SPtr<ManagedSerializableFieldData> fieldData = serializableObject->getFieldData(field.member);
+				if (fieldData == nullptr)
+					continue;
+
+				fieldData->serialize();
+
+				UINT32 numBytes = 0;
+				MemorySerializer serializer;
+				UINT8* encoded = serializer.encode(fieldData.get(), numBytes);
+
+				data.insert(data.end(), encoded, encoded + numBytes);
+				bs_free(encoded);
+			}
+			else if (field.elementClass == nullptr)
+			{
+				data.resize(data.size() + field.size);
+				field.field->get(instance, &data[state->fieldOffsets[i]]);
+			}
+			else
+			{
+				MonoArray* array = nullptr;
+				field.field->get(instance, &array);
+
+				UINT32 numElements = NULL_ARRAY;
+				UINT32 numBytes = 0;
+
+				ScriptArray scriptArray(array);
+				if (array != nullptr)
+				{
+					numElements = scriptArray.size();
+					numBytes = numElements * field.size;
+				}
+
+				data.resize(data.size() + sizeof(UINT32) + numBytes);
+
+				UINT8* dst = &data[state->fieldOffsets[i]];
+				memcpy(dst, &numElements, sizeof(UINT32));
+
+				if (numBytes > 0)
+					memcpy(dst + sizeof(UINT32), scriptArray.getRawPtr<UINT8>(), numBytes);
+			}
+		}
+
+		state->fieldOffsets.back() = (UINT32)data.size();
+		return state;
+	}
+
+	SPtr<ManagedRawDiff> ManagedDiffPlan::diff(const ManagedRawState& oldState, const ManagedRawState& newState)
+	{
+		assert(oldState.plan == newState.plan);
+
+		SPtr<ManagedRawDiff> output;
+		UINT32 numFields = (UINT32)oldState.plan->mFields.size();
+		for (UINT32 i = 0; i < numFields; i++)
+		{
+			UINT32 oldStart = oldState.fieldOffsets[i];
+			UINT32 oldSize = oldState.fieldOffsets[i + 1] - oldStart;
+
+			UINT32 newStart = newState.fieldOffsets[i];
+			UINT32 newSize = newState.fieldOffsets[i + 1] - newStart;
+
+			if (oldSize == newSize && memcmp(&oldState.data[oldStart], &newState.data[newStart], newSize) == 0)
+				continue;
+
+			if (output == nullptr)
+			{
+				output = bs_shared_ptr_new<ManagedRawDiff>();
+				output->plan = newState.plan;
+			}
+
+			ManagedRawDiff::Entry entry;
+			entry.fieldIdx = i;
+			entry.offset = (UINT32)output->data.size();
+			entry.size = newSize;
+
+			output->entries.push_back(entry);
+			output->data.insert(output->data.end(), newState.data.begin() + newStart,
+				newState.data.begin() + newStart + newSize);
+		}
+
+		return output;
+	}
+
+	void ManagedDiffPlan::apply(MonoObject* instance, const ManagedRawDiff& diff)
+	{
+		SPtr<ManagedSerializableObject> serializableObject;
+		for (auto& entry : diff.entries)
+		{
+			const UINT8* src = entry.size > 0 ? &diff.data[entry.offset] : nullptr;
+			writeField(instance, diff.plan->mFields[entry.fieldIdx], src, entry.size, serializableObject);
+		}
+	}
+
+	MonoObject* ManagedDiffPlan::restore(const ManagedRawState& state)
+	{
+		const ManagedDiffPlan& plan = *state.plan;
+		if (!plan.mCanRestore)
+			return nullptr;
+
+		SPtr<ManagedSerializableObject> serializableObject;
+		MonoObject* instance = plan.mClass->createInstance();
+		for (UINT32 i = 0; i < (UINT32)plan.mFields.size(); i++)
+		{
+			UINT32 offset = state.fieldOffsets[i];
+			UINT32 size = state.fieldOffsets[i + 1] - offset;
+
+			const UINT8* src = size > 0 ? &state.data[offset] : nullptr;
+			writeField(instance, plan.mFields[i], src, size, serializableObject);
+		}
+
+		return instance;
+	}
+
+	void ManagedDiffPlan::writeField(MonoObject* instance, const Field& field, const UINT8* src, UINT32 size,
+		SPtr<ManagedSerializableObject>& serializableObject)
+	{
+		if (field.field == nullptr)
+		{
+			if (size == 0)
+				return;
+
+			if (serializableObject == nullptr)
+				serializableObject = ManagedSerializableObject::createFromExisting(instance);
+
+			// References to scene objects and components are restored to the existing objects
+			CoreSerializationContext serzContext;
+			serzContext.goState = bs_shared_ptr_new<GameObjectDeserializationState>(GODM_RestoreExternal);
+
+			MemorySerializer serializer;
+			SPtr<ManagedSerializableFieldData> fieldData = std::static_pointer_cast<ManagedSerializableFieldData>(
+				serializer.decode(const_cast<UINT8*>(src), size, &serzContext));
+
+			serzContext.goState->resolve();
+
+			fieldData->deserialize();
+			serializableObject->setFieldData(field.member, fieldData);
+			return;
+		}
+
+		if (field.elementClass == nullptr)
+		{
+			field.field->set(instance, (void*)src);
+			return;
+		}
+
+		UINT32 numElements;
+		memcpy(&numElements, src, sizeof(UINT32));
+
+		if (numElements == NULL_ARRAY)
+		{
+			field.field->set(instance, nullptr);
+			return;
+		}
+
+		UINT32 numBytes = numElements * field.size;
+
+		// Write into the existing array if possible, so references to it held elsewhere remain valid
+		MonoArray* existing = nullptr;
+		field.field->get(instance, &existing);
+
+		if (existing != nullptr)
+		{
+			ScriptArray existingArray(existing);
+			if (existingArray.size() == numElements)
+			{
+				if (numBytes > 0)
+					memcpy(existingArray.getRawPtr<UINT8>(), src + sizeof(UINT32), numBytes);
+
+				return;
+			}
+		}
+
+		ScriptArray newArray(field.elementClass, numElements);
+		if (numBytes > 0)
+			memcpy(newArray.getRawPtr<UINT8>(), src + sizeof(UINT32), numBytes);
+
+		field.field->set(instance, newArray.getInternal());
+	}
+
+	bool ManagedDiffPlan::isValid() const
+	{
+		return mGeneration == ManagedDiffPlanManager::instance().getGeneration();
+	}
+
+	ManagedDiffPlanManager::ManagedDiffPlanManager()
+	{
+		mRefreshStartedConn = ScriptObjectManager::instance().onRefreshStarted.connect(
+			std::bind(&ManagedDiffPlanManager::clearPlans, this));
+	}
+
+	ManagedDiffPlanManager::~ManagedDiffPlanManager()
+	{
+		mRefreshStartedConn.disconnect();
+	}
+
+	SPtr<ManagedDiffPlan> ManagedDiffPlanManager::getPlan(MonoObject* instance)
+	{
+		if (instance == nullptr)
+			return nullptr;
+
+		::MonoClass* monoClass = MonoUtil::getClass(instance);
+
+		auto iterFind = mPlans.find(monoClass);
+		if (iterFind != mPlans.end())
+			return iterFind->second;
+
+		String elementNs;
+		String elementTypeName;
+		MonoUtil::getClassName(instance, elementNs, elementTypeName);
+
+		// Types that don't support raw diffs are cached as well, so the lookup isn't repeated
+		SPtr<ManagedDiffPlan> plan;
+		SPtr<ManagedSerializableObjectInfo> objInfo;
+		if (ScriptAssemblyManager::instance().getSerializableObjectInfo(elementNs, elementTypeName, objInfo))
+		{
+			// Plain serializable objects are fully described by their fields. Managed components keep all of their
+			// editable state in their fields as well, but are owned by a scene object and can only be patched in place.
+			// Other types (e.g. resources) keep the generic diff. Checked once per type, as it can require serializing
+			// the object.
+			ScriptAssemblyManager& sam = ScriptAssemblyManager::instance();
+			SPtr<IReflectable> nativeValue = sam.getReflectableFromManagedObject(instance);
+			if (nativeValue != nullptr)
+			{
+				if (rtti_is_of_type<ManagedSerializableObject>(nativeValue))
+					plan = ManagedDiffPlan::create(objInfo, mGeneration, true);
+				else if (rtti_is_of_type<ManagedComponent>(nativeValue))
+					plan = ManagedDiffPlan::create(objInfo, mGeneration, false);
+			}
+		}
+
+		mPlans[monoClass] = plan;
+		return plan;
+	}
+
+	void ManagedDiffPlanManager::clearPlans()
+	{
+		mPlans.clear();
+		mGeneration++;
+	}
+}
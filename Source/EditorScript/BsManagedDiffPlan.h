@@ -0,0 +1,148 @@
+//********************************** Banshee Engine (www.banshee3d.com) **************************************************//
+//**************** Copyright (c) 2016 Marko Pintera (marko.pintera@gmail.com). All rights reserved. **********************//
+#pragma once
+
+#include "BsScriptEditorPrerequisites.h"
+#include "Utility/BsModule.h"
+
+namespace bs
+{
+	/** @addtogroup EditorScript
+	 *  @{
+	 */
+
+	class ManagedDiffPlan;
+
+	/**
+	 * Snapshot of all serializable fields of a managed object, captured according to a ManagedDiffPlan. Primitive fields
+	 * are stored as raw memory, and other fields in their serialized form.
+	 */
+	struct ManagedRawState
+	{
+		SPtr<ManagedDiffPlan> plan;
+
+		/**
+		 * Contents of all fields, laid out sequentially. Arrays are prefixed with their element count. Fields that aren't
+		 * stored as raw memory are stored as encoded ManagedSerializableFieldData.
+		 */
+		Vector<UINT8> data;
+
+		/** Offset into @p data for each of the fields in the plan. */
+		Vector<UINT32> fieldOffsets;
+	};
+
+	/** List of fields that differ between two ManagedRawState%s, along with their new raw contents. */
+	struct ManagedRawDiff
+	{
+		/** Contents of a single modified field. */
+		struct Entry
+		{
+			UINT32 fieldIdx;
+			UINT32 offset;
+			UINT32 size;
+		};
+
+		SPtr<ManagedDiffPlan> plan;
+		Vector<Entry> entries;
+		Vector<UINT8> data;
+	};
+
+	/**
+	 * Pre-computed list of serializable fields of a single managed type, describing how to capture, compare and copy
+	 * each of them. Fields holding primitives (other than strings) or single-dimensional arrays of such primitives are
+	 * compared and copied as raw memory, avoiding the generic diff through ManagedSerializableObject. Only the remaining
+	 * fields are serialized, each on its own, so a diff only contains the fields that actually changed.
+	 */
+	class BS_SCR_BED_EXPORT ManagedDiffPlan
+	{
+		/** Information about a single field in the plan. */
+		struct Field
+		{
+			SPtr<ManagedSerializableMemberInfo> member;
+			MonoField* field; /**< Field to copy as raw memory, null if the field is serialized instead. */
+			::MonoClass* elementClass; /**< Element type if the field is an array, null otherwise. */
+			UINT32 size; /**< Size of the field value, or size of a single element for arrays. */
+		};
+
+	public:
+		/**
+		 * Attempts to create a plan for the provided managed type. Returns null if the type contains no serializable
+		 * fields that can be compared as raw memory, in which case the plan offers no advantage over the generic diff.
+		 *
+		 * @param[in]	objInfo		Type to create the plan for.
+		 * @param[in]	generation	Current value of ManagedDiffPlanManager::getGeneration().
+		 * @param[in]	canRestore	True if objects of the type are fully described by their fields and can be created
+		 *							from a captured state. False for types that can only be patched, such as
+		 *							components.
+		 */
+		static SPtr<ManagedDiffPlan> create(const SPtr<ManagedSerializableObjectInfo>& objInfo, UINT32 generation,
+			bool canRestore);
+
+		/** Records current contents of all the fields in the provided plan, for the provided object. */
+		static SPtr<ManagedRawState> capture(const SPtr<ManagedDiffPlan>& plan, MonoObject* instance);
+
+		/**
+		 * Compares two states previously captured using the same plan, and returns the set of fields that differ. Returns
+		 * null if the states are identical.
+		 */
+		static SPtr<ManagedRawDiff> diff(const ManagedRawState& oldState, const ManagedRawState& newState);
+
+		/** Applies a diff previously generated with diff() to the provided object. */
+		static void apply(MonoObject* instance, const ManagedRawDiff& diff);
+
+		/**
+		 * Creates a new managed object with the contents of its fields set to the provided state. Returns null if the
+		 * plan doesn't support restoring objects. See canRestore().
+		 */
+		static MonoObject* restore(const ManagedRawState& state);
+
+		/** Checks is the plan still valid, or have the script assemblies been reloaded since its creation. */
+		bool isValid() const;
+
+		/** Checks can new objects be created from states captured using this plan. See restore(). */
+		bool canRestore() const { return mCanRestore; }
+
+	private:
+		/**
+		 * Writes field contents, in the format recorded by capture(), into the field of the provided object.
+		 * @p serializableObject is created on first use if null, and is only needed by fields not stored as raw memory.
+		 */
+		static void writeField(MonoObject* instance, const Field& field, const UINT8* src, UINT32 size,
+			SPtr<ManagedSerializableObject>& serializableObject);
+
+		MonoClass* mClass = nullptr;
+		Vector<Field> mFields;
+		UINT32 mGeneration = 0;
+		bool mCanRestore = true;
+	};
+
+	/**
+	 * Keeps track of diff plans for managed types. Plans are created on first use of the type, and cached until the
+	 * script assemblies are reloaded.
+	 */
+	class BS_SCR_BED_EXPORT ManagedDiffPlanManager : public Module<ManagedDiffPlanManager>
+	{
+	public:
+		ManagedDiffPlanManager();
+		~ManagedDiffPlanManager();
+
+		/**
+		 * Returns a diff plan for the type of the provided managed object. Returns null if the type doesn't support raw
+		 * diffs, or if the object is neither a plain serializable object nor a managed component (e.g. resources).
+		 */
+		SPtr<ManagedDiffPlan> getPlan(MonoObject* instance);
+
+		/** Returns a value that is incremented every time the script assemblies are reloaded. */
+		UINT32 getGeneration() const { return mGeneration; }
+
+	private:
+		/** Clears all cached plans. Triggered when the script assemblies are about to be reloaded. */
+		void clearPlans();
+
+		UnorderedMap<::MonoClass*, SPtr<ManagedDiffPlan>> mPlans;
+		UINT32 mGeneration = 0;
+		HEvent mRefreshStartedConn;
+	};
+
+	/** @} */
+}
@@ -13,6 +13,7 @@
 #include "BsManagedComponent.h"
 #include "Scene/BsGizmoManager.h"
 #include "Scene/BsSelection.h"
+#include "Scene/BsEditorSceneSnapshot.h"
 #include "BsScriptObjectManager.h"
 #include "BsScriptGameObjectManager.h"
 #include "Wrappers/BsScriptComponent.h"
@@ -43,6 +44,11 @@ namespace bs
 
 	void ScriptGizmoManager::update()
 	{
+		// Gizmos don't depend on the view, so when multiple views are open only the first one generates them
+		EditorSceneSnapshot& snapshot = EditorSceneSnapshot::instance();
+		if (snapshot.isDone(this))
+			return;
+
 		GizmoManager::instance().clearGizmos();
 
 		HSceneObject rootSO = SceneManager::instance().getMainScene()->getRoot();
@@ -52,8 +58,6 @@ namespace bs
 
 		bool isParentSelected = false;
 		UINT32 parentSelectedPopIdx = 0;
-		
-		Vector<HSceneObject> selectedObjects = Selection::instance().getSceneObjects();
 
 		while (!todo.empty())
 		{
@@ -68,7 +72,7 @@ namespace bs
 			if(curSO->hasFlag(SOF_Internal))
 				continue;
 
-			bool isSelected = std::count(selectedObjects.begin(), selectedObjects.end(), curSO) > 0;
+			bool isSelected = snapshot.isSelected(curSO);
 			if (isSelected && !isParentSelected)
 			{
 				isParentSelected = true;
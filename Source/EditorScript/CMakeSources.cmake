@@ -1,5 +1,6 @@
 set(BS_EDITORSCRIPT_INC_NOFILTER
 	"BsScriptEditorPrerequisites.h"
+	"BsManagedDiffPlan.h"
 	"BsGUIGameObjectField.h"
 	"BsGUIResourceField.h"
 	"BsEditorScriptManager.h"
@@ -40,6 +41,7 @@ set(BS_EDITORSCRIPT_SRC_WRAPPERS
 	"Wrappers/BsScriptEditorSettings.cpp"
 	"Wrappers/BsScriptEditorTestSuite.cpp"
 	"Wrappers/BsScriptEditorUtility.cpp"
+	"Wrappers/BsScriptEditorProfiler.cpp"
 	"Wrappers/BsScriptEditorVirtualInput.cpp"
 	"Wrappers/BsScriptEditorWindow.cpp"
 	"Wrappers/BsScriptFolderMonitor.cpp"
@@ -51,6 +53,7 @@ set(BS_EDITORSCRIPT_SRC_WRAPPERS
 	"Wrappers/BsScriptHandleSliderManager.cpp"
 	"Wrappers/BsScriptHandleSliderPlane.cpp"
 	"Wrappers/BsScriptHandleSliderSphere.cpp"
+	"Wrappers/BsScriptHandleSliderPointSet.cpp"
 	"Wrappers/BsScriptHandleSlider2D.cpp"
 	"Wrappers/BsScriptInspectorUtility.cpp"
 	"Wrappers/BsScriptModalWindow.cpp"
@@ -71,6 +74,7 @@ set(BS_EDITORSCRIPT_SRC_WRAPPERS
 )
 
 set(BS_EDITORSCRIPT_SRC_NOFILTER
+	"BsManagedDiffPlan.cpp"
 	"BsGUIGameObjectField.cpp"
 	"BsGUIResourceField.cpp"
 	"BsEditorScriptManager.cpp"
@@ -94,6 +98,7 @@ set(BS_EDITORSCRIPT_INC_WRAPPERS
 	"Wrappers/BsScriptEditorSettings.h"
 	"Wrappers/BsScriptEditorTestSuite.h"
 	"Wrappers/BsScriptEditorUtility.h"
+	"Wrappers/BsScriptEditorProfiler.h"
 	"Wrappers/BsScriptEditorVirtualInput.h"
 	"Wrappers/BsScriptEditorWindow.h"
 	"Wrappers/BsScriptFolderMonitor.h"
@@ -117,6 +122,7 @@ set(BS_EDITORSCRIPT_INC_WRAPPERS
 	"Wrappers/BsScriptHandleSliderLine.h"
 	"Wrappers/BsScriptHandleSliderDisc.h"
 	"Wrappers/BsScriptHandleSliderSphere.h"
+	"Wrappers/BsScriptHandleSliderPointSet.h"
 	"Wrappers/BsScriptHandleSlider2D.h"
 	"Wrappers/BsScriptHandleSlider.h"
 	"Wrappers/BsScriptHandleDrawing.h"
@@ -0,0 +1,133 @@
+//********************************** Banshee Engine (www.banshee3d.com) **************************************************//
+//**************** Copyright (c) 2019 Marko Pintera (marko.pintera@gmail.com). All rights reserved. **********************//
+#include "Wrappers/BsScriptEditorProfiler.h"
+#include "BsScriptMeta.h"
+#include "BsMonoClass.h"
+#include "BsMonoUtil.h"
+#include "Utility/BsEditorProfiler.h"
+
+namespace bs
+{
+	ScriptEditorProfiler::ScriptEditorProfiler(MonoObject* instance)
+		:ScriptObject(instance)
+	{ }
+
+	void ScriptEditorProfiler::initRuntimeData()
+	{
+		metaData.scriptClass->addInternalCall("Internal_SetEnabled", (void*)&ScriptEditorProfiler::internal_SetEnabled);
+		metaData.scriptClass->addInternalCall("Internal_IsEnabled", (void*)&ScriptEditorProfiler::internal_IsEnabled);
+		metaData.scriptClass->addInternalCall("Internal_GetFrameIdx", (void*)&ScriptEditorProfiler::internal_GetFrameIdx);
+		metaData.scriptClass->addInternalCall("Internal_GetFrameStart", (void*)&ScriptEditorProfiler::internal_GetFrameStart);
+		metaData.scriptClass->addInternalCall("Internal_GetThreadNames", (void*)&ScriptEditorProfiler::internal_GetThreadNames);
+		metaData.scriptClass->addInternalCall("Internal_GetSamples", (void*)&ScriptEditorProfiler::internal_GetSamples);
+		metaData.scriptClass->addInternalCall("Internal_GetAggregates", (void*)&ScriptEditorProfiler::internal_GetAggregates);
+		metaData.scriptClass->addInternalCall("Internal_ExportChromeTrace", (void*)&ScriptEditorProfiler::internal_ExportChromeTrace);
+		metaData.scriptClass->addInternalCall("Internal_Clear", (void*)&ScriptEditorProfiler::internal_Clear);
+	}
+
+	void ScriptEditorProfiler::internal_SetEnabled(bool enabled)
+	{
+		EditorProfiler::instance().setEnabled(enabled);
+	}
+
+	bool ScriptEditorProfiler::internal_IsEnabled()
+	{
+		return EditorProfiler::isEnabled();
+	}
+
+	UINT64 ScriptEditorProfiler::internal_GetFrameIdx()
+	{
+		return EditorProfiler::instance().getFrameIdx();
+	}
+
+	UINT64 ScriptEditorProfiler::internal_GetFrameStart(UINT64 frameIdx)
+	{
+		return EditorProfiler::instance().getFrameStart(frameIdx);
+	}
+
+	MonoArray* ScriptEditorProfiler::internal_GetThreadNames()
+	{
+		Vector<String> threadNames = EditorProfiler::instance().getThreadNames();
+
+		UINT32 numEntries = (UINT32)threadNames.size();
+		ScriptArray output = ScriptArray::create<String>(numEntries);
+		for (UINT32 i = 0; i < numEntries; i++)
+			output.set(i, MonoUtil::stringToMono(threadNames[i]));
+
+		return output.getInternal();
+	}
+
+	void ScriptEditorProfiler::internal_GetSamples(UINT64 firstFrame, UINT64 lastFrame, MonoArray** categories,
+		MonoArray** names, MonoArray** threads, MonoArray** depths, MonoArray** starts, MonoArray** durations)
+	{
+		Vector<EditorProfilerSample> samples = EditorProfiler::instance().getSamples(firstFrame, lastFrame);
+
+		UINT32 numEntries = (UINT32)samples.size();
+		ScriptArray categoriesArray = ScriptArray::create<String>(numEntries);
+		ScriptArray namesArray = ScriptArray::create<String>(numEntries);
+		ScriptArray threadsArray = ScriptArray::create<UINT32>(numEntries);
+		ScriptArray depthsArray = ScriptArray::create<UINT32>(numEntries);
+		ScriptArray startsArray = ScriptArray::create<UINT64>(numEntries);
+		ScriptArray durationsArray = ScriptArray::create<UINT64>(numEntries);
+
+		for (UINT32 i = 0; i < numEntries; i++)
+		{
+			const EditorProfilerSample& sample = samples[i];
+
+			categoriesArray.set(i, MonoUtil::stringToMono(sample.category));
+			namesArray.set(i, MonoUtil::stringToMono(sample.name));
+			threadsArray.set(i, sample.threadIdx);
+			depthsArray.set(i, sample.depth);
+			startsArray.set(i, sample.start);
+			durationsArray.set(i, sample.duration);
+		}
+
+		MonoUtil::referenceCopy(categories, (MonoObject*)categoriesArray.getInternal());
+		MonoUtil::referenceCopy(names, (MonoObject*)namesArray.getInternal());
+		MonoUtil::referenceCopy(threads, (MonoObject*)threadsArray.getInternal());
+		MonoUtil::referenceCopy(depths, (MonoObject*)depthsArray.getInternal());
+		MonoUtil::referenceCopy(starts, (MonoObject*)startsArray.getInternal());
+		MonoUtil::referenceCopy(durations, (MonoObject*)durationsArray.getInternal());
+	}
+
+	void ScriptEditorProfiler::internal_GetAggregates(UINT32 numFrames, MonoArray** categories, MonoArray** names,
+		MonoArray** totalTimes, MonoArray** maxTimes, MonoArray** numSamples)
+	{
+		Vector<EditorProfilerAggregate> aggregates = EditorProfiler::instance().getAggregates(numFrames);
+
+		UINT32 numEntries = (UINT32)aggregates.size();
+		ScriptArray categoriesArray = ScriptArray::create<String>(numEntries);
+		ScriptArray namesArray = ScriptArray::create<String>(numEntries);
+		ScriptArray totalTimesArray = ScriptArray::create<UINT64>(numEntries);
+		ScriptArray maxTimesArray = ScriptArray::create<UINT64>(numEntries);
+		ScriptArray numSamplesArray = ScriptArray::create<UINT32>(numEntries);
+
+		for (UINT32 i = 0; i < numEntries; i++)
+		{
+			const EditorProfilerAggregate& aggregate = aggregates[i];
+
+			categoriesArray.set(i, MonoUtil::stringToMono(aggregate.category));
+			namesArray.set(i, MonoUtil::stringToMono(aggregate.name));
+			totalTimesArray.set(i, aggregate.totalTime);
+			maxTimesArray.set(i, aggregate.maxTime);
+			numSamplesArray.set(i, aggregate.numSamples);
+		}
+
+		MonoUtil::referenceCopy(categories, (MonoObject*)categoriesArray.getInternal());
+		MonoUtil::referenceCopy(names, (MonoObject*)namesArray.getInternal());
+		MonoUtil::referenceCopy(totalTimes, (MonoObject*)totalTimesArray.getInternal());
+		MonoUtil::referenceCopy(maxTimes, (MonoObject*)maxTimesArray.getInternal());
+		MonoUtil::referenceCopy(numSamples, (MonoObject*)numSamplesArray.getInternal());
+	}
+
+	void ScriptEditorProfiler::internal_ExportChromeTrace(MonoString* path)
+	{
+		Path nativePath = MonoUtil::monoToString(path);
+		EditorProfiler::instance().exportChromeTrace(nativePath);
+	}
+
+	void ScriptEditorProfiler::internal_Clear()
+	{
+		EditorProfiler::instance().clear();
+	}
+}
@@ -0,0 +1,40 @@
+//********************************** Banshee Engine (www.banshee3d.com) **************************************************//
+//**************** Copyright (c) 2019 Marko Pintera (marko.pintera@gmail.com). All rights reserved. **********************//
+#pragma once
+
+#include "BsScriptEditorPrerequisites.h"
+#include "BsScriptObject.h"
+
+namespace bs
+{
+	/** @addtogroup ScriptInteropEditor
+	 *  @{
+	 */
+
+	/**	Interop class between C++ & CLR for EditorProfiler. */
+	class BS_SCR_BED_EXPORT ScriptEditorProfiler : public ScriptObject <ScriptEditorProfiler>
+	{
+	public:
+		SCRIPT_OBJ(EDITOR_ASSEMBLY, EDITOR_NS, "EditorProfiler")
+
+	private:
+		ScriptEditorProfiler(MonoObject* instance);
+
+		/************************************************************************/
+		/* 								CLR HOOKS						   		*/
+		/************************************************************************/
+		static void internal_SetEnabled(bool enabled);
+		static bool internal_IsEnabled();
+		static UINT64 internal_GetFrameIdx();
+		static UINT64 internal_GetFrameStart(UINT64 frameIdx);
+		static MonoArray* internal_GetThreadNames();
+		static void internal_GetSamples(UINT64 firstFrame, UINT64 lastFrame, MonoArray** categories, MonoArray** names,
+			MonoArray** threads, MonoArray** depths, MonoArray** starts, MonoArray** durations);
+		static void internal_GetAggregates(UINT32 numFrames, MonoArray** categories, MonoArray** names,
+			MonoArray** totalTimes, MonoArray** maxTimes, MonoArray** numSamples);
+		static void internal_ExportChromeTrace(MonoString* path);
+		static void internal_Clear();
+	};
+
+	/** @} */
+}
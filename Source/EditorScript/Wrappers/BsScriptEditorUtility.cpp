@@ -12,6 +12,7 @@
 #include "BsScriptResourceManager.h"
 #include "Utility/BsUtility.h"
 #include "Scene/BsSceneObject.h"
+#include "BsScriptGameObjectManager.h"
 
 namespace bs
 {
@@ -26,6 +27,7 @@ namespace bs
 		metaData.scriptClass->addInternalCall("Internal_CalculateArrayCenter", (void*)&ScriptEditorUtility::internal_CalculateArrayCenter);
 		metaData.scriptClass->addInternalCall("Internal_FindDependencies", (void*)&ScriptEditorUtility::internal_FindDependencies);
 		metaData.scriptClass->addInternalCall("Internal_IsInternal", (void*)&ScriptEditorUtility::internal_IsInternal);
+		metaData.scriptClass->addInternalCall("Internal_RemoveDescendants", (void*)&ScriptEditorUtility::internal_RemoveDescendants);
 	}
 
 	void ScriptEditorUtility::internal_CalculateBounds(MonoObject* so, AABox* bounds)
@@ -99,6 +101,37 @@ namespace bs
 		*center = EditorUtility::calculateCenter(sceneObjects);
 	}
 
+	MonoArray* ScriptEditorUtility::internal_RemoveDescendants(MonoArray* objects)
+	{
+		Vector<HSceneObject> sceneObjects;
+
+		ScriptArray scriptArray(objects);
+		UINT32 arrayLen = scriptArray.size();
+		sceneObjects.reserve(arrayLen);
+
+		for (UINT32 i = 0; i < arrayLen; i++)
+		{
+			MonoObject* curObject = scriptArray.get<MonoObject*>(i);
+
+			ScriptSceneObject* scriptSO = ScriptSceneObject::toNative(curObject);
+
+			if (scriptSO != nullptr)
+				sceneObjects.push_back(static_object_cast<SceneObject>(scriptSO->getNativeHandle()));
+		}
+
+		EditorUtility::removeDescendants(sceneObjects);
+
+		UINT32 numEntries = (UINT32)sceneObjects.size();
+		ScriptArray output = ScriptArray::create<ScriptSceneObject>(numEntries);
+		for (UINT32 i = 0; i < numEntries; i++)
+		{
+			ScriptSceneObject* scriptSO = ScriptGameObjectManager::instance().getOrCreateScriptSceneObject(sceneObjects[i]);
+			output.set(i, scriptSO->getManagedInstance());
+		}
+
+		return output.getInternal();
+	}
+
 	bool ScriptEditorUtility::internal_IsInternal(ScriptSceneObject* soPtr)
 	{
 		if (ScriptSceneObject::checkIfDestroyed(soPtr))
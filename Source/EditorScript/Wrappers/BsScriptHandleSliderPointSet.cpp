@@ -0,0 +1,71 @@
+//********************************** Banshee Engine (www.banshee3d.com) **************************************************//
+//**************** Copyright (c) 2019 Marko Pintera (marko.pintera@gmail.com). All rights reserved. **********************//
+#include "Wrappers/BsScriptHandleSliderPointSet.h"
+#include "BsScriptMeta.h"
+#include "BsMonoField.h"
+#include "BsMonoClass.h"
+#include "BsMonoManager.h"
+#include "BsMonoArray.h"
+
+namespace bs
+{
+	ScriptHandleSliderPointSet::ScriptHandleSliderPointSet(MonoObject* instance, float radius, bool fixedScale, 
+		UINT64 layer)
+		:ScriptObject(instance), mSlider(nullptr)
+	{
+		mSlider = bs_new<HandleSliderPointSet>(radius, fixedScale, layer);
+	}
+
+	ScriptHandleSliderPointSet::~ScriptHandleSliderPointSet()
+	{
+		if (mSlider != nullptr)
+			bs_delete(mSlider);
+	}
+
+	void ScriptHandleSliderPointSet::destroyInternal()
+	{
+		if (mSlider != nullptr)
+			bs_delete(mSlider);
+
+		mSlider = nullptr;
+	}
+
+	void ScriptHandleSliderPointSet::initRuntimeData()
+	{
+		metaData.scriptClass->addInternalCall("Internal_CreateInstance", (void*)&ScriptHandleSliderPointSet::internal_CreateInstance);
+		metaData.scriptClass->addInternalCall("Internal_SetPoints", (void*)&ScriptHandleSliderPointSet::internal_SetPoints);
+		metaData.scriptClass->addInternalCall("Internal_GetHoverPoint", (void*)&ScriptHandleSliderPointSet::internal_GetHoverPoint);
+		metaData.scriptClass->addInternalCall("Internal_GetActivePoint", (void*)&ScriptHandleSliderPointSet::internal_GetActivePoint);
+	}
+
+	void ScriptHandleSliderPointSet::internal_CreateInstance(MonoObject* instance, float radius, bool fixedScale, 
+		UINT64 layer)
+	{
+		new (bs_alloc<ScriptHandleSliderPointSet>()) ScriptHandleSliderPointSet(instance, radius, fixedScale, layer);
+	}
+
+	void ScriptHandleSliderPointSet::internal_SetPoints(ScriptHandleSliderPointSet* nativeInstance, MonoArray* points)
+	{
+		if (points == nullptr)
+		{
+			nativeInstance->mSlider->setPoints(nullptr, 0);
+			return;
+		}
+
+		// Vector3 is blittable, so the managed array can be copied directly
+		ScriptArray pointsArray(points);
+		nativeInstance->mSlider->setPoints(pointsArray.getRawPtr<Vector3>(), pointsArray.size());
+	}
+
+	void ScriptHandleSliderPointSet::internal_GetHoverPoint(ScriptHandleSliderPointSet* nativeInstance, int* value)
+	{
+		UINT32 point = nativeInstance->mSlider->getHoverPoint();
+		*value = point == HandleSliderPointSet::NO_POINT ? -1 : (int)point;
+	}
+
+	void ScriptHandleSliderPointSet::internal_GetActivePoint(ScriptHandleSliderPointSet* nativeInstance, int* value)
+	{
+		UINT32 point = nativeInstance->mSlider->getActivePoint();
+		*value = point == HandleSliderPointSet::NO_POINT ? -1 : (int)point;
+	}
+}
@@ -0,0 +1,45 @@
+//********************************** Banshee Engine (www.banshee3d.com) **************************************************//
+//**************** Copyright (c) 2019 Marko Pintera (marko.pintera@gmail.com). All rights reserved. **********************//
+#pragma once
+
+#include "BsScriptEditorPrerequisites.h"
+#include "BsScriptObject.h"
+#include "Wrappers/BsScriptHandleSlider.h"
+#include "Handles/BsHandleSliderPointSet.h"
+
+namespace bs
+{
+	/** @addtogroup ScriptInteropEditor
+	 *  @{
+	 */
+
+	/**	Interop class between C++ & CLR for HandleSliderPointSet. */
+	class BS_SCR_BED_EXPORT ScriptHandleSliderPointSet : public ScriptObject <ScriptHandleSliderPointSet, ScriptHandleSliderBase>
+	{
+	public:
+		SCRIPT_OBJ(EDITOR_ASSEMBLY, EDITOR_NS, "HandleSliderPointSet")
+
+	protected:
+		/** @copydoc ScriptHandleSliderBase::getSlider */
+		HandleSlider* getSlider() const override { return mSlider; }
+
+		/** @copydoc ScriptHandleSliderBase::getSlider */
+		void destroyInternal() override;
+
+	private:
+		ScriptHandleSliderPointSet(MonoObject* instance, float radius, bool fixedScale, UINT64 layer);
+		~ScriptHandleSliderPointSet();
+
+		HandleSliderPointSet* mSlider;
+
+		/************************************************************************/
+		/* 								CLR HOOKS						   		*/
+		/************************************************************************/
+		static void internal_CreateInstance(MonoObject* instance, float radius, bool fixedScale, UINT64 layer);
+		static void internal_SetPoints(ScriptHandleSliderPointSet* nativeInstance, MonoArray* points);
+		static void internal_GetHoverPoint(ScriptHandleSliderPointSet* nativeInstance, int* value);
+		static void internal_GetActivePoint(ScriptHandleSliderPointSet* nativeInstance, int* value);
+	};
+
+	/** @} */
+}
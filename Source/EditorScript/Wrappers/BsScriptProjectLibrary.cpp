@@ -60,6 +60,9 @@ namespace bs
 		metaData.scriptClass->addInternalCall("Internal_SetIncludeInBuild", (void*)&ScriptProjectLibrary::internal_SetIncludeInBuild);
 		metaData.scriptClass->addInternalCall("Internal_SetEditorData", (void*)&ScriptProjectLibrary::internal_SetEditorData);
 		metaData.scriptClass->addInternalCall("Internal_GetInProgressImportCount", (void*)&ScriptProjectLibrary::internal_GetInProgressImportCount);
+		metaData.scriptClass->addInternalCall("Internal_StartMonitor", (void*)&ScriptProjectLibrary::internal_StartMonitor);
+		metaData.scriptClass->addInternalCall("Internal_StopMonitor", (void*)&ScriptProjectLibrary::internal_StopMonitor);
+		metaData.scriptClass->addInternalCall("Internal_UpdateMonitor", (void*)&ScriptProjectLibrary::internal_UpdateMonitor);
 
 		OnEntryAddedThunk = (OnEntryChangedThunkDef)metaData.scriptClass->getMethod("Internal_DoOnEntryAdded", 1)->getThunk();
 		OnEntryRemovedThunk = (OnEntryChangedThunkDef)metaData.scriptClass->getMethod("Internal_DoOnEntryRemoved", 1)->getThunk();
@@ -91,6 +94,21 @@ namespace bs
 		return gProjectLibrary().getInProgressImportCount();		
 	}
 
+	void ScriptProjectLibrary::internal_StartMonitor()
+	{
+		gProjectLibrary().startMonitor();
+	}
+
+	void ScriptProjectLibrary::internal_StopMonitor()
+	{
+		gProjectLibrary().stopMonitor();
+	}
+
+	UINT32 ScriptProjectLibrary::internal_UpdateMonitor()
+	{
+		return gProjectLibrary()._updateMonitor();
+	}
+
 	void ScriptProjectLibrary::internal_Create(MonoObject* resource, MonoString* path)
 	{
 		ScriptResource* scrResource = ScriptResource::toNative(resource);
@@ -88,6 +88,9 @@ namespace bs
 		static void internal_SetIncludeInBuild(MonoString* path, bool include);
 		static void internal_SetEditorData(MonoString* path, MonoObject* userData);
 		static UINT32 internal_GetInProgressImportCount();
+		static void internal_StartMonitor();
+		static void internal_StopMonitor();
+		static UINT32 internal_UpdateMonitor();
 	};
 
 	/**	Base class for C++/CLR interop objects used for wrapping LibraryEntry implementations. */
@@ -23,6 +23,9 @@ namespace bs
 
 	ScriptSceneSelection::~ScriptSceneSelection()
 	{
+		if (ScenePicking::isStarted())
+			ScenePicking::instance().cancel(this);
+
 		bs_delete(mSelectionRenderer);
 	}
 
@@ -43,12 +46,8 @@ namespace bs
 			*gizmoDrawSettings);
 	}
 
-	void ScriptSceneSelection::internal_Draw(ScriptSceneSelection* thisPtr)
-	{
-		thisPtr->mSelectionRenderer->update(thisPtr->mCamera);
-	}
-
-	void ScriptSceneSelection::internal_PickObject(ScriptSceneSelection* thisPtr, Vector2I* inputPos, bool additive, MonoArray* ignoreRenderables)
+	void ScriptSceneSelection::startPick(const Vector2I& position, const Vector2I& area, bool additive, bool closestOnly,
+		MonoArray* ignoreRenderables)
 	{
 		Vector<HSceneObject> ignoredSceneObjects;
 
@@ -70,64 +69,37 @@ namespace bs
 			}
 		}
 
-		HSceneObject pickedObject = ScenePicking::instance().pickClosestObject(thisPtr->mCamera, 
-			thisPtr->mGizmoDrawSettings, *inputPos, Vector2I(1, 1), ignoredSceneObjects);
-		if (pickedObject)
-		{
-			if (additive) // Append to existing selection
-			{
-				Vector<HSceneObject> selectedSOs = Selection::instance().getSceneObjects();
-
-				auto iterFind = std::find_if(selectedSOs.begin(), selectedSOs.end(),
-					[&](const HSceneObject& obj) { return obj == pickedObject; }
-				);
-
-				if (iterFind == selectedSOs.end())
-					selectedSOs.push_back(pickedObject);
-
-				Selection::instance().setSceneObjects(selectedSOs);
-			}
-			else
-			{
-				Vector<HSceneObject> selectedSOs = { pickedObject };
-				Selection::instance().setSceneObjects(selectedSOs);
-			}
-		}
-		else if (!additive)
-		{
-			Selection::instance().clearSceneSelection();
-		}
+		// Picking is rendered along with the rest of the frame, and the selection is updated once the results arrive,
+		// rather than stalling until the GPU finishes
+		mPickOp = ScenePicking::instance().pickObjectsAsync(mCamera, mGizmoDrawSettings, position, area,
+			ignoredSceneObjects, false, this);
+		mPickAdditive = additive;
+		mPickClosestOnly = closestOnly;
 	}
 
-	void ScriptSceneSelection::internal_PickObjects(ScriptSceneSelection* thisPtr, Vector2I* inputPos, Vector2I* area, 
-		bool additive, MonoArray* ignoreRenderables)
+	void ScriptSceneSelection::updatePick()
 	{
-		Vector<HSceneObject> ignoredSceneObjects;
+		if (mPickOp == nullptr)
+			return;
 
-		if (ignoreRenderables != nullptr)
+		if (mPickOp->isCanceled())
 		{
-			ScriptArray scriptArray(ignoreRenderables);
-
-			UINT32 arrayLen = scriptArray.size();
-			for (UINT32 i = 0; i < arrayLen; i++)
-			{
-				MonoObject* monoSO = scriptArray.get<MonoObject*>(i);
-				ScriptSceneObject* scriptSO = ScriptSceneObject::toNative(monoSO);
+			mPickOp = nullptr;
+			return;
+		}
 
-				if (scriptSO == nullptr)
-					continue;
+		if (!mPickOp->hasCompleted())
+			return;
 
-				HSceneObject so = static_object_cast<SceneObject>(scriptSO->getNativeHandle());
-				ignoredSceneObjects.push_back(so);
-			}
-		}
+		Vector<HSceneObject> pickedObjects = mPickOp->getObjects();
+		mPickOp = nullptr;
 
-		Vector<HSceneObject> pickedObjects = ScenePicking::instance().pickObjects(thisPtr->mCamera, 
-			thisPtr->mGizmoDrawSettings, *inputPos, *area, ignoredSceneObjects);
+		if (mPickClosestOnly && pickedObjects.size() > 1)
+			pickedObjects.resize(1);
 
 		if (!pickedObjects.empty())
 		{
-			if (additive) // Append to existing selection
+			if (mPickAdditive) // Append to existing selection
 			{
 				Vector<HSceneObject> selectedSOs = Selection::instance().getSceneObjects();
 
@@ -152,12 +124,29 @@ namespace bs
 			else
 				Selection::instance().setSceneObjects(pickedObjects);
 		}
-		else if (!additive)
+		else if (!mPickAdditive)
 		{
 			Selection::instance().clearSceneSelection();
 		}
 	}
 
+	void ScriptSceneSelection::internal_Draw(ScriptSceneSelection* thisPtr)
+	{
+		thisPtr->updatePick();
+		thisPtr->mSelectionRenderer->update(thisPtr->mCamera);
+	}
+
+	void ScriptSceneSelection::internal_PickObject(ScriptSceneSelection* thisPtr, Vector2I* inputPos, bool additive, MonoArray* ignoreRenderables)
+	{
+		thisPtr->startPick(*inputPos, Vector2I(1, 1), additive, true, ignoreRenderables);
+	}
+
+	void ScriptSceneSelection::internal_PickObjects(ScriptSceneSelection* thisPtr, Vector2I* inputPos, Vector2I* area, 
+		bool additive, MonoArray* ignoreRenderables)
+	{
+		thisPtr->startPick(*inputPos, *area, additive, false, ignoreRenderables);
+	}
+
 	MonoObject* ScriptSceneSelection::internal_Snap(ScriptSceneSelection* thisPtr, Vector2I* inputPos, SnapData* data, 
 		MonoArray* ignoreRenderables)
 	{
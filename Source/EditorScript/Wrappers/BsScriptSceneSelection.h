@@ -25,10 +25,24 @@ namespace bs
 		ScriptSceneSelection(MonoObject* object, const SPtr<Camera>& camera, const GizmoDrawSettings& gizmoDrawSettings);
 		~ScriptSceneSelection();
 
+		/** 
+		 * Starts an asynchronous pick of the provided area, whose results will be applied to the selection once the
+		 * pick completes. Replaces any earlier pick that hasn't yet completed.
+		 */
+		void startPick(const Vector2I& position, const Vector2I& area, bool additive, bool closestOnly,
+			MonoArray* ignoreRenderables);
+
+		/** Applies the results of the last started pick to the selection, if it has completed. */
+		void updatePick();
+
 		SPtr<Camera> mCamera;
 		SelectionRenderer* mSelectionRenderer = nullptr;
 		GizmoDrawSettings mGizmoDrawSettings;
 
+		SPtr<ScenePickingOp> mPickOp;
+		bool mPickAdditive = false;
+		bool mPickClosestOnly = false;
+
 		/************************************************************************/
 		/* 								CLR HOOKS						   		*/
 		/************************************************************************/
@@ -11,7 +11,7 @@
 #include "Serialization/BsSerializedObject.h"
 #include "Serialization/BsScriptAssemblyManager.h"
 #include "Utility/BsUtility.h"
-#include "Serialization/BsBinaryDiff.h"
+#include "BsManagedDiffPlan.h"
 
 namespace bs
 {
@@ -21,6 +21,12 @@ namespace bs
 
 	}
 
+	ScriptSerializedDiff::ScriptSerializedDiff(MonoObject* instance, const SPtr<ManagedRawDiff>& rawDiff)
+		: ScriptObject(instance), mRawDiff(rawDiff)
+	{
+
+	}
+
 	void ScriptSerializedDiff::initRuntimeData()
 	{
 		metaData.scriptClass->addInternalCall("Internal_CreateDiff", (void*)&ScriptSerializedDiff::internal_CreateDiff);
@@ -30,6 +36,29 @@ namespace bs
 
 	MonoObject* ScriptSerializedDiff::internal_CreateDiff(ScriptSerializedObject* oldObj, ScriptSerializedObject* newObj)
 	{
+		// Fast path for types whose fields can be compared as raw memory
+		SPtr<ManagedRawState> oldRawState = oldObj->getRawState();
+		SPtr<ManagedRawState> newRawState = newObj->getRawState();
+		if (oldRawState != nullptr || newRawState != nullptr)
+		{
+			if (oldRawState == nullptr || newRawState == nullptr || oldRawState->plan != newRawState->plan ||
+				!oldRawState->plan->isValid())
+			{
+				BS_LOG(Warning, Script, "Cannot diff objects of different types, or objects serialized before the "
+					"script assemblies were reloaded.");
+				return nullptr;
+			}
+
+			SPtr<ManagedRawDiff> rawDiff = ManagedDiffPlan::diff(*oldRawState, *newRawState);
+			if (rawDiff == nullptr)
+				return nullptr;
+
+			MonoObject* instance = metaData.scriptClass->createInstance();
+			new (bs_alloc<ScriptSerializedDiff>()) ScriptSerializedDiff(instance, rawDiff);
+
+			return instance;
+		}
+
 		SPtr<IReflectable> oldSerializedObject = oldObj->getInternal();
 		SPtr<IReflectable> newSerializedObject = newObj->getInternal();
 
@@ -64,6 +93,29 @@ namespace bs
 
 	void ScriptSerializedDiff::internal_ApplyDiff(ScriptSerializedDiff* thisPtr, MonoObject* obj)
 	{
+		if(thisPtr->mRawDiff != nullptr)
+		{
+			if (obj == nullptr)
+				return;
+
+			const SPtr<ManagedDiffPlan>& plan = thisPtr->mRawDiff->plan;
+			if (!plan->isValid())
+			{
+				BS_LOG(Warning, Script, "Cannot apply a serialized diff recorded before the script assemblies were "
+					"reloaded.");
+				return;
+			}
+
+			if (ManagedDiffPlanManager::instance().getPlan(obj) != plan)
+			{
+				BS_LOG(Warning, Script, "Cannot apply a serialized diff to an object of a different type.");
+				return;
+			}
+
+			ManagedDiffPlan::apply(obj, *thisPtr->mRawDiff);
+			return;
+		}
+
 		if(thisPtr->mSerializedDiff == nullptr)
 			return;
 
@@ -90,6 +142,6 @@ namespace bs
 
 	bool ScriptSerializedDiff::internal_IsEmpty(ScriptSerializedDiff* thisPtr)
 	{
-		return thisPtr->mSerializedDiff == nullptr;
+		return thisPtr->mSerializedDiff == nullptr && thisPtr->mRawDiff == nullptr;
 	}
 }
@@ -8,6 +8,7 @@
 namespace bs
 {
 	class ScriptSerializedObject;
+	struct ManagedRawDiff;
 
 	/** @addtogroup ScriptInteropEditor
 	 *  @{
@@ -21,8 +22,10 @@ namespace bs
 
 	private:
 		ScriptSerializedDiff(MonoObject* instance, const SPtr<IReflectable>& obj);
+		ScriptSerializedDiff(MonoObject* instance, const SPtr<ManagedRawDiff>& rawDiff);
 
 		SPtr<IReflectable> mSerializedDiff;
+		SPtr<ManagedRawDiff> mRawDiff;
 
 		/************************************************************************/
 		/* 								CLR HOOKS						   		*/
@@ -12,11 +12,13 @@
 #include "Reflection/BsRTTIType.h"
 #include "BsScriptGameObjectManager.h"
 #include "Serialization/BsSerializedObject.h"
+#include "BsManagedDiffPlan.h"
 
 namespace bs
 {
-	ScriptSerializedObject::ScriptSerializedObject(MonoObject* instance, const SPtr<IReflectable>& obj)
-		: ScriptObject(instance), mSerializedObject(obj)
+	ScriptSerializedObject::ScriptSerializedObject(MonoObject* instance, const SPtr<IReflectable>& obj,
+		const SPtr<ManagedRawState>& rawState)
+		: ScriptObject(instance), mSerializedObject(obj), mRawState(rawState)
 	{
 
 	}
@@ -32,6 +34,18 @@ namespace bs
 		if (obj == nullptr)
 			return nullptr;
 
+		// If possible only record the raw field contents, which is faster to capture and diff than the object graph
+		SPtr<ManagedDiffPlan> plan = ManagedDiffPlanManager::instance().getPlan(obj);
+		if (plan != nullptr)
+		{
+			SPtr<ManagedRawState> rawState = ManagedDiffPlan::capture(plan, obj);
+
+			MonoObject* instance = metaData.scriptClass->createInstance();
+			new (bs_alloc<ScriptSerializedObject>()) ScriptSerializedObject(instance, nullptr, rawState);
+
+			return instance;
+		}
+
 		SPtr<IReflectable> nativeValue = ScriptAssemblyManager::instance().getReflectableFromManagedObject(obj);
 		if (!nativeValue)
 			return nullptr;
@@ -47,6 +61,24 @@ namespace bs
 
 	MonoObject* ScriptSerializedObject::internal_Deserialize(ScriptSerializedObject* thisPtr)
 	{
+		if (thisPtr->mRawState != nullptr)
+		{
+			if (!thisPtr->mRawState->plan->isValid())
+			{
+				BS_LOG(Warning, Script, "Cannot deserialize an object serialized before the script assemblies were "
+					"reloaded.");
+				return nullptr;
+			}
+
+			if (!thisPtr->mRawState->plan->canRestore())
+			{
+				BS_LOG(Warning, Script, "Components cannot be deserialized.");
+				return nullptr;
+			}
+
+			return ManagedDiffPlan::restore(*thisPtr->mRawState);
+		}
+
 		SPtr<IReflectable> serializedObject = thisPtr->mSerializedObject;
 		if (serializedObject == nullptr)
 			return nullptr;
@@ -7,6 +7,8 @@
 
 namespace bs
 {
+	struct ManagedRawState;
+
 	/** @addtogroup ScriptInteropEditor
 	 *  @{
 	 */
@@ -17,13 +19,21 @@ namespace bs
 	public:
 		SCRIPT_OBJ(EDITOR_ASSEMBLY, EDITOR_NS, "SerializedObject")
 
-		/** Returns the serialized object wrapped by this object. */
+		/** Returns the serialized object wrapped by this object. Null if the object was recorded as raw state only. */
 		SPtr<IReflectable> getInternal() const { return mSerializedObject; }
 
+		/**
+		 * Returns the raw memory state of the serialized object, if its type supports raw diffs. Null otherwise. See
+		 * ManagedDiffPlan. When present, the object graph isn't recorded.
+		 */
+		SPtr<ManagedRawState> getRawState() const { return mRawState; }
+
 	private:
-		ScriptSerializedObject(MonoObject* instance, const SPtr<IReflectable>& obj);
+		ScriptSerializedObject(MonoObject* instance, const SPtr<IReflectable>& obj,
+			const SPtr<ManagedRawState>& rawState = nullptr);
 
 		SPtr<IReflectable> mSerializedObject;
+		SPtr<ManagedRawState> mRawState;
 
 		/************************************************************************/
 		/* 								CLR HOOKS						   		*/
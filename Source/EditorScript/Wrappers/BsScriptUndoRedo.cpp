@@ -162,14 +162,20 @@ namespace bs
 		String nativeDescription = MonoUtil::monoToString(description);
 
 		ScriptArray input(soPtrs);
-		ScriptArray output = ScriptArray::create<ScriptSceneObject>(input.size());
 
+		Vector<HSceneObject> sceneObjects(input.size());
 		for (UINT32 i = 0; i < input.size(); i++)
 		{
 			ScriptSceneObject* soPtr = input.get<ScriptSceneObject*>(i);
-			HSceneObject clone = CmdCloneSO::execute(soPtr->getHandle(), nativeDescription);
+			sceneObjects[i] = soPtr->getHandle();
+		}
+
+		Vector<HSceneObject> clones = CmdCloneSO::execute(sceneObjects, nativeDescription);
 
-			ScriptSceneObject* cloneSoPtr = ScriptGameObjectManager::instance().getOrCreateScriptSceneObject(clone);
+		ScriptArray output = ScriptArray::create<ScriptSceneObject>((UINT32)clones.size());
+		for (UINT32 i = 0; i < (UINT32)clones.size(); i++)
+		{
+			ScriptSceneObject* cloneSoPtr = ScriptGameObjectManager::instance().getOrCreateScriptSceneObject(clones[i]);
 			output.set(i, cloneSoPtr->getManagedInstance());
 		}
 